@@ -52,6 +52,8 @@ namespace Envy
 
         void clear() noexcept;
 
+        [[nodiscard]] f64 mean() const noexcept;
+
         // TODO: Test
         [[nodiscard]] std::string to_string() const;
     };
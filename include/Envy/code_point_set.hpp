@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file code_point_set.hpp
+ * \brief A set of code points with vectorized scanning of UTF-8 text
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "utf8.hpp"
+#include "string_view.hpp"
+
+#include <array>
+#include <vector>
+
+namespace Envy::utf8
+{
+    /********************************************************************************
+     * \brief A set of code points, built once and tested against many
+     *
+     * Code points below U+0080 are held in a bitmap, the rest as sorted, disjoint
+     * ranges. Scanning text for members or non-members classifies whole blocks of
+     * ASCII with SIMD and only decodes multi-unit sequences.
+     *
+     * ```cpp
+     * const Envy::utf8::code_point_set digits {'0', '9'};
+     * auto end {digits.find_first_not_of(token)};
+     * ```
+     ********************************************************************************/
+    class code_point_set final
+    {
+    public:
+
+        /// An inclusive range of code points
+        struct range
+        {
+            u32 first;
+            u32 last;
+        };
+
+    private:
+
+        std::array<u64, 2> ascii {};        ///< One bit per code point below U+0080
+        std::vector<range> ranges;          ///< Sorted, disjoint and non-adjacent, all at or above U+0080
+        usize count {};                     ///< Number of code points in the set
+
+        // lookup tables for the vector kernels, rebuilt whenever the ASCII bitmap changes
+        std::array<u8, 16> nibble_rows {};  ///< Bit h of row l is set if (h << 4 | l) is a member
+        std::array<range, 8> ascii_runs {}; ///< The ASCII members as runs, for kernels without byte shuffles
+        u8 ascii_run_count {};              ///< Number of runs, 0xFF if the members don't fit in 'ascii_runs'
+
+        void insert_range(u32 first, u32 last);
+        void update_tables() noexcept;
+        [[nodiscard]] const code_unit* scan(const code_unit* buffer, usize size_bytes, bool member) const noexcept;
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs an empty set
+         ********************************************************************************/
+        code_point_set() noexcept = default;
+
+
+        /********************************************************************************
+         * \brief Constructs a set of every code point in *characters*
+         *
+         * Ill-formed sequences are added as U+FFFD.
+         ********************************************************************************/
+        explicit code_point_set(Envy::string_view characters);
+
+
+        /********************************************************************************
+         * \brief Constructs a set of the code points in [first, last]
+         ********************************************************************************/
+        code_point_set(code_point first, code_point last);
+
+
+        /********************************************************************************
+         * \brief Adds a code point to the set
+         ********************************************************************************/
+        code_point_set& insert(code_point cp);
+
+
+        /********************************************************************************
+         * \brief Adds the code points in [first, last] to the set, nothing if first > last
+         ********************************************************************************/
+        code_point_set& insert(code_point first, code_point last);
+
+
+        /********************************************************************************
+         * \brief Adds every code point in *characters* to the set
+         ********************************************************************************/
+        code_point_set& insert(Envy::string_view characters);
+
+
+        /********************************************************************************
+         * \brief Determines if a code point is in the set
+         ********************************************************************************/
+        [[nodiscard]] bool contains(code_point cp) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Returns the number of code points in the set
+         ********************************************************************************/
+        [[nodiscard]] usize size() const noexcept;
+
+
+        /********************************************************************************
+         * \brief Determines if the set has no members
+         ********************************************************************************/
+        [[nodiscard]] bool empty() const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the first code point in a UTF-8 buffer that is in the set
+         *
+         * Ill-formed sequences are tested as U+FFFD.
+         *
+         * \param [in] buffer UTF-8 text to scan
+         * \param [in] size_bytes Size of *buffer* in code units
+         * \return const code_unit* lead unit of the code point, nullptr if there isn't one
+         ********************************************************************************/
+        [[nodiscard]] const code_unit* find_first_of(const code_unit* buffer, usize size_bytes) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the first code point in a UTF-8 buffer that is not in the set
+         *
+         * Ill-formed sequences are tested as U+FFFD.
+         *
+         * \param [in] buffer UTF-8 text to scan
+         * \param [in] size_bytes Size of *buffer* in code units
+         * \return const code_unit* lead unit of the code point, nullptr if there isn't one
+         ********************************************************************************/
+        [[nodiscard]] const code_unit* find_first_not_of(const code_unit* buffer, usize size_bytes) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the first code point in *str* that is in the set
+         *
+         * \return utf8::iterator to the code point, or the end of *str*
+         ********************************************************************************/
+        [[nodiscard]] iterator find_first_of(Envy::string_view str) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the first code point in *str* that is not in the set
+         *
+         * \return utf8::iterator to the code point, or the end of *str*
+         ********************************************************************************/
+        [[nodiscard]] iterator find_first_not_of(Envy::string_view str) const noexcept;
+    };
+}
@@ -0,0 +1,98 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file cpu.hpp
+ * \brief CPU feature detection used to select SIMD kernels at runtime
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define ENVY_ARCH_X86
+#endif
+
+// MSVC lets any function use any intrinsic, GCC and Clang need to be told
+// which functions may be compiled for instruction sets beyond the baseline
+#if defined(ENVY_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+    #define ENVY_TARGET_SSE2 __attribute__((target("sse2")))
+    #define ENVY_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define ENVY_TARGET_SSE2
+    #define ENVY_TARGET_AVX2
+#endif
+
+namespace Envy::cpu
+{
+
+    /********************************************************************************
+     * \brief SIMD instruction set levels Envy has kernels for
+     *
+     * Levels are ordered, a CPU supporting a level supports every level below it.
+     ********************************************************************************/
+    enum class simd_level : u8
+    {
+        scalar = 0,  ///< Portable C++, no vector instructions
+        sse2   = 1,  ///< 128 bit SSE2
+        avx2   = 2   ///< 256 bit AVX2
+    };
+
+
+    /********************************************************************************
+     * \brief Returns the highest SIMD level supported by the CPU and OS
+     *
+     * Detection is performed once, subsequent calls return the cached result.
+     *
+     * \return simd_level detected level
+     ********************************************************************************/
+    [[nodiscard]] simd_level detected_simd_level() noexcept;
+
+
+    /********************************************************************************
+     * \brief Returns the SIMD level kernels should be selected for
+     *
+     * This is the detected level clamped to the level set with
+     * \ref Envy::cpu::limit_simd_level().
+     *
+     * \return simd_level level to use
+     ********************************************************************************/
+    [[nodiscard]] simd_level active_simd_level() noexcept;
+
+
+    /********************************************************************************
+     * \brief Caps the SIMD level used when selecting kernels
+     *
+     * Useful for testing and benchmarking the fallback kernels on hardware that
+     * supports wider instruction sets. Levels above the detected level have no effect.
+     *
+     * \param [in] level highest level kernels may use
+     ********************************************************************************/
+    void limit_simd_level(simd_level level) noexcept;
+
+}
@@ -29,10 +29,13 @@
 
 #include "common.hpp"
 #include "log.hpp"
+#include "string_id.hpp"
 
 #include <typeinfo>
 #include <concepts>
 #include <functional>
+#include <new>
+#include <tuple>
 
 namespace Envy
 {
@@ -45,6 +48,11 @@ namespace Envy
     { return typeid(T).hash_code(); }
 
 
+    // named events share one event class between several event types
+    inline event_type type(string_id name) noexcept
+    { return name.value(); }
+
+
     class event
     {
     public:
@@ -58,7 +66,18 @@ namespace Envy
     void register_callback_impl(event_type event_ty, event_callback callback);
     void register_listener(listener_id listenerid, event_type event_ty, event_callback callback);
     void unregister_listener(listener_id listenerid);
-    void queue_event(event_type event_ty, const event* e);
+    void queue_event(event_type event_ty, usize size, usize alignment, const event* (*construct)(void* storage, void* args), void* args);
+
+
+    namespace detail
+    {
+        // constructs an E in 'storage' from a tuple of forwarded arguments
+        template <typename E, typename Args>
+        const event* construct_event(void* storage, void* args)
+        {
+            return std::apply([storage](auto&& ... a) { return ::new (storage) E {std::forward<decltype(a)>(a)...}; }, std::move(*static_cast<Args*>(args)));
+        }
+    }
 
 
     void dispach_events();
@@ -67,7 +86,8 @@ namespace Envy
     template <std::derived_from<event> E, typename ... Ts>
     void post_event(Ts&& ... args)
     {
-        queue_event( type<E>(), new E {std::forward<Ts>(args)...} );
+        auto packed {std::forward_as_tuple(std::forward<Ts>(args)...)};
+        queue_event( type<E>(), sizeof(E), alignof(E), &detail::construct_event<E, decltype(packed)>, &packed );
     }
 
     template <std::derived_from<event> E, typename F>
@@ -78,6 +98,21 @@ namespace Envy
     }
 
 
+    template <std::derived_from<event> E, typename ... Ts>
+    void post_named_event(string_id name, Ts&& ... args)
+    {
+        auto packed {std::forward_as_tuple(std::forward<Ts>(args)...)};
+        queue_event( type(name), sizeof(E), alignof(E), &detail::construct_event<E, decltype(packed)>, &packed );
+    }
+
+    template <std::derived_from<event> E, typename F>
+    requires std::regular_invocable<F,const E&>
+    void register_named_callback(string_id name, F&& f)
+    {
+        register_callback_impl( type(name), [f](const event* e){ std::invoke(f, *dynamic_cast<const E*>(e)); });
+    }
+
+
     inline listener_id next_listener_id {1};
 
 
@@ -0,0 +1,204 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file frame_arena.hpp
+ * \brief Linear allocators for memory that only lives for a frame
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+namespace Envy
+{
+    /********************************************************************************
+     * \brief Memory resource that hands out memory from one block and frees it all at once
+     *
+     * Allocating bumps an offset, deallocating does nothing and reset() makes the
+     * whole block available again. Allocations that don't fit go to the upstream
+     * resource until the next reset(), which then grows the block so a frame as
+     * large fits in it.
+     *
+     * Debug builds fill freed memory with \ref poison and check it is untouched
+     * before handing it out again, catching writes through dangling pointers.
+     *
+     * Not thread safe.
+     *
+     * ```cpp
+     * Envy::frame_arena arena {64u * 1024u};
+     * Envy::string scratch {&arena};
+     * scratch += "lives until the next reset";
+     * ```
+     ********************************************************************************/
+    class frame_arena final : public std::pmr::memory_resource
+    {
+    public:
+
+        static constexpr u8 poison {0xDDu}; ///< Fills freed memory in debug builds
+
+
+        /********************************************************************************
+         * \brief Usage counters of a frame_arena
+         ********************************************************************************/
+        struct statistics
+        {
+            usize used {};             ///< Bytes allocated this frame, alignment padding included
+            usize allocations {};      ///< Allocations made this frame
+            usize last_frame_used {};  ///< Bytes allocated in the frame before the last reset()
+            usize peak {};             ///< Most bytes allocated in any one frame
+            usize overflows {};        ///< Allocations that did not fit in the block, over all frames
+            usize frames {};           ///< Number of times reset() was called
+        };
+
+    private:
+
+        struct overflow
+        {
+            void* ptr;
+            usize bytes;
+            usize alignment;
+        };
+
+        std::pmr::memory_resource* upstream;
+        std::byte* block {};
+        usize block_size {};
+        usize offset {};
+        std::pmr::vector<overflow> overflowed {upstream};
+        statistics counters {};
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override;
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+        void allocate_block(usize bytes);
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs an arena and allocates its block
+         *
+         * \param [in] capacity Size of the block in bytes
+         * \param [in] upstream Resource for the block and for allocations that don't fit
+         ********************************************************************************/
+        explicit frame_arena(usize capacity, std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+        ~frame_arena() override;
+
+        frame_arena(const frame_arena&) = delete;
+        frame_arena& operator=(const frame_arena&) = delete;
+
+
+        /********************************************************************************
+         * \brief Frees everything allocated since the last reset
+         *
+         * Anything still using the arena's memory is left dangling. If the frame
+         * overflowed the block, the block is reallocated large enough for it.
+         ********************************************************************************/
+        void reset();
+
+        /********************************************************************************
+         * \brief Returns the size of the block in bytes
+         ********************************************************************************/
+        [[nodiscard]] usize capacity() const noexcept;
+
+        /********************************************************************************
+         * \brief Returns the arena's usage counters
+         ********************************************************************************/
+        [[nodiscard]] const statistics& stats() const noexcept;
+    };
+
+
+    /********************************************************************************
+     * \brief Two frame_arenas used on alternate frames
+     *
+     * Memory from current() stays valid until the second flip() after it was allocated,
+     * for data made during one frame and read during the next.
+     ********************************************************************************/
+    class double_frame_arena final
+    {
+        std::array<frame_arena, 2> arenas;
+        usize current_index {};
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs both arenas
+         *
+         * \param [in] capacity Size of each arena's block in bytes
+         * \param [in] upstream Resource for the blocks and for allocations that don't fit
+         ********************************************************************************/
+        explicit double_frame_arena(usize capacity, std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+
+
+        /********************************************************************************
+         * \brief Swaps arenas, resetting the one that was used the frame before last
+         ********************************************************************************/
+        void flip();
+
+        /********************************************************************************
+         * \brief Returns the arena to allocate from this frame
+         ********************************************************************************/
+        [[nodiscard]] frame_arena& current() noexcept;
+
+        /********************************************************************************
+         * \brief Returns the arena allocated from last frame
+         ********************************************************************************/
+        [[nodiscard]] const frame_arena& previous() const noexcept;
+    };
+
+
+    /********************************************************************************
+     * \brief The engine's per frame arenas, reset at the top of every main loop iteration
+     *
+     * Main thread only.
+     *
+     * \see Envy::engine::run()
+     ********************************************************************************/
+    namespace frame
+    {
+        /********************************************************************************
+         * \brief Returns the arena for memory that lives until the end of this frame
+         ********************************************************************************/
+        [[nodiscard]] frame_arena& arena();
+
+        /********************************************************************************
+         * \brief Returns the arenas for memory that lives until the end of next frame
+         ********************************************************************************/
+        [[nodiscard]] double_frame_arena& double_buffered();
+
+        /********************************************************************************
+         * \brief Starts a new frame, resetting arena() and flipping double_buffered()
+         ********************************************************************************/
+        void begin();
+    }
+}
@@ -35,11 +35,14 @@
 
 #include "common.hpp"
 #include "string.hpp"
+#include "string_id.hpp"
+#include "shared_string.hpp"
 
 #include <format>
 #include <source_location>
 #include <filesystem>
 #include <chrono>
+#include <iterator>
 
 // We undef assert so as not to colide with Envy::assert() and Envy::logger::assert()
 #ifdef assert
@@ -304,6 +307,18 @@ namespace Envy::log
     void update_log_state(Envy::string_view logger_name, severity sev, message_source loc);
 
 
+    /********************************************************************************
+     * \brief Updates the log message state
+     *
+     * Preferred over the string_view overload, the logger name is not interned again.
+     *
+     * \param [in] logger_name Interned name of the logger logging the next message
+     * \param [in] sev Severity of the next message
+     * \param [in] loc Source location of the next message
+     ********************************************************************************/
+    void update_log_state(Envy::string_id logger_name, severity sev, message_source loc);
+
+
     /********************************************************************************
      * \brief Expand log macros found in string
      *
@@ -367,8 +382,8 @@ namespace Envy::log
     class logger
     {
 
-        Envy::string name {};          ///< Name of the logger, can be displayed in a log preamble
-        Envy::string logfile {};       ///< File to log to, empty for no file
+        Envy::string_id name {};       ///< Name of the logger, can be displayed in a log preamble
+        Envy::shared_string logfile {}; ///< File to log to, empty for no file, shared with every message in flight
         bool console_logging {true};  ///< Whether messages should be logged to the console
 
     public:
@@ -378,7 +393,7 @@ namespace Envy::log
          *
          * \param [in] name Name of the logger, can be displayed in a log preamble
          ********************************************************************************/
-        explicit logger(Envy::string name) noexcept;
+        explicit logger(Envy::string name);
 
 
         /********************************************************************************
@@ -387,7 +402,7 @@ namespace Envy::log
          * \param [in] name Name of the logger, can be displayed in a log preamble
          * \param [in] log_file File to log to
          ********************************************************************************/
-        logger(Envy::string name, Envy::string log_file) noexcept;
+        logger(Envy::string name, Envy::string_view log_file);
 
 
         /********************************************************************************
@@ -397,7 +412,7 @@ namespace Envy::log
          * \param [in] log_file File to log to
          * \param [in] console hether messages should be logged to the console
          ********************************************************************************/
-        logger(Envy::string name, Envy::string log_file, bool console) noexcept;
+        logger(Envy::string name, Envy::string_view log_file, bool console);
 
 
         /********************************************************************************
@@ -555,12 +570,14 @@ namespace Envy::log
         /********************************************************************************
          * \brief Returns the file path this logger is logging to
          *
-         * \return Envy::string the file path
+         * The path is shared, not copied, so this is cheap to call for every message.
+         *
+         * \return Envy::shared_string the file path
          *
          * \see Envy::logger::set_file()
          * \see Envy::logger::clear_file()
          ********************************************************************************/
-        Envy::string get_file() const noexcept;
+        Envy::shared_string get_file() const noexcept;
 
 
         /********************************************************************************
@@ -571,7 +588,7 @@ namespace Envy::log
          * \see Envy::logger::get_file()
          * \see Envy::logger::clear_file()
          ********************************************************************************/
-        void set_file(Envy::string file) noexcept;
+        void set_file(Envy::string_view file);
 
 
         /********************************************************************************
@@ -586,11 +603,17 @@ namespace Envy::log
         /********************************************************************************
          * \brief Returns the name of the logger
          *
-         * TODO: return Envy::string??
-         *
          * \return Envy::string_view The name of the logger
          ********************************************************************************/
         Envy::string_view get_name();
+
+
+        /********************************************************************************
+         * \brief Returns the interned name of the logger
+         *
+         * \return Envy::string_id The name of the logger
+         ********************************************************************************/
+        [[nodiscard]] Envy::string_id get_id() const noexcept;
     };
 
 
@@ -675,18 +698,20 @@ namespace Envy::log
         /********************************************************************************
          * \brief Format the message's format string
          *
-         * Forwards args to \ref std::format(), formatting member string *fmt*, wich
+         * Forwards args to \ref Envy::format_to(), formatting member string *fmt*, wich
          * will be logged on destruction of the \ref Envy::log_message.
          * Also returns a reference to this for calling \ref Envy::log_message::note()
          *
          * \tparam Ts Argument pack, arguments must be convertable to string as define by \ref Envy::convertable_to_string
-         * \param [in] args Arguments to be forwarded to \ref std::format() with member *fmt*
+         * \param [in] args Arguments to be formatted into member *fmt*, types without a std::formatter go through \ref Envy::append_chars()
          * \return log_message& Refference to this log_message
          ********************************************************************************/
         template <convertable_to_string ... Ts>
         message& operator()(Ts&& ... args)
         {
-            fmt = std::format( fmt, std::forward<Ts>(args)... );
+            Envy::string formatted {Envy::string::reserve_tag, fmt.size_bytes()};
+            Envy::format_to(formatted, fmt, detail::format_arg(std::forward<Ts>(args))...);
+            fmt = std::move(formatted);
             return *this;
         }
 
@@ -700,14 +725,15 @@ namespace Envy::log
          *
          * \tparam Ts Argument pack, arguments must be convertable to string as define by \ref Envy::convertable_to_string
          * \param [in] fmtstr Format string of the notes message
-         * \param [in] args Arguments to be forwarded to \ref std::format() with *fmtstr*
+         * \param [in] args Arguments to be formatted with *fmtstr*, types without a std::formatter go through \ref Envy::append_chars()
          * \return log_message& Refference to this log_message, to chain .note() calls
          ********************************************************************************/
         template <convertable_to_string ... Ts>
         message& note(Envy::string_view fmtstr, Ts&& ... args)
         {
             // logging system interprets new-lines as a new note
-            fmt += "\n" + std::format(expand_log_macros(fmtstr), std::forward<Ts>(args)...);
+            fmt += '\n';
+            Envy::format_to(fmt, expand_log_macros(fmtstr), detail::format_arg(std::forward<Ts>(args))...);
             return *this;
         }
 
@@ -859,14 +885,11 @@ namespace Envy
     template <convertable_to_string T>
     void print(T&& v)
     {
-        if constexpr (std::same_as<T,bool>)
-        { std::cout << std::boolalpha << v; }
-
-        // else if constexpr (stream_insertable<T>)
-        // { std::cout << std::forward<T>(v); }
+        if constexpr (detail::format_chars<T>)
+        { std::format_to(std::ostreambuf_iterator<char> {std::cout}, "{}", v); }
 
         else
-        { std::cout << Envy::to_string(std::forward<T>(v)); }
+        { detail::visit_chars(std::forward<T>(v), [](std::string_view text) { std::cout.write(text.data(), static_cast<std::streamsize>(text.size())); }); }
     }
 
 
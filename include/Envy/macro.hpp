@@ -34,6 +34,7 @@
 
 #include "common.hpp"
 #include "string.hpp"
+#include "string_id.hpp"
 #include "log.hpp"
 
 #include <functional>
@@ -167,7 +168,7 @@ namespace Envy
     class macro_map final
     {
 
-        std::unordered_map<Envy::string,macro_t> macros; ///<< underlying map of macros
+        std::unordered_map<Envy::string_id,macro_t> macros; ///<< underlying map of macros
 
     public:
 
@@ -232,7 +233,8 @@ namespace Envy
          *
          * \param [in] name macro to remove
          ********************************************************************************/
-        void remove(const Envy::string& name);
+        void remove(Envy::string_view name);
+        void remove(Envy::string_id name);
 
 
         /********************************************************************************
@@ -262,7 +264,8 @@ namespace Envy
          *
          * \see Envy::macro_expantion_result
          ********************************************************************************/
-        macro_expantion_result expand(const Envy::string& name, Envy::string_view fmt = "") const;
+        macro_expantion_result expand(Envy::string_view name, Envy::string_view fmt = "") const;
+        macro_expantion_result expand(Envy::string_id name, Envy::string_view fmt = "") const;
 
     };
 
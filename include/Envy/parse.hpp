@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file parse.hpp
+ * \brief Locale independent, allocation free parsing of numbers and vectors
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "vector.hpp"
+
+#include <charconv>
+#include <concepts>
+#include <system_error>
+#include <type_traits>
+
+namespace Envy
+{
+
+    /********************************************************************************
+     * \brief Return type for parsing functions
+     *
+     * Holds the parsed value or the reason parsing failed, converts to true on success.
+     * On failure the value is value initialized, except for parse_list() where it
+     * still counts the values written before parsing stopped.
+     *
+     * \see Envy::string_view::parse_as()
+     * \see Envy::string_view::parse_list()
+     ********************************************************************************/
+    template <typename T>
+    class parse_result final
+    {
+    public:
+
+        T value {};           ///< The parsed value, value initialized on failure except for parse_list()'s count
+        std::errc error {};   ///< std::errc{} on success, otherwise why parsing stopped
+
+
+        [[nodiscard]] bool has_value() const noexcept
+        { return error == std::errc {}; }
+
+        explicit operator bool() const noexcept
+        { return has_value(); }
+
+
+        /********************************************************************************
+         * \brief Returns the parsed value, or *fallback* if parsing failed
+         ********************************************************************************/
+        [[nodiscard]] T value_or(T fallback) const noexcept
+        { return has_value() ? value : fallback; }
+    };
+
+
+    namespace detail
+    {
+        template <typename T>
+        struct is_vector2 : std::false_type {};
+
+        template <Envy::numeric T>
+        struct is_vector2<vector2<T>> : std::true_type {};
+    }
+
+
+    /********************************************************************************
+     * \brief Types that can be parsed from text
+     *
+     * Integers other than bool, floating point types and vector2s of them.
+     ********************************************************************************/
+    template <typename T>
+    concept parsable =
+        (std::integral<T> && !std::same_as<T, bool>) ||
+        std::floating_point<T>                        ||
+        detail::is_vector2<T>::value;
+
+
+    namespace detail
+    {
+        [[nodiscard]] constexpr bool is_parse_space(char c) noexcept
+        { return c == ' ' || (c >= '\t' && c <= '\r'); }
+
+
+        [[nodiscard]] constexpr const char* skip_parse_space(const char* first, const char* last) noexcept
+        {
+            while(first != last && is_parse_space(*first))
+            { ++first; }
+            return first;
+        }
+
+
+        // parses a value at the start of [first, last), no whitespace is skipped
+        // before it. Integers are base 10, floats are any std::chars_format::general
+        // form, both may have a leading '+'. vector2s are 'x,y' or '(x,y)' with
+        // whitespace allowed around the components
+        template <parsable T>
+        std::from_chars_result parse_prefix(const char* first, const char* last, T& value) noexcept
+        {
+            if constexpr (is_vector2<T>::value)
+            {
+                const char* p {first};
+                const bool parenthesized {p != last && *p == '('};
+
+                if(parenthesized)
+                { p = skip_parse_space(p + 1, last); }
+
+                auto r {parse_prefix(p, last, value.x)};
+                if(r.ec != std::errc {})
+                { return r; }
+
+                p = skip_parse_space(r.ptr, last);
+                if(p == last || *p != ',')
+                { return {p, std::errc::invalid_argument}; }
+
+                r = parse_prefix(skip_parse_space(p + 1, last), last, value.y);
+                if(r.ec != std::errc {} || !parenthesized)
+                { return r; }
+
+                p = skip_parse_space(r.ptr, last);
+                if(p == last || *p != ')')
+                { return {p, std::errc::invalid_argument}; }
+
+                return {p + 1, std::errc {}};
+            }
+            else
+            {
+                // from_chars only takes a sign when it is '-'
+                if(first != last && *first == '+' && last - first > 1 && first[1] != '-' && first[1] != '+')
+                { ++first; }
+
+                if constexpr (std::floating_point<T>)
+                { return std::from_chars(first, last, value, std::chars_format::general); }
+                else
+                { return std::from_chars(first, last, value); }
+            }
+        }
+
+
+        // the whole of [first, last) must be one value, surrounding whitespace aside
+        template <parsable T>
+        [[nodiscard]] parse_result<T> parse_whole(const char* first, const char* last) noexcept
+        {
+            parse_result<T> result;
+
+            first = skip_parse_space(first, last);
+            const auto r {parse_prefix(first, last, result.value)};
+
+            if(r.ec != std::errc {})
+            { result.error = r.ec; }
+            else if(skip_parse_space(r.ptr, last) != last)
+            { result.error = std::errc::invalid_argument; }
+
+            if(!result.has_value())
+            { result.value = T {}; }
+
+            return result;
+        }
+
+
+        // parses whitespace separated values into 'out', value of the result is the number written
+        template <parsable T>
+        [[nodiscard]] parse_result<usize> parse_list(const char* first, const char* last, T* out, usize capacity) noexcept
+        {
+            parse_result<usize> result;
+
+            for(first = skip_parse_space(first, last); first != last; first = skip_parse_space(first, last))
+            {
+                if(result.value == capacity)
+                {
+                    result.error = std::errc::value_too_large;
+                    break;
+                }
+
+                const auto r {parse_prefix(first, last, out[result.value])};
+
+                if(r.ec == std::errc {} && r.ptr != last && !is_parse_space(*r.ptr))
+                { result.error = std::errc::invalid_argument; }
+                else
+                { result.error = r.ec; }
+
+                if(result.error != std::errc {})
+                { break; }
+
+                ++result.value;
+                first = r.ptr;
+            }
+
+            return result;
+        }
+    }
+
+}
@@ -0,0 +1,319 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file segmentation.hpp
+ * \brief Grapheme cluster and line break segmentation
+ *
+ * Grapheme clusters follow the extended grapheme cluster rules of UAX #29,
+ * line break opportunities the default algorithm of UAX #14. Ill-formed UTF-8
+ * is segmented as if each maximal subpart were U+FFFD.
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "utf8.hpp"
+#include "unicode.hpp"
+#include "string_view.hpp"
+
+#include <iterator>
+
+namespace Envy::utf8
+{
+    /********************************************************************************
+     * \brief Iterates the extended grapheme clusters of a UTF-8 string
+     *
+     * Dereferences to a string_view of the current cluster.
+     ********************************************************************************/
+    class grapheme_iterator final
+    {
+        const code_unit* first {nullptr};   ///< Start of the string, bounds looking back
+        const code_unit* last {nullptr};    ///< End of the string
+        const code_unit* current {nullptr}; ///< First code unit of the current cluster
+        const code_unit* next {nullptr};    ///< One past the last code unit of the current cluster
+
+    public:
+
+        // member types
+        using iterator_category = std::bidirectional_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = Envy::string_view;
+        using pointer           = void;
+        using reference         = value_type;
+
+        /********************************************************************************
+         * \brief Constructs a null grapheme iterator
+         *
+         ********************************************************************************/
+        grapheme_iterator() = default;
+
+        /********************************************************************************
+         * \brief Constructs a grapheme iterator to the cluster starting at 'position'
+         *
+         * \param [in] str string being segmented
+         * \param [in] position must be a grapheme cluster boundary of str
+         ********************************************************************************/
+        grapheme_iterator(const Envy::string_view& str, const code_unit* position) noexcept;
+
+        /********************************************************************************
+         * \brief Increments iterator to refer to the next grapheme cluster
+         *
+         * \return grapheme_iterator& this
+         ********************************************************************************/
+        grapheme_iterator& operator++() noexcept;
+
+        /********************************************************************************
+         * \brief Increments iterator to refer to the next grapheme cluster
+         *
+         * \return grapheme_iterator copy of this
+         ********************************************************************************/
+        grapheme_iterator operator++(int) noexcept;
+
+        /********************************************************************************
+         * \brief Decrements iterator to refer to the previous grapheme cluster
+         *
+         * \return grapheme_iterator& this
+         ********************************************************************************/
+        grapheme_iterator& operator--() noexcept;
+
+        /********************************************************************************
+         * \brief Decrements iterator to refer to the previous grapheme cluster
+         *
+         * \return grapheme_iterator copy of this
+         ********************************************************************************/
+        grapheme_iterator operator--(int) noexcept;
+
+        /********************************************************************************
+         * \brief Returns the current grapheme cluster
+         *
+         * \return value_type view of the cluster's code units
+         ********************************************************************************/
+        [[nodiscard]] value_type operator*() const noexcept;
+
+        /********************************************************************************
+         * \brief Returns a pointer to the first code unit of the current cluster
+         *
+         ********************************************************************************/
+        [[nodiscard]] const code_unit* data() const noexcept { return current; }
+
+        /********************************************************************************
+         * \brief Equality comparison
+         *
+         * \return true The iterators refer to the same cluster
+         ********************************************************************************/
+        [[nodiscard]] bool operator==(const grapheme_iterator& other) const noexcept
+        { return current == other.current; }
+    };
+
+    /********************************************************************************
+     * \brief Range over the grapheme clusters of a string, see \ref Envy::utf8::graphemes()
+     *
+     ********************************************************************************/
+    class grapheme_range final
+    {
+        Envy::string_view str;
+
+    public:
+
+        explicit grapheme_range(const Envy::string_view& s) noexcept : str{s} {}
+
+        [[nodiscard]] grapheme_iterator begin() const noexcept { return {str, str.data()}; }
+        [[nodiscard]] grapheme_iterator end() const noexcept { return {str, str.data() + str.size_bytes()}; }
+    };
+
+    /********************************************************************************
+     * \brief Returns a range over the grapheme clusters of a string
+     *
+     * ```
+     * for(Envy::string_view cluster : Envy::utf8::graphemes("é👩‍👩‍👧"))
+     * { ... } // two clusters
+     * ```
+     *
+     * \param [in] str string to segment, must outlive the range
+     * \return grapheme_range
+     ********************************************************************************/
+    [[nodiscard]] inline grapheme_range graphemes(const Envy::string_view& str) noexcept
+    { return grapheme_range{str}; }
+
+    /********************************************************************************
+     * \brief Counts the grapheme clusters in a string
+     *
+     * \param [in] str string
+     * \return usize number of user perceived characters
+     ********************************************************************************/
+    [[nodiscard]] usize count_graphemes(const Envy::string_view& str) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a byte offset is a grapheme cluster boundary
+     *
+     * The start and end of the string are boundaries, offsets inside a code point
+     * are not.
+     *
+     * \param [in] str string
+     * \param [in] offset byte offset into str
+     ********************************************************************************/
+    [[nodiscard]] bool is_grapheme_boundary(const Envy::string_view& str, usize offset) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the first grapheme cluster boundary after a byte offset
+     *
+     * \param [in] str string
+     * \param [in] offset byte offset into str
+     * \return usize byte offset of the boundary, str.size_bytes() at the end
+     ********************************************************************************/
+    [[nodiscard]] usize next_grapheme_boundary(const Envy::string_view& str, usize offset) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the last grapheme cluster boundary before a byte offset
+     *
+     * \param [in] str string
+     * \param [in] offset byte offset into str
+     * \return usize byte offset of the boundary, 0 at the start
+     ********************************************************************************/
+    [[nodiscard]] usize prev_grapheme_boundary(const Envy::string_view& str, usize offset) noexcept;
+
+    /********************************************************************************
+     * \brief A line break opportunity
+     *
+     ********************************************************************************/
+    class line_break_opportunity final
+    {
+    public:
+
+        usize offset {0};       ///< Byte offset of the first code unit after the break
+        bool mandatory {false}; ///< The line must break here, after a newline or at the end of the string
+    };
+
+    /********************************************************************************
+     * \brief Iterates the line break opportunities of a UTF-8 string
+     *
+     * The end of the string is always reported as a mandatory break, the start
+     * never is. Complex context scripts (Thai, Lao, ...) are not dictionary
+     * segmented, they break as alphabetic text.
+     ********************************************************************************/
+    class line_break_iterator final
+    {
+        const code_unit* first {nullptr};   ///< Start of the string
+        const code_unit* last {nullptr};    ///< End of the string
+        const code_unit* ptr {nullptr};     ///< Next code unit to classify
+
+        line_break_opportunity current {};  ///< Current opportunity, offset is past the end once exhausted
+
+        // pair context, classes are after LB1 and LB9/LB10 are applied
+        line_break prev {line_break::unknown};          ///< Class before the candidate break
+        line_break prev_prev {line_break::unknown};     ///< Class before prev, for LB21a
+        line_break before_spaces {line_break::unknown}; ///< Class before a run of spaces, for LB14 - LB17
+        line_break raw_prev {line_break::unknown};      ///< Class of the previous code point, before LB9
+        u32 regional_indicators {0};        ///< Length of the run of regional indicators ending at prev
+        u8 prev_flags {0};                  ///< Table flags of prev
+        bool start {true};                  ///< No code point has been classified yet
+        bool after_zw {false};              ///< ZW SP* precedes the candidate break
+
+        void advance() noexcept;
+
+    public:
+
+        // member types
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type   = std::ptrdiff_t;
+        using value_type        = line_break_opportunity;
+        using pointer           = const value_type*;
+        using reference         = const value_type&;
+
+        /********************************************************************************
+         * \brief Constructs a null line break iterator, equal to the end of any string
+         *
+         ********************************************************************************/
+        line_break_iterator() = default;
+
+        /********************************************************************************
+         * \brief Constructs a line break iterator to the first opportunity of a string
+         *
+         * \param [in] str string to segment, must outlive the iterator
+         ********************************************************************************/
+        explicit line_break_iterator(const Envy::string_view& str) noexcept;
+
+        /********************************************************************************
+         * \brief Increments iterator to refer to the next break opportunity
+         *
+         * \return line_break_iterator& this
+         ********************************************************************************/
+        line_break_iterator& operator++() noexcept;
+
+        /********************************************************************************
+         * \brief Increments iterator to refer to the next break opportunity
+         *
+         * \return line_break_iterator copy of this
+         ********************************************************************************/
+        line_break_iterator operator++(int) noexcept;
+
+        /********************************************************************************
+         * \brief Returns the current break opportunity
+         *
+         ********************************************************************************/
+        [[nodiscard]] reference operator*() const noexcept { return current; }
+        [[nodiscard]] pointer operator->() const noexcept { return &current; }
+
+        /********************************************************************************
+         * \brief Equality comparison, all exhausted iterators compare equal
+         *
+         ********************************************************************************/
+        [[nodiscard]] bool operator==(const line_break_iterator& other) const noexcept;
+    };
+
+    /********************************************************************************
+     * \brief Range over the line break opportunities of a string, see \ref Envy::utf8::line_breaks()
+     *
+     ********************************************************************************/
+    class line_break_range final
+    {
+        Envy::string_view str;
+
+    public:
+
+        explicit line_break_range(const Envy::string_view& s) noexcept : str{s} {}
+
+        [[nodiscard]] line_break_iterator begin() const noexcept { return line_break_iterator{str}; }
+        [[nodiscard]] line_break_iterator end() const noexcept { return {}; }
+    };
+
+    /********************************************************************************
+     * \brief Returns a range over the line break opportunities of a string
+     *
+     * ```
+     * usize line_start {0};
+     * for(auto opportunity : Envy::utf8::line_breaks(paragraph))
+     * { ... } // wrap at the last opportunity that fits
+     * ```
+     *
+     * \param [in] str string to segment, must outlive the range
+     * \return line_break_range
+     ********************************************************************************/
+    [[nodiscard]] inline line_break_range line_breaks(const Envy::string_view& str) noexcept
+    { return line_break_range{str}; }
+}
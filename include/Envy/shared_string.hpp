@@ -0,0 +1,182 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+/********************************************************************************
+ * \file shared_string.hpp
+ * \brief Immutable, reference counted strings that are cheap to copy across threads
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "utf8.hpp"
+#include "string_view.hpp"
+
+#include <atomic>
+#include <functional>
+#include <memory_resource>
+#include <string_view>
+#include <utility>
+
+namespace Envy
+{
+    namespace detail
+    {
+        // allocated together with the text, the null-terminated code units follow the header
+        struct shared_string_header
+        {
+            std::atomic<usize> refs;
+            usize size;
+            std::pmr::memory_resource* resource;
+            bool ascii;
+
+            [[nodiscard]] const utf8::code_unit* data() const noexcept
+            { return reinterpret_cast<const utf8::code_unit*>(this + 1); }
+        };
+    }
+
+
+    /********************************************************************************
+     * \brief Immutable string with shared, reference counted storage
+     *
+     * The text and its reference count live in a single allocation. Copies share
+     * it and only touch the atomic count, so a shared_string can be handed to
+     * another thread or stored without copying the text. The text is never
+     * modified after construction, so concurrent reads need no locking.
+     *
+     * ```cpp
+     * const Envy::shared_string path {asset.name()};
+     * loader.post([path]{ load(path); }); // no deep copy
+     * ```
+     ********************************************************************************/
+    class shared_string final
+    {
+        detail::shared_string_header* header {nullptr}; ///< nullptr for the empty string
+
+        void release() noexcept;
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs an empty string, does not allocate
+         ********************************************************************************/
+        shared_string() noexcept = default;
+
+
+        /********************************************************************************
+         * \brief Copies *str* into new shared storage
+         *
+         * \param [in] str Text to copy, empty text does not allocate
+         * \param [in] resource Memory resource to allocate from, must be usable from
+         *                      whichever thread releases the last copy
+         ********************************************************************************/
+        explicit shared_string(Envy::string_view str, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+
+        shared_string(const shared_string& other) noexcept :
+            header {other.header}
+        {
+            if(header != nullptr)
+            { header->refs.fetch_add(1u, std::memory_order_relaxed); }
+        }
+
+
+        shared_string(shared_string&& other) noexcept :
+            header {std::exchange(other.header, nullptr)}
+        { }
+
+
+        shared_string& operator=(const shared_string& other) noexcept
+        {
+            shared_string copy {other};
+            std::swap(header, copy.header);
+            return *this;
+        }
+
+
+        shared_string& operator=(shared_string&& other) noexcept
+        {
+            shared_string moved {std::move(other)};
+            std::swap(header, moved.header);
+            return *this;
+        }
+
+
+        ~shared_string()
+        { release(); }
+
+
+        [[nodiscard]] const utf8::code_unit* data() const noexcept
+        { return header ? header->data() : reinterpret_cast<const utf8::code_unit*>(""); }
+
+        [[nodiscard]] const char* c_str() const noexcept
+        { return reinterpret_cast<const char*>(data()); }
+
+        [[nodiscard]] usize size_bytes() const noexcept
+        { return header ? header->size : 0u; }
+
+        [[nodiscard]] bool empty() const noexcept
+        { return header == nullptr; }
+
+        [[nodiscard]] bool is_ascii() const noexcept
+        { return header ? header->ascii : true; }
+
+        [[nodiscard]] Envy::string_view view() const noexcept
+        { return Envy::string_view {data(), size_bytes()}; }
+
+        operator Envy::string_view() const noexcept
+        { return view(); }
+
+
+        /********************************************************************************
+         * \brief Returns the number of shared_strings sharing this storage, 0 if empty
+         *
+         * Only a hint when other threads hold copies.
+         ********************************************************************************/
+        [[nodiscard]] usize use_count() const noexcept
+        { return header ? header->refs.load(std::memory_order_relaxed) : 0u; }
+
+
+        [[nodiscard]] bool operator==(const shared_string& other) const noexcept
+        { return header == other.header || view() == other.view(); }
+
+        [[nodiscard]] bool operator==(const Envy::string_view& sv) const noexcept
+        { return view() == sv; }
+    };
+}
+
+
+namespace std
+{
+    template <>
+    struct hash<Envy::shared_string>
+    {
+        std::size_t operator()(const Envy::shared_string& s) const noexcept
+        {
+            return std::hash<std::basic_string_view<Envy::utf8::code_unit>>{}( { s.data() , s.size_bytes() } );
+        }
+    };
+}
@@ -45,13 +45,44 @@
 #include <type_traits>
 #include <ostream>
 #include <filesystem>
+#include <vector>
+#include <memory_resource>
+#include <cstring>
+#include <concepts>
+#include <utility>
+#include <iterator>
+#include <charconv>
+#include <system_error>
 
 namespace Envy
 {
+    class string;
     class string_view;
 
+    template <typename L, typename R>
+    class string_concat;
+
+    namespace utf8
+    {
+        [[nodiscard]] Envy::string sanitize(const_buffer from);
+    }
+
     /********************************************************************************
      * \brief UTF-8 String class
+     *
+     * Strings of up to local_capacity - 1 bytes are stored inline without
+     * allocating, longer strings move to the heap.
+     *
+     * Heap storage comes from a std::pmr::memory_resource, the default resource
+     * unless one is given on construction. Like the std::pmr containers a copy
+     * uses the default resource, a move keeps the source's.
+     *
+     * Access by code point index on a string that is not all ascii allocates a
+     * side index of byte offsets on first use and extends it on later calls. The
+     * const accessors that do so (at(), iterator_at(), view(), substr()) therefore
+     * modify the string, and like any write they must not run concurrently with
+     * other access from another thread.
+     *
      * \see Envy::string_view
      ********************************************************************************/
     class string final
@@ -59,7 +90,7 @@ namespace Envy
 
         struct size_tag_t {};
         static constexpr size_tag_t size_tag {};
-        string(size_tag_t, usize bytes);
+        string(size_tag_t, usize bytes, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     public:
 
@@ -78,15 +109,38 @@ namespace Envy
         static constexpr usize npos { (usize) -1 };
 
 
+        /********************************************************************************
+         * \brief Bytes stored inline before a string allocates, including the null-terminator
+         ********************************************************************************/
+        static constexpr usize local_capacity { 24u };
+
+
     private: // Member data
 
 
+        std::pmr::memory_resource* resource; ///< Where heap storage is allocated from
+
         usize buffer_size;       ///< Size of buffer in bytes
-        usize buffer_capacity;   ///< Capacity of buffer in bytes
-        utf8::code_unit* buffer; ///< Pointer to buffer of UTF-8 code units
+        utf8::code_unit* buffer; ///< Pointer to buffer of UTF-8 code units, local_buffer for short strings
 
         mutable usize code_point_count {npos}; ///< Cached size of string in code points
 
+        struct offset_index;
+
+        // short strings have no use for a capacity or an index, so the inline storage takes their place
+        union
+        {
+            struct
+            {
+                usize capacity;                ///< Capacity of the heap buffer in bytes
+                mutable offset_index* offsets; ///< Sampled byte offsets of code points, null until the first access by index
+            } heap;
+
+            utf8::code_unit local_buffer[local_capacity]; ///< Inline storage used while the string fits
+        };
+
+        bool ascii {true}; ///< True if every code unit is ascii, code point indices are then byte offsets
+
 
     public: // Interface
 
@@ -97,20 +151,30 @@ namespace Envy
         string();
 
 
+        /********************************************************************************
+         * \brief Constructs an empty string allocating from a memory resource
+         *
+         * \param [in] resource memory resource, must outlive the string
+         ********************************************************************************/
+        explicit string(std::pmr::memory_resource* resource) noexcept;
+
+
         /********************************************************************************
          * \brief Constructs an empty string, reserving a given number of bytes
          *
          * \param [in] bytes Number of bytes to reserve
+         * \param [in] resource memory resource, must outlive the string
          ********************************************************************************/
-        string(reserve_tag_t, usize bytes);
+        string(reserve_tag_t, usize bytes, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
 
         /********************************************************************************
          * \brief Constructs a string from a c string
          *
          * \param [in] cstr c string
+         * \param [in] resource memory resource, must outlive the string
          ********************************************************************************/
-        string(const char* cstr);
+        string(const char* cstr, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
 
         /********************************************************************************
@@ -138,6 +202,15 @@ namespace Envy
         string(const string& from);
 
 
+        /********************************************************************************
+         * \brief Copy constructor allocating from a memory resource
+         *
+         * \param [in] from Envy::string to copy from
+         * \param [in] resource memory resource, must outlive the string
+         ********************************************************************************/
+        string(const string& from, std::pmr::memory_resource* resource);
+
+
         /********************************************************************************
          * \brief Move constructor
          *
@@ -158,8 +231,9 @@ namespace Envy
          * \brief Constructs a string from a Envy::string_view implicitly
          *
          * \param [in] from Envy::string_view
+         * \param [in] resource memory resource, must outlive the string
          ********************************************************************************/
-        string(string_view from);
+        string(string_view from, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
 
         /********************************************************************************
@@ -181,10 +255,13 @@ namespace Envy
         /********************************************************************************
          * \brief Move asignment
          *
+         * Like the std::pmr containers, copies when the resources are not equal,
+         * which can throw.
+         *
          * \param [in] from Envy::string to move from
          * \return Envy::string& reference to this
          ********************************************************************************/
-        string& operator=(string&& from) noexcept;
+        string& operator=(string&& from);
 
 
         /********************************************************************************
@@ -306,7 +383,28 @@ namespace Envy
         [[nodiscard]] const char* c_str() const;
 
 
-        // code_point code_point_at(usize i) const;
+        /********************************************************************************
+         * \brief Returns the code point at a given index
+         *
+         * The first access by index builds a sampled index of byte offsets, after which
+         * any code point is found by stepping over at most 63 others. Appending extends
+         * the index rather than rebuilding it. If the index can't be allocated the code
+         * point is found by walking from the start instead.
+         *
+         * \param [in] i Index of the code point, must be less than size()
+         * \return utf8::code_point
+         ********************************************************************************/
+        [[nodiscard]] utf8::code_point at(usize i) const noexcept(!Envy::debug);
+
+
+        /********************************************************************************
+         * \brief Returns an iterator to the code point at a given index
+         *
+         * \param [in] i Index of the code point, size() for end()
+         * \return utf8::iterator
+         * \see Envy::string::at()
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator iterator_at(usize i) const noexcept(!Envy::debug);
 
 
         /********************************************************************************
@@ -337,6 +435,28 @@ namespace Envy
         [[nodiscard]] string_view view_until(utf8::iterator last) const noexcept;
 
 
+        /********************************************************************************
+         * \brief Returns a sub string_view from the string with the code point range [first,last)
+         *
+         * \param [in] first Index of the first code point of the view
+         * \param [in] last Index of one past the last code point of the view
+         * \return Envy::string_view
+         * \see Envy::string::at()
+         ********************************************************************************/
+        [[nodiscard]] string_view view(usize first, usize last) const noexcept(!Envy::debug);
+
+
+        /********************************************************************************
+         * \brief Returns a copy of up to *count* code points starting at index *first*
+         *
+         * \param [in] first Index of the first code point to copy
+         * \param [in] count Number of code points to copy, npos for the rest of the string
+         * \return Envy::string
+         * \see Envy::string::at()
+         ********************************************************************************/
+        [[nodiscard]] string substr(usize first, usize count = npos) const;
+
+
         // string sub(utf8::iterator first, utf8::iterator last) const;
         // string sub(utf8::iterator first, usize count) const;
 
@@ -353,6 +473,15 @@ namespace Envy
         [[nodiscard]] usize size() const noexcept(!Envy::debug);
 
 
+        /********************************************************************************
+         * \brief Returns whether every code point in the string is ascii
+         *
+         * Kept up to date as the string changes, while true size(), at() and
+         * searches work on bytes without decoding.
+         ********************************************************************************/
+        [[nodiscard]] bool is_ascii() const noexcept;
+
+
         /********************************************************************************
          * \brief Returns the cpacity of the string in bytes
          *
@@ -361,6 +490,12 @@ namespace Envy
         [[nodiscard]] usize capacity() const noexcept;
 
 
+        /********************************************************************************
+         * \brief Returns the memory resource heap storage is allocated from
+         ********************************************************************************/
+        [[nodiscard]] std::pmr::memory_resource* get_resource() const noexcept;
+
+
         /********************************************************************************
          * \brief Clears the string
          ********************************************************************************/
@@ -456,29 +591,169 @@ namespace Envy
         string& operator+=(char c);
 
 
-        // iterator insert(utf8::iterator pos, utf8::iterator first, utf8::iterator last);
-        // iterator insert(utf8::iterator pos, utf8::iterator first, usize count);
-        // iterator insert(utf8::iterator pos, string_view str);
+        /********************************************************************************
+         * \brief Appends a concatenation expression, growing the buffer at most once
+         *
+         * \param [in] expr expression built by Envy::operator+(), may view this string
+         ********************************************************************************/
+        template <typename L, typename R>
+        string& operator+=(const string_concat<L, R>& expr);
+
+
+        /********************************************************************************
+         * \brief Inserts a string before a code point
+         *
+         * Invalidates iterators into the string.
+         *
+         * \param [in] pos Iterator into this string to insert before
+         * \param [in] str String to insert, may view this string
+         * \return utf8::iterator to the first inserted code point
+         ********************************************************************************/
+        utf8::iterator insert(utf8::iterator pos, string_view str);
+
+
+        /********************************************************************************
+         * \brief Inserts the code points [first,last) before a code point
+         *
+         * \param [in] pos Iterator into this string to insert before
+         * \param [in] first First code point to insert
+         * \param [in] last One past the last code point to insert
+         * \return utf8::iterator to the first inserted code point
+         ********************************************************************************/
+        utf8::iterator insert(utf8::iterator pos, utf8::iterator first, utf8::iterator last);
+
+
+        /********************************************************************************
+         * \brief Inserts *count* code points starting at *first* before a code point
+         *
+         * \param [in] pos Iterator into this string to insert before
+         * \param [in] first First code point to insert
+         * \param [in] count Number of code points to insert
+         * \return utf8::iterator to the first inserted code point
+         ********************************************************************************/
+        utf8::iterator insert(utf8::iterator pos, utf8::iterator first, usize count);
+
+
+        /********************************************************************************
+         * \brief Removes the code point at *pos*
+         *
+         * Invalidates iterators into the string.
+         *
+         * \param [in] pos Iterator to the code point to remove
+         * \return utf8::iterator to the code point that followed the removed one
+         ********************************************************************************/
+        utf8::iterator remove(utf8::iterator pos);
+
+
+        /********************************************************************************
+         * \brief Removes up to *count* code points starting at *first*
+         *
+         * \param [in] first First code point to remove
+         * \param [in] count Number of code points to remove
+         * \return utf8::iterator to the code point that followed the removed ones
+         ********************************************************************************/
+        utf8::iterator remove(utf8::iterator first, usize count);
+
+
+        /********************************************************************************
+         * \brief Removes the code points [first,last)
+         *
+         * \param [in] first First code point to remove
+         * \param [in] last One past the last code point to remove
+         * \return utf8::iterator to the code point that followed the removed ones
+         ********************************************************************************/
+        utf8::iterator remove(utf8::iterator first, utf8::iterator last);
+
+
+        /********************************************************************************
+         * \brief Finds the first occurrence of a substring
+         *
+         * Searches bytes rather than code points, see \ref Envy::utf8::find_sequence().
+         *
+         * \param [in] sv Substring to find
+         * \return utf8::iterator to the first code point of the match, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the first occurrence of a code point
+         *
+         * \param [in] cp Code point to find
+         * \return utf8::iterator to the code point, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find(utf8::code_point cp) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the last occurrence of a substring
+         *
+         * \param [in] sv Substring to find
+         * \return utf8::iterator to the first code point of the match, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find_last(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the last occurrence of a code point
+         *
+         * \param [in] cp Code point to find
+         * \return utf8::iterator to the code point, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find_last(utf8::code_point cp) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Replaces every occurrence of a substring
+         *
+         * Counts the matches first, so the result is written with at most one allocation,
+         * and in place when the replacement is no longer than the target.
+         *
+         * \param [in] target Substring to replace, may view this string
+         * \param [in] replacement String to replace it with, may view this string
+         * \return i32 Number of replacements made
+         ********************************************************************************/
+        i32 replace(string_view target, string_view replacement);
 
-        // iterator remove(utf8::iterator pos);
-        // iterator remove(utf8::iterator first, usize count);
-        // iterator remove(utf8::iterator first, utf8::iterator last);
 
-        // [[nodiscard]] iterator find(string_view s);
-        // [[nodiscard]] iterator find(char c);
-        // [[nodiscard]] iterator find(code_point cp);
+        /********************************************************************************
+         * \brief Replaces the code points [first,last)
+         *
+         * \param [in] first First code point to replace
+         * \param [in] last One past the last code point to replace
+         * \param [in] replacement String to replace them with
+         * \return utf8::iterator to the code point following the replacement
+         ********************************************************************************/
+        utf8::iterator replace(utf8::iterator first, utf8::iterator last, string_view replacement);
 
-        // [[nodiscard]] iterator find_last(string_view s);
-        // [[nodiscard]] iterator find_last(char c);
-        // [[nodiscard]] iterator find_last(code_point cp);
 
-        // i32 replace(string_view target, string_view replacement);
-        // i32 replace(utf8::iterator first, utf8::iterator last, string_view replacement);
-        // i32 replace(utf8::iterator first, usize count, string_view replacement);
+        /********************************************************************************
+         * \brief Replaces up to *count* code points starting at *first*
+         *
+         * \param [in] first First code point to replace
+         * \param [in] count Number of code points to replace
+         * \param [in] replacement String to replace them with
+         * \return utf8::iterator to the code point following the replacement
+         ********************************************************************************/
+        utf8::iterator replace(utf8::iterator first, usize count, string_view replacement);
 
-        // [[nodiscard]] i32 count(string_view sv) const;
-        // [[nodiscard]] i32 count(char c) const;
-        // [[nodiscard]] i32 count(code_point cp) const;
+
+        /********************************************************************************
+         * \brief Counts the non-overlapping occurrences of a substring
+         *
+         * \param [in] sv Substring to count
+         * \return i32 Number of occurrences, 0 for an empty substring
+         ********************************************************************************/
+        [[nodiscard]] i32 count(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Counts the occurrences of a code point
+         *
+         * \param [in] cp Code point to count
+         * \return i32 Number of occurrences
+         ********************************************************************************/
+        [[nodiscard]] i32 count(utf8::code_point cp) const noexcept;
 
 
         /********************************************************************************
@@ -505,7 +780,7 @@ namespace Envy
          * \param [in] sv Characters to search for
          * \return true if any character in *sv* is found in the string
          ********************************************************************************/
-        [[nodiscard]] bool contains_any(string_view sv) const noexcept;
+        [[nodiscard]] bool contains_any(string_view sv) const;
 
 
         /********************************************************************************
@@ -514,7 +789,7 @@ namespace Envy
          * \param [in] sv Characters to search for
          * \return true if all characters in *sv* were found in the string
          ********************************************************************************/
-        [[nodiscard]] bool contains_all(string_view sv) const noexcept;
+        [[nodiscard]] bool contains_all(string_view sv) const;
 
 
         /********************************************************************************
@@ -523,13 +798,66 @@ namespace Envy
          * \param [in] sv Characters to search for
          * \return true if all characters in the string were found in *sv*
          ********************************************************************************/
-        [[nodiscard]] bool contains_only(string_view sv) const noexcept;
+        [[nodiscard]] bool contains_only(string_view sv) const;
+
+
+        /********************************************************************************
+         * \brief Equality compares two strings under simple case folding
+         *
+         * \param [in] sv string to compare against
+         * \return true if the strings are equal ignoring case
+         ********************************************************************************/
+        [[nodiscard]] bool equals_ignore_case(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Orders two strings by code point under simple case folding
+         *
+         * \param [in] sv string to compare against
+         * \return std::weak_ordering
+         ********************************************************************************/
+        [[nodiscard]] std::weak_ordering compare_ignore_case(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Hashes the case folded string, consistent with equals_ignore_case()
+         ********************************************************************************/
+        [[nodiscard]] usize hash_ignore_case() const noexcept;
+
+
+        /********************************************************************************
+         * \brief Returns a copy of the string with simple case folding applied
+         *
+         * \return Envy::string
+         ********************************************************************************/
+        [[nodiscard]] string fold_case() const;
+
+
+        /********************************************************************************
+         * \brief Parses the string as a single value without allocating
+         *
+         * \see Envy::string_view::parse_as()
+         ********************************************************************************/
+        template <parsable T>
+        [[nodiscard]] parse_result<T> parse_as() const noexcept
+        {
+            const char* const first {reinterpret_cast<const char*>(buffer)};
+            return detail::parse_whole<T>(first, first + buffer_size);
+        }
+
+
+        /********************************************************************************
+         * \brief Parses whitespace separated values into a span without allocating
+         *
+         * \see Envy::string_view::parse_list()
+         ********************************************************************************/
+        template <parsable T>
+        [[nodiscard]] parse_result<usize> parse_list(std::span<T> out) const noexcept
+        {
+            const char* const first {reinterpret_cast<const char*>(buffer)};
+            return detail::parse_list(first, first + buffer_size, out.data(), out.size());
+        }
 
-        // template <typename T>
-        // T parse_as()
-        // {
-        //     // ...
-        // }
 
         /********************************************************************************
          * \brief Equality compares two strings
@@ -539,24 +867,390 @@ namespace Envy
         [[nodiscard]] bool operator==(const Envy::string&) const noexcept;
 
 
-        friend Envy::string operator+(Envy::string,Envy::string);
         friend std::ostream& operator<<(std::ostream&,Envy::string);
+        friend class string_view;
+        friend class string_builder;
+        friend class string_appender;
+
+        template <typename L, typename R>
+        friend class string_concat;
+
+        friend Envy::string utf8::sanitize(const_buffer from);
 
     private:
 
         [[nodiscard]] usize new_capacity(usize required_size) noexcept;
         void adjust_buffer(usize required_size);
+        void discard_to_fit(usize required_size);
+
+        void allocate(usize required_size);
+        void release() noexcept;
+        void steal(string& from) noexcept;
+        [[nodiscard]] bool is_local() const noexcept;
+
+        [[nodiscard]] usize byte_offset(usize index) const noexcept(!Envy::debug);
+        [[nodiscard]] bool update_index() const noexcept;
+        void reset_index() const noexcept;
+
+        utf8::iterator splice(usize offset, usize erase_bytes, string_view insert);
     };
 
 
     static_assert(std::ranges::range<string>);
     static_assert(std::ranges::bidirectional_range<string>);
+    static_assert(sizeof(string) <= 64u, "Envy::string should stay within a cache line");
 
 
-    Envy::string operator+(Envy::string,Envy::string);
     std::ostream& operator<<(std::ostream&,Envy::string);
 
 
+    namespace detail
+    {
+        // operand held by reference, the viewed text must outlive the expression
+        struct concat_view
+        {
+            Envy::string_view text;
+
+            [[nodiscard]] usize size_bytes() const noexcept
+            { return text.size_bytes(); }
+
+            [[nodiscard]] bool overlaps(const utf8::code_unit* first, const utf8::code_unit* last) const noexcept
+            { return text.data() < last && first < text.data() + text.size_bytes(); }
+
+            utf8::code_unit* write(utf8::code_unit* out) const noexcept
+            {
+                if(text.size_bytes() > 0u)
+                { std::memcpy(out, text.data(), text.size_bytes()); }
+                return out + text.size_bytes();
+            }
+        };
+
+
+        // temporaries are moved into the expression, so it can't outlive them
+        template <typename S>
+        struct concat_owned
+        {
+            S text;
+
+            [[nodiscard]] usize size_bytes() const noexcept
+            { return concat_view {text}.size_bytes(); }
+
+            [[nodiscard]] bool overlaps(const utf8::code_unit*, const utf8::code_unit*) const noexcept
+            { return false; }
+
+            utf8::code_unit* write(utf8::code_unit* out) const noexcept
+            { return concat_view {text}.write(out); }
+        };
+
+
+        struct concat_code_point
+        {
+            utf8::code_unit units[4] {};
+            usize size {};
+
+            explicit concat_code_point(utf8::code_point cp) noexcept :
+                size {static_cast<usize>(utf8::code_units_required(cp))}
+            { utf8::encode(cp, units); }
+
+            [[nodiscard]] usize size_bytes() const noexcept
+            { return size; }
+
+            [[nodiscard]] bool overlaps(const utf8::code_unit*, const utf8::code_unit*) const noexcept
+            { return false; }
+
+            utf8::code_unit* write(utf8::code_unit* out) const noexcept
+            {
+                std::memcpy(out, units, size);
+                return out + size;
+            }
+        };
+
+
+        template <typename T>
+        inline constexpr bool is_string_concat {false};
+
+        template <typename L, typename R>
+        inline constexpr bool is_string_concat<string_concat<L, R>> {true};
+
+
+        // at least one operand must be one of these, so operator+() never claims std::string or pointer arithmetic
+        template <typename T>
+        concept concat_string =
+            std::same_as<std::remove_cvref_t<T>, Envy::string> ||
+            std::same_as<std::remove_cvref_t<T>, Envy::string_view> ||
+            is_string_concat<std::remove_cvref_t<T>>;
+
+        template <typename T>
+        concept concat_operand =
+            concat_string<T> ||
+            std::same_as<std::remove_cvref_t<T>, utf8::code_point> ||
+            std::same_as<std::remove_cvref_t<T>, char> ||
+            std::same_as<std::remove_cvref_t<T>, std::string> ||
+            std::same_as<std::remove_cvref_t<T>, std::string_view> ||
+            std::convertible_to<T, const char*>;
+
+
+        template <concat_operand T>
+        [[nodiscard]] auto make_concat_operand(T&& operand)
+        {
+            using D = std::remove_cvref_t<T>;
+
+            if constexpr(is_string_concat<D>)
+            { return D {std::forward<T>(operand)}; }
+            else if constexpr((std::same_as<D, Envy::string> || std::same_as<D, std::string>) && !std::is_lvalue_reference_v<T>)
+            { return concat_owned<D> {std::move(operand)}; }
+            else if constexpr(std::same_as<D, utf8::code_point> || std::same_as<D, char>)
+            { return concat_code_point {utf8::code_point {operand}}; }
+            else
+            { return concat_view {Envy::string_view {operand}}; }
+        }
+    }
+
+
+    /********************************************************************************
+     * \brief A chain of strings joined with operator+(), not yet written anywhere
+     *
+     * Each operator+() records its operands instead of allocating a result. When the
+     * expression is converted to an Envy::string the total size is measured, one
+     * buffer is allocated and every operand is written once.
+     *
+     * Lvalue strings, views and literals are held by reference, temporary strings
+     * are moved into the expression. Convert the expression in the statement that
+     * builds it rather than storing it with auto.
+     *
+     * ```cpp
+     * Envy::string line = "\n" + color_str(c) + preamble + indent; // one allocation
+     * ```
+     ********************************************************************************/
+    template <typename L, typename R>
+    class string_concat final
+    {
+        L left;
+        R right;
+
+    public:
+
+        string_concat(L left, R right) noexcept :
+            left {std::move(left)},
+            right {std::move(right)}
+        { }
+
+
+        /********************************************************************************
+         * \brief Returns the size of the joined text in bytes
+         ********************************************************************************/
+        [[nodiscard]] usize size_bytes() const noexcept
+        { return left.size_bytes() + right.size_bytes(); }
+
+
+        /********************************************************************************
+         * \brief Determines if any operand views text in [first, last)
+         ********************************************************************************/
+        [[nodiscard]] bool overlaps(const utf8::code_unit* first, const utf8::code_unit* last) const noexcept
+        { return left.overlaps(first, last) || right.overlaps(first, last); }
+
+
+        /********************************************************************************
+         * \brief Writes the joined text to *out*, which must have room for size_bytes()
+         *
+         * \return utf8::code_unit* one past the last unit written
+         ********************************************************************************/
+        utf8::code_unit* write(utf8::code_unit* out) const noexcept
+        { return right.write(left.write(out)); }
+
+
+        /********************************************************************************
+         * \brief Joins the operands into a new string with a single allocation
+         *
+         * \param [in] resource Memory resource for the result
+         ********************************************************************************/
+        [[nodiscard]] Envy::string str(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const
+        {
+            Envy::string result {Envy::string::size_tag, size_bytes(), resource};
+
+            write(result.buffer);
+            result.ascii = utf8::is_ascii(result.buffer, result.buffer_size);
+
+            return result;
+        }
+
+
+        operator Envy::string() const
+        { return str(); }
+    };
+
+
+    /********************************************************************************
+     * \brief Concatenates strings, views, literals and code points lazily
+     *
+     * At least one operand must be an Envy::string, Envy::string_view or another
+     * concatenation.
+     *
+     * \return string_concat expression that converts to Envy::string
+     ********************************************************************************/
+    template <detail::concat_operand L, detail::concat_operand R>
+    requires (detail::concat_string<L> || detail::concat_string<R>)
+    [[nodiscard]] auto operator+(L&& left, R&& right)
+    {
+        return string_concat
+        {
+            detail::make_concat_operand(std::forward<L>(left)),
+            detail::make_concat_operand(std::forward<R>(right))
+        };
+    }
+
+
+    //**********************************************************************
+    template <typename L, typename R>
+    string& string::operator+=(const string_concat<L, R>& expr)
+    {
+        // growing could free text the expression views, so join it first
+        if(expr.overlaps(buffer, buffer + buffer_size))
+        { return *this += Envy::string_view {expr.str()}; }
+
+        const usize added {expr.size_bytes()};
+        adjust_buffer(buffer_size + added);
+
+        utf8::code_unit* const first {buffer + buffer_size};
+        expr.write(first);
+
+        ascii = ascii && utf8::is_ascii(first, added);
+
+        if(code_point_count != npos)
+        { code_point_count += static_cast<usize>(utf8::count_code_points(first, added)); }
+
+        buffer_size += added;
+        buffer[buffer_size] = '\0';
+
+        return *this;
+    }
+
+
+    /********************************************************************************
+     * \brief Output iterator appending chars to an Envy::string
+     *
+     * Grows the string geometrically as chars are written. The null-terminator,
+     * ascii flag and code point count are brought up to date by commit(), until then
+     * the string must only be written through this appender and its copies.
+     * \ref Envy::format_to() manages this for you.
+     ********************************************************************************/
+    class string_appender final
+    {
+        Envy::string* str {};
+        usize start {};
+
+    public:
+
+        using iterator_category = std::output_iterator_tag;
+        using value_type        = void;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = void;
+
+
+        string_appender() noexcept = default;
+
+        explicit string_appender(Envy::string& str) noexcept :
+            str {&str},
+            start {str.buffer_size}
+        { }
+
+
+        string_appender& operator=(char c)
+        {
+            // leaves room for the null-terminator written by commit()
+            if(str->buffer_size + 1u >= str->capacity())
+            { str->adjust_buffer(str->buffer_size + 1u); }
+
+            str->buffer[str->buffer_size++] = static_cast<utf8::code_unit>(c);
+            return *this;
+        }
+
+        string_appender& operator*() noexcept { return *this; }
+        string_appender& operator++() noexcept { return *this; }
+        string_appender operator++(int) noexcept { return *this; }
+
+
+        /********************************************************************************
+         * \brief Terminates the string and updates it for the chars appended so far
+         ********************************************************************************/
+        void commit() noexcept
+        {
+            const utf8::code_unit* const first {str->buffer + start};
+            const usize added {str->buffer_size - start};
+
+            str->ascii = str->ascii && utf8::is_ascii(first, added);
+
+            if(str->code_point_count != Envy::string::npos)
+            { str->code_point_count += static_cast<usize>(utf8::count_code_points(first, added)); }
+
+            str->buffer[str->buffer_size] = '\0';
+            start = str->buffer_size;
+        }
+
+
+        /********************************************************************************
+         * \brief Discards the chars appended since the last commit()
+         ********************************************************************************/
+        void rollback() noexcept
+        {
+            str->buffer_size = start;
+            str->buffer[start] = '\0';
+        }
+    };
+
+
+    static_assert(std::output_iterator<string_appender, char>);
+
+
+    /********************************************************************************
+     * \brief Formats arguments onto the end of a string
+     *
+     * Writes straight into the string's buffer, no temporary std::string is made.
+     * If formatting throws the string is left as it was.
+     *
+     * \param [in] out String to append to
+     * \param [in] fmt Format string, see std::format()
+     * \param [in] args Arguments to format
+     * \return Envy::string& *out*
+     ********************************************************************************/
+    template <typename ... Ts>
+    Envy::string& format_to(Envy::string& out, std::string_view fmt, Ts&& ... args)
+    {
+        // the format string is a fair lower bound for the output
+        out.reserve(out.size_bytes() + fmt.size());
+
+        string_appender appender {out};
+
+        try
+        { std::vformat_to(appender, fmt, std::make_format_args(args...)); }
+        catch(...)
+        {
+            appender.rollback();
+            throw;
+        }
+
+        appender.commit();
+        return out;
+    }
+
+
+    namespace utf8
+    {
+        /********************************************************************************
+         * \brief Copies possibly ill-formed UTF-8 to a string, replacing each maximal
+         *        ill-formed subpart with U+FFFD
+         *
+         * Use on untrusted text (file names, user input, mod files) before handing it
+         * to anything expecting valid UTF-8. Valid input is validated once and copied.
+         *
+         * \param [in] from possibly ill-formed UTF-8
+         * \return Envy::string well-formed copy of 'from'
+         ********************************************************************************/
+        [[nodiscard]] Envy::string sanitize(const_buffer from);
+    }
+
+
     class format
     {
         std::string fmt;
@@ -595,6 +1289,156 @@ namespace Envy
         tostring_freefunc<T>;
 
 
+    namespace detail
+    {
+        template <typename T>
+        concept has_formatter = std::default_initializable<std::formatter<std::remove_cvref_t<T>, char>>;
+
+
+        // text already, or text that can be written without allocating
+        template <typename T>
+        concept direct_chars =
+            std::same_as<std::remove_cvref_t<T>, bool>  ||
+            std::same_as<std::remove_cvref_t<T>, char>  ||
+            std::convertible_to<T, std::string_view>    ||
+            std::integral<std::remove_cvref_t<T>>       ||
+            std::floating_point<std::remove_cvref_t<T>>;
+
+
+        // types best written by their std::formatter, straight to the destination
+        template <typename T>
+        concept format_chars = !direct_chars<T> && has_formatter<T>;
+
+
+        /********************************************************************************
+         * \brief Calls *f* with the text of *v* as a std::string_view
+         *
+         * Text is passed as is and numbers are written to the stack with std::to_chars.
+         * Other types go through their to_string() or, as a last resort, a std::stringstream.
+         *
+         * \return Whatever *f* returns
+         ********************************************************************************/
+        template <convertable_to_string T, typename F>
+        decltype(auto) visit_chars(T&& v, F&& f)
+        {
+            using type = std::remove_cvref_t<T>;
+
+            if constexpr (std::same_as<type, bool>)
+            { return f(std::string_view {v ? "true" : "false"}); }
+
+            else if constexpr (std::same_as<type, char>)
+            { return f(std::string_view {&v, 1u}); }
+
+            else if constexpr (std::convertible_to<T, std::string_view>)
+            { return f(static_cast<std::string_view>(v)); }
+
+            else if constexpr (std::integral<type> || std::floating_point<type>)
+            {
+                // enough for the shortest round trip form of any floating point type
+                char buffer[64];
+                const auto r {std::to_chars(buffer, buffer + sizeof buffer, +v)};
+                return f(std::string_view {buffer, static_cast<usize>(r.ptr - buffer)});
+            }
+
+            else if constexpr (std::convertible_to<T, std::string>)
+            { return f(std::string_view {static_cast<std::string>(std::forward<T>(v))}); }
+
+            else if constexpr (numeric<type>)
+            { return f(std::string_view {std::to_string(v)}); }
+
+            else if constexpr (tostring_member<T>)
+            { return f(std::string_view {std::forward<T>(v).to_string()}); }
+
+            else if constexpr (tostring_freefunc<T>)
+            { return f(std::string_view {::to_string(std::forward<T>(v))}); }
+
+            else
+            {
+                std::stringstream ss;
+                ss << std::forward<T>(v);
+                return f(std::string_view {std::move(ss).str()});
+            }
+        }
+    }
+
+
+    /********************************************************************************
+     * \brief Writes the text of a value to a buffer, like std::to_chars()
+     *
+     * Text, bools and numbers never allocate, nor do types with a std::formatter.
+     * Other types fall back on their to_string() and lastly a std::stringstream.
+     *
+     * \param [in] first Start of the buffer
+     * \param [in] last End of the buffer
+     * \param [in] v Value to write
+     * \return std::to_chars_result One past the last char written, or *last* and
+     *         std::errc::value_too_large if the text does not fit
+     ********************************************************************************/
+    template <convertable_to_string T>
+    std::to_chars_result to_chars(char* first, char* last, T&& v)
+    {
+        const usize room {static_cast<usize>(last - first)};
+
+        if constexpr (detail::format_chars<T>)
+        {
+            const auto r {std::format_to_n(first, static_cast<std::ptrdiff_t>(room), "{}", v)};
+
+            if(static_cast<usize>(r.size) > room)
+            { return {last, std::errc::value_too_large}; }
+
+            return {r.out, std::errc {}};
+        }
+        else
+        {
+            return detail::visit_chars(std::forward<T>(v), [&](std::string_view text) -> std::to_chars_result
+            {
+                if(text.size() > room)
+                { return {last, std::errc::value_too_large}; }
+
+                std::memcpy(first, text.data(), text.size());
+                return {first + text.size(), std::errc {}};
+            });
+        }
+    }
+
+
+    /********************************************************************************
+     * \brief Appends the text of a value to a string
+     *
+     * Allocates only if *out* has to grow, for the same types as \ref Envy::to_chars().
+     *
+     * \param [in] out String to append to
+     * \param [in] v Value to append
+     * \return Envy::string& *out*
+     ********************************************************************************/
+    template <convertable_to_string T>
+    Envy::string& append_chars(Envy::string& out, T&& v)
+    {
+        if constexpr (detail::format_chars<T>)
+        { return Envy::format_to(out, "{}", v); }
+        else
+        { return detail::visit_chars(std::forward<T>(v), [&](std::string_view text) -> Envy::string& { return out.append(Envy::string_view {text}); }); }
+    }
+
+
+    namespace detail
+    {
+        // passes arguments std::format can take through, anything else is converted with Envy::append_chars()
+        template <convertable_to_string T>
+        decltype(auto) format_arg(T&& v)
+        {
+            if constexpr (has_formatter<T>)
+            { return std::forward<T>(v); }
+            else
+            {
+                Envy::string text;
+                append_chars(text, std::forward<T>(v));
+                return text;
+            }
+        }
+    }
+
+
     template <convertable_to_string T>
     [[nodiscard]] std::string to_string(T&& v)
     {
@@ -610,6 +1454,9 @@ namespace Envy
         else if constexpr (std::convertible_to<T,std::string>)
         { return (std::string) std::forward<T>(v); }
 
+        else if constexpr (std::integral<std::remove_cvref_t<T>> || std::floating_point<std::remove_cvref_t<T>>)
+        { return detail::visit_chars(v, [](std::string_view text) { return std::string {text}; }); }
+
         else if constexpr (numeric<std::remove_cvref_t<T>>)
         { return std::to_string(v); }
 
@@ -644,4 +1491,14 @@ namespace std
             return std::hash<std::basic_string_view<Envy::utf8::code_unit>>{}( { s.data() , s.size_bytes() } );
         }
     };
-}
\ No newline at end of file
+
+
+    // accepts the same format spec as std::string_view
+    template <>
+    struct formatter<Envy::string, char> : formatter<Envy::string_view, char>
+    {
+        template <typename FormatContext>
+        auto format(const Envy::string& s, FormatContext& ctx) const
+        { return formatter<Envy::string_view, char>::format(Envy::string_view {s}, ctx); }
+    };
+}
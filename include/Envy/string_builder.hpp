@@ -0,0 +1,188 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file string_builder.hpp
+ * \brief Joins many pieces of text into a string with a single allocation
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "utf8.hpp"
+#include "string.hpp"
+#include "buffers.hpp"
+
+#include <array>
+#include <format>
+#include <iterator>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Envy
+{
+    /********************************************************************************
+     * \brief Records pieces of text and joins them once
+     *
+     * Views, c strings and lvalue strings are recorded by reference and must outlive
+     * the builder. Temporaries, code points, characters and formatted values are
+     * copied into storage owned by the builder. The final size is known up front,
+     * so materializing allocates exactly once.
+     *
+     * ```cpp
+     * Envy::string_builder b;
+     * b.append(name).append(": ").append_format("{:.2f}", value).append('\n');
+     * Envy::string line {b.str()};
+     * ```
+     ********************************************************************************/
+    class string_builder final
+    {
+    public:
+
+        static constexpr usize local_pieces {16u}; ///< Pieces recorded before the list spills to the heap
+
+    private:
+
+        // data == nullptr means the text is owned, stored at 'offset' in 'owned'
+        struct piece
+        {
+            const utf8::code_unit* data;
+            usize offset;
+            usize size;
+        };
+
+        std::pmr::memory_resource* resource;
+        std::array<piece, local_pieces> local;
+        std::pmr::vector<piece> spilled {resource};
+        std::pmr::string owned {resource};
+        usize piece_count {};
+        usize total_bytes {};
+
+        string_builder& push_view(const utf8::code_unit* data, usize size);
+        string_builder& push_owned(usize offset);
+        [[nodiscard]] std::span<const piece> pieces() const noexcept;
+        void write(utf8::code_unit* out) const noexcept;
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs an empty builder
+         *
+         * \param [in] resource Memory resource for owned text, spilled pieces and the
+         *                      default for the result of str()
+         ********************************************************************************/
+        explicit string_builder(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept;
+
+
+        /********************************************************************************
+         * \brief Records a view, the viewed text must outlive the builder
+         ********************************************************************************/
+        string_builder& append(Envy::string_view str);
+        string_builder& append(const char* cstr);
+        string_builder& append(const Envy::string& str);
+        string_builder& append(const std::string& str);
+
+
+        /********************************************************************************
+         * \brief Copies a temporary string into the builder
+         ********************************************************************************/
+        string_builder& append(Envy::string&& str);
+        string_builder& append(std::string&& str);
+
+
+        /********************************************************************************
+         * \brief Copies a code point, encoded as UTF-8, into the builder
+         ********************************************************************************/
+        string_builder& append(utf8::code_point cp);
+
+
+        /********************************************************************************
+         * \brief Copies a character into the builder
+         ********************************************************************************/
+        string_builder& append(char c);
+
+
+        /********************************************************************************
+         * \brief Formats values with std::format() directly into the builder
+         *
+         * \param [in] fmt std::format() format string
+         * \param [in] args values to format
+         ********************************************************************************/
+        template <typename ... Ts>
+        string_builder& append_format(std::string_view fmt, Ts&& ... args)
+        {
+            const usize offset {owned.size()};
+            std::vformat_to(std::back_inserter(owned), fmt, std::make_format_args(args...));
+            return push_owned(offset);
+        }
+
+
+        /********************************************************************************
+         * \brief Returns the size in bytes of the joined string
+         ********************************************************************************/
+        [[nodiscard]] usize size_bytes() const noexcept;
+
+
+        [[nodiscard]] bool empty() const noexcept;
+
+
+        /********************************************************************************
+         * \brief Forgets all pieces, keeps storage for reuse
+         ********************************************************************************/
+        void clear() noexcept;
+
+
+        /********************************************************************************
+         * \brief Joins the pieces into a new string
+         *
+         * \param [in] resource Memory resource for the result
+         * \return Envy::string allocated exactly once
+         ********************************************************************************/
+        [[nodiscard]] Envy::string str() const;
+        [[nodiscard]] Envy::string str(std::pmr::memory_resource* resource) const;
+
+
+        /********************************************************************************
+         * \brief Appends the joined pieces to a string, growing it at most once
+         *
+         * \param [in] to string to append to
+         ********************************************************************************/
+        void append_to(Envy::string& to) const;
+
+
+        /********************************************************************************
+         * \brief Writes the joined pieces into a buffer, not null-terminated
+         *
+         * \param [in] to buffer to write to
+         * \return usize bytes written, 0 with nothing written if 'to' is smaller than size_bytes()
+         ********************************************************************************/
+        usize copy_to(mutable_buffer to) const noexcept;
+    };
+}
@@ -0,0 +1,190 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file string_id.hpp
+ * \brief Interned strings with constant time equality and a precomputed hash
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "string_view.hpp"
+
+#include <optional>
+#include <functional>
+
+namespace Envy
+{
+    namespace detail
+    {
+        // FNV-1a, used for every interned string so literals can be hashed at compile time
+        [[nodiscard]] constexpr usize hash_string_id(const char* data, usize size) noexcept
+        {
+            u64 hash {14695981039346656037ull};
+
+            for(usize i {}; i < size; ++i)
+            {
+                hash ^= static_cast<u8>(data[i]);
+                hash *= 1099511628211ull;
+            }
+
+            return static_cast<usize>(hash);
+        }
+
+
+        // one entry per distinct string in the intern pool, never moved or freed
+        struct string_id_entry
+        {
+            usize hash;
+            usize size;
+            const char* data; ///< null-terminated
+        };
+
+
+        inline constexpr string_id_entry empty_string_id_entry {hash_string_id("", 0u), 0u, ""};
+    }
+
+
+    /********************************************************************************
+     * \brief Handle to a string in the global intern pool
+     *
+     * Interning a string returns the same handle for every string with the same
+     * bytes, so equality is a pointer compare and the hash is computed once.
+     * Interned strings live until the program exits, intern names, not arbitrary
+     * user text. The pool is thread safe, handles are plain values.
+     *
+     * ```cpp
+     * Envy::string_id a {Envy::string_view{"severity"}};
+     * Envy::string_id b {"severity"_id};  // hashed at compile time
+     * a == b;  // true
+     * ```
+     ********************************************************************************/
+    class string_id final
+    {
+        const detail::string_id_entry* entry {&detail::empty_string_id_entry};
+
+        explicit constexpr string_id(const detail::string_id_entry* e) noexcept : entry {e} {}
+
+    public:
+
+        /********************************************************************************
+         * \brief A string literal and its hash, computed at compile time
+         *
+         * Produced by the _id literal. Interning a literal skips hashing and does not
+         * copy the text, the pool points straight at the literal.
+         ********************************************************************************/
+        struct literal
+        {
+            const char* data;
+            usize size;
+            usize hash;
+
+            consteval literal(const char* d, usize s) noexcept :
+                data {d}, size {s}, hash {detail::hash_string_id(d,s)} {}
+        };
+
+
+        /********************************************************************************
+         * \brief Constructs the id of the empty string, does not touch the pool
+         ********************************************************************************/
+        constexpr string_id() noexcept = default;
+
+
+        /********************************************************************************
+         * \brief Interns a string
+         *
+         * \param [in] str String to intern, copied into the pool if not already there
+         ********************************************************************************/
+        explicit string_id(Envy::string_view str);
+
+
+        /********************************************************************************
+         * \brief Interns a string literal with a precomputed hash
+         *
+         * \param [in] lit Literal produced by the _id literal
+         ********************************************************************************/
+        string_id(literal lit);
+
+
+        /********************************************************************************
+         * \brief Returns the id of a string only if it is already interned
+         *
+         * Does not grow the pool, so it is safe to call with arbitrary input.
+         *
+         * \param [in] str String to look up
+         * \return std::optional<string_id> empty if the string was never interned
+         ********************************************************************************/
+        [[nodiscard]] static std::optional<string_id> find(Envy::string_view str);
+
+
+        /********************************************************************************
+         * \brief Returns the number of distinct strings in the pool
+         ********************************************************************************/
+        [[nodiscard]] static usize pool_size();
+
+
+        [[nodiscard]] constexpr usize hash() const noexcept        { return entry->hash; }
+        [[nodiscard]] constexpr usize size_bytes() const noexcept  { return entry->size; }
+        [[nodiscard]] constexpr bool empty() const noexcept        { return entry->size == 0u; }
+        [[nodiscard]] constexpr const char* c_str() const noexcept { return entry->data; }
+
+        [[nodiscard]] Envy::string_view view() const noexcept
+        { return Envy::string_view {entry->data, entry->size}; }
+
+        operator Envy::string_view() const noexcept
+        { return view(); }
+
+
+        /********************************************************************************
+         * \brief Returns a value unique to this string for the life of the program
+         *
+         * Suitable as a key where a plain integer is needed, e.g. Envy::event_type.
+         ********************************************************************************/
+        [[nodiscard]] usize value() const noexcept
+        { return reinterpret_cast<usize>(entry); }
+
+
+        [[nodiscard]] constexpr bool operator==(const string_id&) const noexcept = default;
+    };
+}
+
+
+[[nodiscard]] consteval Envy::string_id::literal operator ""_id (const char* str, std::size_t len)
+{ return Envy::string_id::literal {str, len}; }
+
+
+// Hash support for Envy::string_id
+namespace std
+{
+    template <>
+    struct hash<Envy::string_id>
+    {
+        std::size_t operator()(const Envy::string_id& id) const noexcept
+        { return id.hash(); }
+    };
+}
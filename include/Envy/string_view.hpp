@@ -29,10 +29,14 @@
 
 #include "common.hpp"
 #include "utf8.hpp"
+#include "parse.hpp"
 
 #include <string>
 #include <string_view>
 #include <filesystem>
+#include <compare>
+#include <format>
+#include <span>
 
 
 namespace Envy
@@ -47,7 +51,7 @@ namespace Envy
         usize size_{0};
         const utf8::code_unit* ptr_{nullptr};
 
-        mutable usize code_point_count;
+        mutable usize code_point_count {(usize) -1};
 
     public:
 
@@ -219,6 +223,15 @@ namespace Envy
         [[nodiscard]] usize size() const noexcept(!Envy::debug);
 
 
+        /********************************************************************************
+         * \brief Returns whether every code point in the view is ascii
+         *
+         * Known without scanning for views of an ascii Envy::string, otherwise
+         * computed along with size().
+         ********************************************************************************/
+        [[nodiscard]] bool is_ascii() const noexcept(!Envy::debug);
+
+
         /********************************************************************************
          * \brief Returns the first character in the view
          ********************************************************************************/
@@ -259,6 +272,62 @@ namespace Envy
         [[nodiscard]] string_view view_until(utf8::iterator last) const noexcept;
 
 
+        /********************************************************************************
+         * \brief Finds the first occurrence of a substring
+         *
+         * Searches bytes rather than code points, see \ref Envy::utf8::find_sequence().
+         *
+         * \param [in] sv Substring to find
+         * \return utf8::iterator to the first code point of the match, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the first occurrence of a code point
+         *
+         * \param [in] cp Code point to find
+         * \return utf8::iterator to the code point, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find(utf8::code_point cp) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the last occurrence of a substring
+         *
+         * \param [in] sv Substring to find
+         * \return utf8::iterator to the first code point of the match, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find_last(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Finds the last occurrence of a code point
+         *
+         * \param [in] cp Code point to find
+         * \return utf8::iterator to the code point, end() if not found
+         ********************************************************************************/
+        [[nodiscard]] utf8::iterator find_last(utf8::code_point cp) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Counts the non-overlapping occurrences of a substring
+         *
+         * \param [in] sv Substring to count
+         * \return i32 Number of occurrences, 0 for an empty substring
+         ********************************************************************************/
+        [[nodiscard]] i32 count(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Counts the occurrences of a code point
+         *
+         * \param [in] cp Code point to count
+         * \return i32 Number of occurrences
+         ********************************************************************************/
+        [[nodiscard]] i32 count(utf8::code_point cp) const noexcept;
+
+
         /********************************************************************************
          * \brief Determines if a string contains a given substring
          *
@@ -283,7 +352,7 @@ namespace Envy
          * \param [in] sv Characters to search for
          * \return true if any character in *sv* is found in the string
          ********************************************************************************/
-        [[nodiscard]] bool contains_any(string_view sv) const noexcept;
+        [[nodiscard]] bool contains_any(string_view sv) const;
 
 
         /********************************************************************************
@@ -292,7 +361,7 @@ namespace Envy
          * \param [in] sv Characters to search for
          * \return true if all characters in *sv* were found in the string
          ********************************************************************************/
-        [[nodiscard]] bool contains_all(string_view sv) const noexcept;
+        [[nodiscard]] bool contains_all(string_view sv) const;
 
 
         /********************************************************************************
@@ -301,7 +370,74 @@ namespace Envy
          * \param [in] sv Characters to search for
          * \return true if all characters in the string were found in *sv*
          ********************************************************************************/
-        [[nodiscard]] bool contains_only(string_view sv) const noexcept;
+        [[nodiscard]] bool contains_only(string_view sv) const;
+
+
+        /********************************************************************************
+         * \brief Equality compares two strings under simple case folding
+         *
+         * \param [in] sv string to compare against
+         * \return true if the strings are equal ignoring case
+         ********************************************************************************/
+        [[nodiscard]] bool equals_ignore_case(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Orders two strings by code point under simple case folding
+         *
+         * \param [in] sv string to compare against
+         * \return std::weak_ordering
+         ********************************************************************************/
+        [[nodiscard]] std::weak_ordering compare_ignore_case(string_view sv) const noexcept;
+
+
+        /********************************************************************************
+         * \brief Hashes the case folded string, consistent with equals_ignore_case()
+         ********************************************************************************/
+        [[nodiscard]] usize hash_ignore_case() const noexcept;
+
+
+        /********************************************************************************
+         * \brief Returns a copy of the string with simple case folding applied
+         *
+         * \return Envy::string
+         ********************************************************************************/
+        [[nodiscard]] Envy::string fold_case() const;
+
+
+        /********************************************************************************
+         * \brief Parses the view as a single value without allocating
+         *
+         * Leading and trailing whitespace is ignored, anything else that is not part
+         * of the value fails with std::errc::invalid_argument.
+         *
+         * \tparam T Integer, floating point or vector2 type, see \ref Envy::parsable
+         * \return parse_result<T> The value, or why parsing failed
+         ********************************************************************************/
+        template <parsable T>
+        [[nodiscard]] parse_result<T> parse_as() const noexcept
+        {
+            const char* const first {reinterpret_cast<const char*>(ptr_)};
+            return detail::parse_whole<T>(first, first + size_);
+        }
+
+
+        /********************************************************************************
+         * \brief Parses whitespace separated values into a span without allocating
+         *
+         * Stops at the first value that fails to parse, or with std::errc::value_too_large
+         * when there are more values than *out* has room for.
+         *
+         * \tparam T Integer, floating point or vector2 type, see \ref Envy::parsable
+         * \param [out] out Destination for the parsed values
+         * \return parse_result<usize> Number of values written to *out*, kept when parsing stops early, and why it stopped
+         ********************************************************************************/
+        template <parsable T>
+        [[nodiscard]] parse_result<usize> parse_list(std::span<T> out) const noexcept
+        {
+            const char* const first {reinterpret_cast<const char*>(ptr_)};
+            return detail::parse_list(first, first + size_, out.data(), out.size());
+        }
 
 
         /********************************************************************************
@@ -313,6 +449,45 @@ namespace Envy
         [[nodiscard]] bool operator==(const Envy::string_view&) const noexcept;
     };
 
+
+    /********************************************************************************
+     * \brief Case insensitive hash for unordered containers of strings
+     *
+     * Pair with \ref Envy::case_insensitive_equal, both are transparent so
+     * lookups by string_view or c string do not construct a key.
+     ********************************************************************************/
+    struct case_insensitive_hash
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] usize operator()(string_view sv) const noexcept
+        { return sv.hash_ignore_case(); }
+    };
+
+
+    /********************************************************************************
+     * \brief Case insensitive equality for unordered containers of strings
+     ********************************************************************************/
+    struct case_insensitive_equal
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] bool operator()(string_view a, string_view b) const noexcept
+        { return a.equals_ignore_case(b); }
+    };
+
+
+    /********************************************************************************
+     * \brief Case insensitive ordering for ordered containers of strings
+     ********************************************************************************/
+    struct case_insensitive_less
+    {
+        using is_transparent = void;
+
+        [[nodiscard]] bool operator()(string_view a, string_view b) const noexcept
+        { return a.compare_ignore_case(b) < 0; }
+    };
+
 }
 
 // Hash support for Envy::string_view
@@ -326,4 +501,35 @@ namespace std
             return std::hash<std::basic_string_view<Envy::utf8::code_unit>>{}( { s.data() , s.size_bytes() } );
         }
     };
-}
\ No newline at end of file
+}
+
+// std::format support for Envy::string_view and Envy::utf8::code_point,
+// both accept the same format spec as std::string_view
+namespace std
+{
+    template <>
+    struct formatter<Envy::string_view, char> : formatter<std::string_view, char>
+    {
+        template <typename FormatContext>
+        auto format(const Envy::string_view& s, FormatContext& ctx) const
+        {
+            return formatter<std::string_view, char>::format(
+                std::string_view {reinterpret_cast<const char*>(s.data()), s.size_bytes()}, ctx);
+        }
+    };
+
+
+    template <>
+    struct formatter<Envy::utf8::code_point, char> : formatter<std::string_view, char>
+    {
+        template <typename FormatContext>
+        auto format(Envy::utf8::code_point cp, FormatContext& ctx) const
+        {
+            Envy::utf8::code_unit units[4];
+            Envy::utf8::encode(cp, units);
+
+            return formatter<std::string_view, char>::format(
+                std::string_view {reinterpret_cast<const char*>(units), static_cast<usize>(Envy::utf8::code_units_required(cp))}, ctx);
+        }
+    };
+}
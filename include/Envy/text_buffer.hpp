@@ -0,0 +1,224 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file text_buffer.hpp
+ * \brief Editable UTF-8 text stored in a gap buffer
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "utf8.hpp"
+#include "string.hpp"
+#include "string_view.hpp"
+
+#include <array>
+#include <memory_resource>
+
+namespace Envy
+{
+    /********************************************************************************
+     * \brief UTF-8 text with cheap edits near a cursor
+     *
+     * The text is kept in one buffer with a gap at the last edit. Inserting or
+     * removing at the gap costs only the text inserted or removed. Editing elsewhere
+     * first moves the gap, copying the text between the old and new position. Typing,
+     * deleting and pasting around a cursor stays cheap however long the text is.
+     *
+     * Positions are byte offsets into the text and must fall on code point
+     * boundaries. Edits shift the offsets after them, the offsets edits return
+     * make a cursor that follows the text.
+     *
+     * ```cpp
+     * Envy::text_buffer field {"Hello world"};
+     * usize cursor {field.insert(5u, ",")};       // "Hello, world"
+     * cursor = field.remove(field.prev(cursor));  // "Hello world"
+     * Envy::string line {field.str()};
+     * ```
+     ********************************************************************************/
+    class text_buffer final
+    {
+    public:
+
+        static constexpr usize min_gap {64u}; ///< Gap left after the buffer grows
+
+    private:
+
+        std::pmr::memory_resource* resource;
+        utf8::code_unit* buffer {};
+        usize buffer_capacity {};
+        usize gap_begin {};
+        usize gap_end {};
+        usize code_point_count {};
+
+        [[nodiscard]] usize gap_size() const noexcept;
+        [[nodiscard]] const utf8::code_unit* unit_at(usize offset) const noexcept;
+        [[nodiscard]] bool overlaps(Envy::string_view text) const noexcept;
+        void release() noexcept;
+        void steal(text_buffer& from) noexcept;
+        void move_gap(usize offset) noexcept;
+        void reserve_gap(usize bytes);
+        void check_offset(usize offset) const noexcept(!Envy::debug);
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs an empty buffer, nothing is allocated until text is inserted
+         *
+         * \param [in] resource memory resource, must outlive the buffer
+         ********************************************************************************/
+        explicit text_buffer(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept;
+
+        /********************************************************************************
+         * \brief Constructs a buffer holding a copy of *text*
+         *
+         * \param [in] text Initial text
+         * \param [in] resource memory resource, must outlive the buffer
+         ********************************************************************************/
+        explicit text_buffer(Envy::string_view text, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+        text_buffer(const text_buffer& other);
+        text_buffer(text_buffer&& other) noexcept;
+        text_buffer& operator=(const text_buffer& other);
+        text_buffer& operator=(text_buffer&& other); ///< Copies when the resources differ, like the std::pmr containers
+        ~text_buffer();
+
+
+        /********************************************************************************
+         * \brief Returns the size of the text in bytes
+         ********************************************************************************/
+        [[nodiscard]] usize size_bytes() const noexcept;
+
+        /********************************************************************************
+         * \brief Returns the size of the text in code points, kept up to date by edits
+         ********************************************************************************/
+        [[nodiscard]] usize size() const noexcept;
+
+        /********************************************************************************
+         * \brief Returns true if the buffer holds no text
+         ********************************************************************************/
+        [[nodiscard]] bool empty() const noexcept;
+
+
+        /********************************************************************************
+         * \brief Returns the offset of the code point after the one at *offset*
+         *
+         * \param [in] offset Position before size_bytes()
+         ********************************************************************************/
+        [[nodiscard]] usize next(usize offset) const noexcept(!Envy::debug);
+
+        /********************************************************************************
+         * \brief Returns the offset of the code point before *offset*
+         *
+         * \param [in] offset Position after 0
+         ********************************************************************************/
+        [[nodiscard]] usize prev(usize offset) const noexcept(!Envy::debug);
+
+        /********************************************************************************
+         * \brief Returns the offset of the code point at *index*, linear in *index*
+         *
+         * \param [in] index Code point index, size() for the end of the text
+         ********************************************************************************/
+        [[nodiscard]] usize offset_of(usize index) const noexcept(!Envy::debug);
+
+        /********************************************************************************
+         * \brief Returns the code point at *offset*
+         ********************************************************************************/
+        [[nodiscard]] utf8::code_point at(usize offset) const noexcept(!Envy::debug);
+
+
+        /********************************************************************************
+         * \brief Inserts text before *offset*
+         *
+         * \param [in] offset Position to insert at
+         * \param [in] text Text to insert, may view this buffer
+         * \return usize Offset one past the inserted text
+         ********************************************************************************/
+        usize insert(usize offset, Envy::string_view text);
+        usize insert(usize offset, const char* text);
+
+        /********************************************************************************
+         * \brief Inserts a code point before *offset*
+         *
+         * \return usize Offset one past the inserted code point
+         ********************************************************************************/
+        usize insert(usize offset, utf8::code_point cp);
+
+        /********************************************************************************
+         * \brief Removes code points starting at *offset*
+         *
+         * \param [in] offset Position of the first code point to remove
+         * \param [in] count Number of code points to remove, stops at the end of the text
+         * \return usize *offset*, now the position of the code point that followed
+         ********************************************************************************/
+        usize remove(usize offset, usize count = 1u) noexcept(!Envy::debug);
+
+        /********************************************************************************
+         * \brief Replaces code points starting at *offset* with *text*
+         *
+         * \param [in] offset Position of the first code point to replace
+         * \param [in] count Number of code points to replace
+         * \param [in] text Replacement text, may view this buffer
+         * \return usize Offset one past the replacement
+         ********************************************************************************/
+        usize replace(usize offset, usize count, Envy::string_view text);
+
+        /********************************************************************************
+         * \brief Removes all text, keeping the allocation
+         ********************************************************************************/
+        void clear() noexcept;
+
+
+        /********************************************************************************
+         * \brief Returns the text as the two views either side of the gap
+         *
+         * Each view is a range of utf8::iterator, neither splits a code point. Views
+         * are invalidated by edits.
+         *
+         * ```cpp
+         * for(Envy::string_view segment : buffer.segments())
+         *     for(utf8::code_point cp : segment) { ... }
+         * ```
+         ********************************************************************************/
+        [[nodiscard]] std::array<Envy::string_view, 2> segments() const noexcept;
+
+        /********************************************************************************
+         * \brief Returns the text as one view, moving the gap to the end
+         *
+         * Invalidated by edits.
+         ********************************************************************************/
+        [[nodiscard]] Envy::string_view view() noexcept;
+
+        /********************************************************************************
+         * \brief Copies the text into a string with a single allocation
+         *
+         * \param [in] resource Memory resource for the result
+         ********************************************************************************/
+        [[nodiscard]] Envy::string str(std::pmr::memory_resource* resource = std::pmr::get_default_resource()) const;
+    };
+}
@@ -0,0 +1,346 @@
+///////////////////////////////////////////////////////////////////////////////////////
+//
+//    Envy Game Engine
+//    https://github.com/PatrickTorgerson/Envy
+//
+//    Copyright (c) 2021 Patrick Torgerson
+//
+//    Permission is hereby granted, free of charge, to any person obtaining a copy
+//    of this software and associated documentation files (the "Software"), to deal
+//    in the Software without restriction, including without limitation the rights
+//    to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+//    copies of the Software, and to permit persons to whom the Software is
+//    furnished to do so, subject to the following conditions:
+//
+//    The above copyright notice and this permission notice shall be included in all
+//    copies or substantial portions of the Software.
+//
+//    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+//    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//    SOFTWARE.
+//
+///////////////////////////////////////////////////////////////////////////////////////
+
+/********************************************************************************
+ * \file unicode.hpp
+ * \brief Unicode character properties
+ *
+ * Property lookups are O(1) two-stage table lookups, the tables are generated
+ * by tools/gen_unicode_tables.py and compiled in as constexpr data.
+ ********************************************************************************/
+
+#pragma once
+
+#include "common.hpp"
+#include "utf8.hpp"
+#include "string_view.hpp"
+
+#include <compare>
+
+namespace Envy::utf8
+{
+    /********************************************************************************
+     * \brief Unicode general category of a code point
+     *
+     ********************************************************************************/
+    enum class general_category : u8
+    {
+        uppercase_letter,       ///< Lu
+        lowercase_letter,       ///< Ll
+        titlecase_letter,       ///< Lt
+        modifier_letter,        ///< Lm
+        other_letter,           ///< Lo
+        nonspacing_mark,        ///< Mn
+        spacing_mark,           ///< Mc
+        enclosing_mark,         ///< Me
+        decimal_number,         ///< Nd
+        letter_number,          ///< Nl
+        other_number,           ///< No
+        connector_punctuation,  ///< Pc
+        dash_punctuation,       ///< Pd
+        open_punctuation,       ///< Ps
+        close_punctuation,      ///< Pe
+        initial_punctuation,    ///< Pi
+        final_punctuation,      ///< Pf
+        other_punctuation,      ///< Po
+        math_symbol,            ///< Sm
+        currency_symbol,        ///< Sc
+        modifier_symbol,        ///< Sk
+        other_symbol,           ///< So
+        space_separator,        ///< Zs
+        line_separator,         ///< Zl
+        paragraph_separator,    ///< Zp
+        control,                ///< Cc
+        format,                 ///< Cf
+        surrogate,              ///< Cs
+        private_use,            ///< Co
+        unassigned              ///< Cn
+    };
+
+    /********************************************************************************
+     * \brief East Asian Width property of a code point, see UAX #11
+     *
+     ********************************************************************************/
+    enum class east_asian_width : u8
+    {
+        neutral,    ///< N
+        ambiguous,  ///< A
+        halfwidth,  ///< H
+        wide,       ///< W
+        fullwidth,  ///< F
+        narrow      ///< Na
+    };
+
+    /********************************************************************************
+     * \brief Grapheme_Cluster_Break property of a code point, see UAX #29
+     *
+     * Extended_Pictographic is folded in as its own value, no code point with
+     * that property has a Grapheme_Cluster_Break other than Other.
+     ********************************************************************************/
+    enum class grapheme_break : u8
+    {
+        other,
+        cr,
+        lf,
+        control,
+        extend,
+        zwj,
+        regional_indicator,
+        prepend,
+        spacing_mark,
+        l,
+        v,
+        t,
+        lv,
+        lvt,
+        extended_pictographic
+    };
+
+    /********************************************************************************
+     * \brief Line_Break property of a code point, see UAX #14
+     *
+     ********************************************************************************/
+    enum class line_break : u8
+    {
+        mandatory_break,                ///< BK
+        carriage_return,                ///< CR
+        line_feed,                      ///< LF
+        combining_mark,                 ///< CM
+        next_line,                      ///< NL
+        surrogate,                      ///< SG
+        word_joiner,                    ///< WJ
+        zw_space,                       ///< ZW
+        glue,                           ///< GL
+        space,                          ///< SP
+        zwj,                            ///< ZWJ
+        break_both,                     ///< B2
+        break_after,                    ///< BA
+        break_before,                   ///< BB
+        hyphen,                         ///< HY
+        contingent_break,               ///< CB
+        close_punctuation,              ///< CL
+        close_parenthesis,              ///< CP
+        exclamation,                    ///< EX
+        inseparable,                    ///< IN
+        nonstarter,                     ///< NS
+        open_punctuation,               ///< OP
+        quotation,                      ///< QU
+        infix_numeric,                  ///< IS
+        numeric,                        ///< NU
+        postfix_numeric,                ///< PO
+        prefix_numeric,                 ///< PR
+        break_symbols,                  ///< SY
+        ambiguous,                      ///< AI
+        alphabetic,                     ///< AL
+        conditional_japanese_starter,   ///< CJ
+        e_base,                         ///< EB
+        e_modifier,                     ///< EM
+        h2,                             ///< H2
+        h3,                             ///< H3
+        hebrew_letter,                  ///< HL
+        ideographic,                    ///< ID
+        jl,                             ///< JL
+        jt,                             ///< JT
+        jv,                             ///< JV
+        regional_indicator,             ///< RI
+        complex_context,                ///< SA
+        unknown                         ///< XX
+    };
+
+    /********************************************************************************
+     * \brief Returns the general category of a code point
+     *
+     * \param [in] cp code point, values past U+10FFFF are unassigned
+     * \return general_category
+     ********************************************************************************/
+    [[nodiscard]] general_category category(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the East Asian Width property of a code point
+     *
+     * \param [in] cp code point, values past U+10FFFF are neutral
+     * \return east_asian_width
+     ********************************************************************************/
+    [[nodiscard]] east_asian_width width_class(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the number of terminal columns a code point occupies
+     *
+     * Controls, format characters and combining marks occupy zero columns,
+     * wide and fullwidth characters two, everything else one.
+     *
+     * \param [in] cp code point
+     * \return usize 0, 1 or 2
+     ********************************************************************************/
+    [[nodiscard]] usize display_width(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the number of terminal columns a string occupies
+     *
+     * \param [in] str string
+     * \return usize sum of the display widths of each code point in str
+     ********************************************************************************/
+    [[nodiscard]] usize display_width(const Envy::string_view& str) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the simple uppercase mapping of a code point
+     *
+     * \param [in] cp code point
+     * \return code_point uppercase mapping, or cp if it has none
+     ********************************************************************************/
+    [[nodiscard]] code_point to_upper(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the simple lowercase mapping of a code point
+     *
+     * \param [in] cp code point
+     * \return code_point lowercase mapping, or cp if it has none
+     ********************************************************************************/
+    [[nodiscard]] code_point to_lower(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the simple case folding of a code point
+     *
+     * Simple case folding maps each code point to one code point, statuses C and S
+     * of CaseFolding.txt, so it never changes the number of code points.
+     *
+     * \param [in] cp code point
+     * \return code_point case folded code point, or cp if it has no folding
+     ********************************************************************************/
+    [[nodiscard]] code_point fold_case(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns an upper bound of the size of a case folded buffer
+     *
+     * \param [in] size_bytes size of the buffer to fold
+     * \return usize bytes required by \ref Envy::utf8::fold_case()
+     ********************************************************************************/
+    [[nodiscard]] constexpr usize max_folded_size(usize size_bytes) noexcept
+    { return size_bytes + size_bytes / 2u; } // a few two unit code points fold to three units
+
+    /********************************************************************************
+     * \brief Simple case folds a UTF-8 buffer
+     *
+     * Ill-formed subparts are copied as is. Uses the widest SIMD kernel available
+     * for runs of ascii.
+     *
+     * \param [in] buffer code units to fold
+     * \param [in] size_bytes size of buffer in bytes
+     * \param [out] out receives the folded code units, must hold max_folded_size(size_bytes)
+     * \return usize code units written to out
+     ********************************************************************************/
+    usize fold_case(const code_unit* buffer, usize size_bytes, code_unit* out) noexcept;
+
+    /********************************************************************************
+     * \brief Case insensitive equality
+     *
+     * Strings are equal if their simple case foldings are, no allocations are made.
+     * Ill-formed subparts only equal identical ill-formed subparts.
+     *
+     * \param [in] a string
+     * \param [in] b string
+     * \return true if a and b are equal ignoring case
+     ********************************************************************************/
+    [[nodiscard]] bool equal_ignore_case(const Envy::string_view& a, const Envy::string_view& b) noexcept;
+
+    /********************************************************************************
+     * \brief Case insensitive ordering
+     *
+     * Orders lexicographically by simple case folded code point, ill-formed subparts
+     * order after every code point.
+     *
+     * \param [in] a string
+     * \param [in] b string
+     * \return std::weak_ordering ordering of a relative to b
+     ********************************************************************************/
+    [[nodiscard]] std::weak_ordering compare_ignore_case(const Envy::string_view& a, const Envy::string_view& b) noexcept;
+
+    /********************************************************************************
+     * \brief Case insensitive hash
+     *
+     * Strings that are \ref Envy::utf8::equal_ignore_case() hash equal.
+     *
+     * \param [in] str string
+     * \return usize hash
+     ********************************************************************************/
+    [[nodiscard]] usize hash_ignore_case(const Envy::string_view& str) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a code point is a letter, general category L*
+     *
+     ********************************************************************************/
+    [[nodiscard]] bool is_letter(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a code point is a decimal digit, general category Nd
+     *
+     ********************************************************************************/
+    [[nodiscard]] bool is_digit(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a code point is a letter or a decimal digit
+     *
+     ********************************************************************************/
+    [[nodiscard]] bool is_alphanumeric(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a code point is whitespace, general category Z* or an
+     * ascii whitespace control
+     *
+     ********************************************************************************/
+    [[nodiscard]] bool is_whitespace(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a code point is uppercase, general category Lu or Lt
+     *
+     ********************************************************************************/
+    [[nodiscard]] bool is_upper(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a code point is lowercase, general category Ll
+     *
+     ********************************************************************************/
+    [[nodiscard]] bool is_lower(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the Grapheme_Cluster_Break property of a code point
+     *
+     * \param [in] cp code point
+     * \return grapheme_break
+     ********************************************************************************/
+    [[nodiscard]] grapheme_break grapheme_break_property(code_point cp) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the Line_Break property of a code point
+     *
+     * This is the class as listed in the UCD, before the resolution of LB1.
+     *
+     * \param [in] cp code point
+     * \return line_break
+     ********************************************************************************/
+    [[nodiscard]] line_break line_break_class(code_point cp) noexcept;
+}
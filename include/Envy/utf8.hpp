@@ -33,12 +33,18 @@
 #pragma once
 
 #include "common.hpp"
+#include "buffers.hpp"
 
 #include <iterator>
 #include <concepts>
 #include <type_traits>
 #include <compare>
 #include <ostream>
+#include <span>
+#include <array>
+#include <bit>
+#include <initializer_list>
+#include <string_view>
 
 namespace Envy::utf8
 {
@@ -70,49 +76,49 @@ namespace Envy::utf8
          *
          * \param [in] value code_unit, should be an ascii code point
          ********************************************************************************/
-        code_point(code_unit value) noexcept;
+        constexpr code_point(code_unit value) noexcept;
 
         /********************************************************************************
          * \brief Constructs a code point from a u32 integer
          *
          * \param [in] value code point
          ********************************************************************************/
-        code_point(u32 value) noexcept;
+        constexpr code_point(u32 value) noexcept;
 
         /********************************************************************************
          * \brief Constructs a code point from an ascii character
          *
          * \param [in] value ascii character
          ********************************************************************************/
-        code_point(char value) noexcept;
+        constexpr code_point(char value) noexcept;
 
         /********************************************************************************
          * \brief Constructs a code point from a char8_t
          *
          * \param [in] value code_unit, should be an ascii code point
          ********************************************************************************/
-        code_point(char8_t value) noexcept;
+        constexpr code_point(char8_t value) noexcept;
 
         /********************************************************************************
          * \brief Constructs a code point from a UTF-8 sequence
          *
          * \param [in] value should be a valid UTF-8 encoded unicode code point
          ********************************************************************************/
-        code_point(const char* value) noexcept;
+        constexpr code_point(const char* value) noexcept;
 
         /********************************************************************************
          * \brief Returns the code point integer
          *
          * \return u32& code point refference
          ********************************************************************************/
-        [[nodiscard]] u32& get() noexcept;
+        [[nodiscard]] constexpr u32& get() noexcept;
 
         /********************************************************************************
          * \brief Returns the code point integer
          *
          * \return u32 code point
          ********************************************************************************/
-        [[nodiscard]] explicit operator u32() const noexcept;
+        [[nodiscard]] constexpr explicit operator u32() const noexcept;
 
         /********************************************************************************
          * \brief Equality comparison
@@ -143,7 +149,7 @@ namespace Envy::utf8
      * \param [in] lead_unit Pointer to the first code unit of a UTF-8 encoded code point
      * \return i32 number of code units the code point is encoded in, will be 1 to 4
      ********************************************************************************/
-    [[nodiscard]] i32 code_units_encoded(const code_unit* lead_unit) noexcept(!Envy::debug);
+    [[nodiscard]] constexpr i32 code_units_encoded(const code_unit* lead_unit) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Returns the number of code units requred to encode a unicode code unit in UTF-8
@@ -151,7 +157,7 @@ namespace Envy::utf8
      * \param [in] cp code point
      * \return i32 Number of code units requred to encode code point
      ********************************************************************************/
-    [[nodiscard]] i32 code_units_required(code_point cp) noexcept;
+    [[nodiscard]] constexpr i32 code_units_required(code_point cp) noexcept;
 
     /********************************************************************************
      * \brief Return the size of a UTF-8 string in unicode code points
@@ -159,16 +165,80 @@ namespace Envy::utf8
      * \param [in] buffer A valid null-terminated UTF-8 string
      * \return i32 Size in code points
      ********************************************************************************/
-    [[nodiscard]] i32 count_code_points(const code_unit* buffer) noexcept(!Envy::debug);
+    [[nodiscard]] i32 count_code_points(const code_unit* buffer) noexcept;
 
     /********************************************************************************
      * \brief Return the size of a UTF-8 string in unicode code points
      *
+     * Counts every code unit that is not a continuation unit, so null code units
+     * are counted rather than ending the string. Uses the widest SIMD kernel
+     * available, see \ref Envy::cpu::active_simd_level().
+     *
      * \param [in] buffer A valid UTF-8 string
      * \param [in] size_bytes Size of buffer in bytes
      * \return i32 Size in code points
      ********************************************************************************/
-    [[nodiscard]] i32 count_code_points(const code_unit* buffer, usize size_bytes) noexcept(!Envy::debug);
+    [[nodiscard]] i32 count_code_points(const code_unit* buffer, usize size_bytes) noexcept;
+
+    /********************************************************************************
+     * \brief Return the size of a UTF-8 string literal in unicode code points
+     *
+     * Usable in constant expressions, at run time forwards to the SIMD kernels.
+     *
+     * \param [in] str A valid UTF-8 string
+     * \return i32 Size in code points
+     ********************************************************************************/
+    [[nodiscard]] constexpr i32 count_code_points(std::string_view str) noexcept;
+
+    /********************************************************************************
+     * \brief Returns whether every code unit in a buffer is ascii
+     *
+     * Uses the widest SIMD kernel available, see \ref Envy::cpu::active_simd_level().
+     *
+     * \param [in] buffer code units to check
+     * \param [in] size_bytes Size of buffer in bytes
+     * \return true if no code unit has its high bit set
+     ********************************************************************************/
+    [[nodiscard]] bool is_ascii(const code_unit* buffer, usize size_bytes) noexcept;
+
+    /********************************************************************************
+     * \brief Finds the first occurrence of a sequence of code units
+     *
+     * UTF-8 is self-synchronizing, so a byte match of a well-formed needle always
+     * begins on a code point boundary and no decoding is needed. Uses the widest
+     * SIMD kernel available, see \ref Envy::cpu::active_simd_level().
+     *
+     * \param [in] buffer code units to search
+     * \param [in] size_bytes Size of buffer in bytes
+     * \param [in] needle code units to search for
+     * \param [in] needle_size Size of needle in bytes
+     * \return const code_unit* First unit of the match, nullptr if there is none.
+     *         An empty needle matches at the start of the buffer.
+     ********************************************************************************/
+    [[nodiscard]] const code_unit* find_sequence(const code_unit* buffer, usize size_bytes, const code_unit* needle, usize needle_size) noexcept;
+
+    /********************************************************************************
+     * \brief Finds the last occurrence of a sequence of code units
+     *
+     * \param [in] buffer code units to search
+     * \param [in] size_bytes Size of buffer in bytes
+     * \param [in] needle code units to search for
+     * \param [in] needle_size Size of needle in bytes
+     * \return const code_unit* First unit of the match, nullptr if there is none.
+     *         An empty needle matches at the end of the buffer.
+     ********************************************************************************/
+    [[nodiscard]] const code_unit* find_last_sequence(const code_unit* buffer, usize size_bytes, const code_unit* needle, usize needle_size) noexcept;
+
+    /********************************************************************************
+     * \brief Counts the non-overlapping occurrences of a sequence of code units
+     *
+     * \param [in] buffer code units to search
+     * \param [in] size_bytes Size of buffer in bytes
+     * \param [in] needle code units to search for
+     * \param [in] needle_size Size of needle in bytes
+     * \return usize Number of matches, 0 for an empty needle
+     ********************************************************************************/
+    [[nodiscard]] usize count_sequence(const code_unit* buffer, usize size_bytes, const code_unit* needle, usize needle_size) noexcept;
 
     /********************************************************************************
      * \brief Return the size of a UTF-8 string in bytes
@@ -193,7 +263,7 @@ namespace Envy::utf8
      * \return true, *unit* is a lead unit
      * \return false, *unit* is a continuation unit, or invalid
      ********************************************************************************/
-    [[nodiscard]] bool is_lead_unit(const code_unit* unit) noexcept;
+    [[nodiscard]] constexpr bool is_lead_unit(const code_unit* unit) noexcept;
 
     /********************************************************************************
      * \brief Returns if a code unit represents a continuation unit in a UTF-8 encoded code point
@@ -202,7 +272,7 @@ namespace Envy::utf8
      * \return true, *unit* is a continuation unit
      * \return false, *unit* is a lead unit, or invalid
      ********************************************************************************/
-    [[nodiscard]] bool is_continuation_unit(const code_unit* unit) noexcept;
+    [[nodiscard]] constexpr bool is_continuation_unit(const code_unit* unit) noexcept;
 
     /********************************************************************************
      * \brief Returns if a sequnce of code units represents a unicode cope point encoded in UTF-8
@@ -211,35 +281,35 @@ namespace Envy::utf8
      * \return true, *lead* points to a valid UTF-8 encoded code point
      * \return false, *lead* points to a valid UTF-8 encoded code point
      ********************************************************************************/
-    [[nodiscard]] bool is_valid_char(const code_unit* lead) noexcept;
+    [[nodiscard]] constexpr bool is_valid_char(const code_unit* lead) noexcept;
 
     /********************************************************************************
      * \brief Increments a pointer to the next code point in a UTF-8 string
      *
      * \param [in] lead_ptr Pointer to a lead code unit in a UTF-8 string
      ********************************************************************************/
-    void increment_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug);
+    constexpr void increment_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Decrements a pointer to the prev code point in a UTF-8 string
      *
      * \param [in] lead_ptr Pointer to a lead code unit in a UTF-8 string
      ********************************************************************************/
-    void decrement_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug);
+    constexpr void decrement_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Increments a pointer to the next code point in a UTF-8 string
      *
      * \param [in] lead_ptr Pointer to a lead code unit in a UTF-8 string
      ********************************************************************************/
-    void increment_ptr(code_unit** lead_ptr) noexcept(!Envy::debug);
+    constexpr void increment_ptr(code_unit** lead_ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Decrements a pointer to the prev code point in a UTF-8 string
      *
      * \param [in] lead_ptr Pointer to a lead code unit in a UTF-8 string
      ********************************************************************************/
-    void decrement_ptr(code_unit** lead_ptr) noexcept(!Envy::debug);
+    constexpr void decrement_ptr(code_unit** lead_ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Decodes a unicode code point from a UTF-8 string
@@ -247,7 +317,39 @@ namespace Envy::utf8
      * \param [in] lead  Pointer to a lead code unit in a UTF-8 string
      * \return code_point Decoded code point
      ********************************************************************************/
-    [[nodiscard]] code_point decode(const code_unit* lead) noexcept(!Envy::debug);
+    [[nodiscard]] constexpr code_point decode(const code_unit* lead) noexcept(!Envy::debug);
+
+    /********************************************************************************
+     * \brief Return type for \ref Envy::utf8::decode_checked()
+     *
+     * Can be tested as a bool for validity.
+     ********************************************************************************/
+    class decode_result final
+    {
+    public:
+
+        code_point cp {};   ///< Decoded code point, U+FFFD if ill-formed
+        i32 length {0};     ///< Code units consumed, the maximal subpart if ill-formed, 0 if there was no input
+        bool valid {false}; ///< True if a well-formed code point was decoded
+
+        /********************************************************************************
+         * \brief Returns whether a well-formed code point was decoded
+         ********************************************************************************/
+        [[nodiscard]] explicit operator bool() const noexcept { return valid; }
+    };
+
+    /********************************************************************************
+     * \brief Decodes a unicode code point from a UTF-8 buffer, reporting ill-formed input
+     *
+     * Unlike \ref Envy::utf8::decode() this never reads past 'available' and does not
+     * assume the input is valid. Advancing by \ref decode_result::length after an error
+     * skips one maximal subpart, resynchronizing as required by the Unicode Standard.
+     *
+     * \param [in] lead Pointer to the code unit to decode from
+     * \param [in] available Number of code units readable from 'lead'
+     * \return decode_result decoded code point and number of code units consumed
+     ********************************************************************************/
+    [[nodiscard]] constexpr decode_result decode_checked(const code_unit* lead, usize available) noexcept;
 
     /********************************************************************************
      * \brief Encodes a unicode code point to a UTF-8 string
@@ -258,7 +360,7 @@ namespace Envy::utf8
      * \param [in] cp code point to encode
      * \param [in] ptr poiter to write encoded code point to
      ********************************************************************************/
-    void encode(code_point cp, code_unit* ptr) noexcept(!Envy::debug);
+    constexpr void encode(code_point cp, code_unit* ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Decodes the current code point and increments to the next
@@ -267,7 +369,7 @@ namespace Envy::utf8
      * \return code_point Decoded code point
      ********************************************************************************/
     [[nodiscard("consider using 'Envy::utf8::increment_ptr()'")]]
-    code_point next_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug);
+    constexpr code_point next_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Decodes the current code point and decrements to the previous
@@ -276,7 +378,7 @@ namespace Envy::utf8
      * \return code_point Decoded code point
      ********************************************************************************/
     [[nodiscard("consider using 'Envy::utf8::decrement_ptr()'")]]
-    code_point prev_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug);
+    constexpr code_point prev_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug);
 
     /********************************************************************************
      * \brief Checks if a string is a valid UTF-8 string
@@ -287,13 +389,340 @@ namespace Envy::utf8
      ********************************************************************************/
     [[nodiscard]] bool is_valid_utf8(const code_unit* buffer) noexcept;
 
+    /********************************************************************************
+     * \brief Checks if a buffer is a valid UTF-8 string
+     *
+     * \param [in] buffer string to check, need not be null-terminated
+     * \param [in] size_bytes Size of buffer in bytes
+     * \return true, buffer points to a valid UTF-8 string
+     * \return false, buffer points to an invalid UTF-8 string
+     ********************************************************************************/
+    [[nodiscard]] bool is_valid_utf8(const code_unit* buffer, usize size_bytes) noexcept;
+
+    /********************************************************************************
+     * \brief Checks if a string literal is valid UTF-8
+     *
+     * Usable in constant expressions, at run time forwards to \ref Envy::utf8::validate().
+     *
+     * \code
+     * static_assert(Envy::utf8::is_valid_utf8("größe"));
+     * \endcode
+     *
+     * \param [in] str string to check
+     * \return true, str is valid UTF-8
+     ********************************************************************************/
+    [[nodiscard]] constexpr bool is_valid_utf8(std::string_view str) noexcept;
+
+    /********************************************************************************
+     * \brief Return type for \ref Envy::utf8::validate()
+     *
+     * Can be tested as a bool for validity.
+     ********************************************************************************/
+    class validation_result final
+    {
+    public:
+
+        usize error_offset {0}; ///< Byte offset of the first code unit of the first ill-formed sequence, size of the buffer if valid
+        bool valid {false};     ///< True if the whole buffer is well-formed UTF-8
+        bool ascii {true};      ///< True if every code unit before error_offset is ascii
+
+        /********************************************************************************
+         * \brief Returns whether the buffer was valid
+         ********************************************************************************/
+        [[nodiscard]] explicit operator bool() const noexcept { return valid; }
+    };
+
+    /********************************************************************************
+     * \brief Validates a buffer of UTF-8
+     *
+     * Conforms to the well-formed byte sequences of the Unicode Standard (Table 3-7),
+     * overlong encodings, surrogates, code points above U+10FFFF, stray continuation
+     * units and truncated sequences are all rejected. Null code units are valid and
+     * do not terminate validation.
+     *
+     * Uses the widest SIMD kernel available, see \ref Envy::cpu::active_simd_level().
+     *
+     * \param [in] buffer code units to validate
+     * \param [in] size_bytes Size of buffer in bytes
+     * \return validation_result validity, the offset of the first error and whether the units before it are ascii
+     ********************************************************************************/
+    [[nodiscard]] validation_result validate(const code_unit* buffer, usize size_bytes) noexcept;
+
+    /********************************************************************************
+     * \brief How transcoding treats ill-formed input
+     ********************************************************************************/
+    enum class error_policy : u8
+    {
+        replace, ///< Each maximal ill-formed subpart is replaced with U+FFFD
+        error    ///< Transcoding stops at the first ill-formed sequence
+    };
+
+    /********************************************************************************
+     * \brief Outcome of a call to \ref Envy::utf8::transcode()
+     ********************************************************************************/
+    enum class transcode_status : u8
+    {
+        ok,              ///< All input was transcoded
+        invalid_input,   ///< Stopped at an ill-formed sequence, only with error_policy::error
+        output_too_small ///< Stopped because the next code point did not fit in the output
+    };
+
+    /********************************************************************************
+     * \brief Return type for \ref Envy::utf8::transcode()
+     *
+     * Can be tested as a bool for success.
+     ********************************************************************************/
+    class transcode_result final
+    {
+    public:
+
+        usize read {0};    ///< Number of input code units consumed, the offset of the error if one occurred
+        usize written {0}; ///< Number of output code units written
+        transcode_status status {transcode_status::ok};
+
+        /********************************************************************************
+         * \brief Returns whether all input was transcoded
+         ********************************************************************************/
+        [[nodiscard]] explicit operator bool() const noexcept { return status == transcode_status::ok; }
+    };
+
+    /********************************************************************************
+     * \brief Returns the exact number of UTF-16 code units \ref Envy::utf8::transcode() will write
+     *
+     * \param [in] from UTF-8 input
+     * \param [in] policy treatment of ill-formed input
+     * \return usize Number of char16_t's required
+     ********************************************************************************/
+    [[nodiscard]] usize utf16_length(std::span<const code_unit> from, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the exact number of UTF-32 code units \ref Envy::utf8::transcode() will write
+     *
+     * \param [in] from UTF-8 input
+     * \param [in] policy treatment of ill-formed input
+     * \return usize Number of char32_t's required
+     ********************************************************************************/
+    [[nodiscard]] usize utf32_length(std::span<const code_unit> from, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the exact number of UTF-8 code units \ref Envy::utf8::transcode() will write
+     *
+     * \param [in] from UTF-16 input
+     * \param [in] policy treatment of unpaired surrogates
+     * \return usize Number of code units required
+     ********************************************************************************/
+    [[nodiscard]] usize utf8_length(std::span<const char16_t> from, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Returns the exact number of UTF-8 code units \ref Envy::utf8::transcode() will write
+     *
+     * \param [in] from UTF-32 input
+     * \param [in] policy treatment of surrogates and values above U+10FFFF
+     * \return usize Number of code units required
+     ********************************************************************************/
+    [[nodiscard]] usize utf8_length(std::span<const char32_t> from, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Transcodes UTF-8 to UTF-16
+     *
+     * Runs of ascii are widened with the widest SIMD kernel available. Size the
+     * output with \ref Envy::utf8::utf16_length() to transcode in a single call.
+     *
+     * \param [in] from UTF-8 input
+     * \param [out] to UTF-16 output
+     * \param [in] policy treatment of ill-formed input
+     * \return transcode_result units read and written, and why transcoding stopped
+     ********************************************************************************/
+    transcode_result transcode(std::span<const code_unit> from, std::span<char16_t> to, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Transcodes UTF-8 to UTF-32
+     *
+     * \param [in] from UTF-8 input
+     * \param [out] to UTF-32 output
+     * \param [in] policy treatment of ill-formed input
+     * \return transcode_result units read and written, and why transcoding stopped
+     ********************************************************************************/
+    transcode_result transcode(std::span<const code_unit> from, std::span<char32_t> to, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Transcodes UTF-16 to UTF-8
+     *
+     * \param [in] from UTF-16 input
+     * \param [out] to UTF-8 output
+     * \param [in] policy treatment of unpaired surrogates
+     * \return transcode_result units read and written, and why transcoding stopped
+     ********************************************************************************/
+    transcode_result transcode(std::span<const char16_t> from, std::span<code_unit> to, error_policy policy = error_policy::replace) noexcept;
+
+    /********************************************************************************
+     * \brief Transcodes UTF-32 to UTF-8
+     *
+     * \param [in] from UTF-32 input
+     * \param [out] to UTF-8 output
+     * \param [in] policy treatment of surrogates and values above U+10FFFF
+     * \return transcode_result units read and written, and why transcoding stopped
+     ********************************************************************************/
+    transcode_result transcode(std::span<const char32_t> from, std::span<code_unit> to, error_policy policy = error_policy::replace) noexcept;
+
+    // wchar_t is UTF-16 on windows, these let Win32 buffers be passed directly
+    static_assert(sizeof(wchar_t) == sizeof(char16_t), "Envy expects wchar_t to hold UTF-16");
+
+    [[nodiscard]] inline usize utf8_length(std::span<const wchar_t> from, error_policy policy = error_policy::replace) noexcept
+    { return utf8_length(std::span<const char16_t>(reinterpret_cast<const char16_t*>(from.data()), from.size()), policy); }
+
+    inline transcode_result transcode(std::span<const code_unit> from, std::span<wchar_t> to, error_policy policy = error_policy::replace) noexcept
+    { return transcode(from, std::span<char16_t>(reinterpret_cast<char16_t*>(to.data()), to.size()), policy); }
+
+    inline transcode_result transcode(std::span<const wchar_t> from, std::span<code_unit> to, error_policy policy = error_policy::replace) noexcept
+    { return transcode(std::span<const char16_t>(reinterpret_cast<const char16_t*>(from.data()), from.size()), to, policy); }
+
+    /********************************************************************************
+     * \brief Returns the code units needed to sanitize any buffer of 'size_bytes'
+     *
+     * Every ill-formed subpart is at least one code unit and becomes three.
+     ********************************************************************************/
+    [[nodiscard]] constexpr usize max_sanitized_size(usize size_bytes) noexcept
+    { return size_bytes * 3u; }
+
+    /********************************************************************************
+     * \brief Returns the code units \ref Envy::utf8::sanitize() writes for 'from'
+     *
+     * \param [in] from possibly ill-formed UTF-8
+     * \return usize exact size of the sanitized output in bytes
+     ********************************************************************************/
+    [[nodiscard]] usize sanitized_size(const_buffer from) noexcept;
+
+    /********************************************************************************
+     * \brief Copies possibly ill-formed UTF-8, replacing each maximal ill-formed subpart with U+FFFD
+     *
+     * Well-formed runs are found with \ref Envy::utf8::validate() and copied as a
+     * whole, so valid input costs one validation pass and a memcpy. The output is
+     * always well-formed and safe to pass to the other Envy::utf8 functions.
+     * Output is never split inside a code point.
+     *
+     * \param [in] from possibly ill-formed UTF-8
+     * \param [out] to buffer to write well-formed UTF-8 to, see \ref Envy::utf8::sanitized_size()
+     * \return transcode_result code units read and written, status ok or output_too_small
+     ********************************************************************************/
+    transcode_result sanitize(const_buffer from, mutable_buffer to) noexcept;
+
+    /********************************************************************************
+     * \brief Decodes UTF-8 delivered in chunks
+     *
+     * A sequence split across chunk boundaries is carried over to the next call,
+     * at most three code units are held between chunks, the input is never copied
+     * as a whole. Ill-formed input is handled per the \ref error_policy, a sequence
+     * still incomplete when the stream ends is handled by \ref finish().
+     *
+     * Each call reports the code units read from the chunk and written to the
+     * output. Stopping on output_too_small loses nothing, call again with the rest
+     * of the chunk once there is room.
+     *
+     * \code
+     * utf8::stream_decoder decoder;
+     * while(const_buffer chunk {read_chunk()})
+     * {
+     *     while(chunk)
+     *     {
+     *         const auto result {decoder.decode(chunk, code_points)};
+     *         consume(code_points.first(result.written));
+     *         chunk += result.read;
+     *     }
+     * }
+     * consume(code_points.first(decoder.finish(code_points).written));
+     * \endcode
+     ********************************************************************************/
+    class stream_decoder final
+    {
+        code_unit pending[4] {};  ///< Start of a sequence split across chunks
+        u8 pending_size {0};      ///< Code units in pending
+        error_policy policy;      ///< How ill-formed input is treated
+        usize position_ {0};      ///< Stream offset of the next code unit to be decoded
+
+        template <typename Out>
+        transcode_result decode_into(const_buffer chunk, std::span<Out> to) noexcept;
+
+        template <typename Out>
+        transcode_result finish_into(std::span<Out> to) noexcept;
+
+    public:
+
+        /********************************************************************************
+         * \brief Constructs a decoder at the start of a stream
+         *
+         * \param [in] policy how ill-formed input is treated
+         ********************************************************************************/
+        explicit stream_decoder(error_policy policy = error_policy::replace) noexcept;
+
+        /********************************************************************************
+         * \brief Decodes the next chunk of the stream to code points
+         *
+         * \param [in] chunk code units following those already read
+         * \param [out] to buffer to write code points to
+         * \return transcode_result code units read from chunk and code points written
+         ********************************************************************************/
+        transcode_result decode(const_buffer chunk, std::span<char32_t> to) noexcept;
+
+        /********************************************************************************
+         * \brief Copies the next chunk of the stream to well-formed UTF-8
+         *
+         * Well-formed runs are validated with \ref Envy::utf8::validate() and copied
+         * as a whole, with error_policy::replace ill-formed subparts become U+FFFD.
+         *
+         * \param [in] chunk code units following those already read
+         * \param [out] to buffer to write code units to
+         * \return transcode_result code units read from chunk and written to 'to'
+         ********************************************************************************/
+        transcode_result decode(const_buffer chunk, std::span<code_unit> to) noexcept;
+
+        /********************************************************************************
+         * \brief Ends the stream, flushing a sequence left incomplete by the last chunk
+         *
+         * Resets the decoder on success so it can decode another stream.
+         *
+         * \param [out] to buffer to write a replacement character to
+         * \return transcode_result with read 0 and written 0 or 1
+         ********************************************************************************/
+        transcode_result finish(std::span<char32_t> to) noexcept;
+
+        /********************************************************************************
+         * \brief Ends the stream, flushing a sequence left incomplete by the last chunk
+         *
+         * Resets the decoder on success so it can decode another stream.
+         *
+         * \param [out] to buffer to write a replacement character to
+         * \return transcode_result with read 0 and written 0 or 3
+         ********************************************************************************/
+        transcode_result finish(std::span<code_unit> to) noexcept;
+
+        /********************************************************************************
+         * \brief Discards carried code units and restarts at the beginning of a stream
+         ********************************************************************************/
+        void reset() noexcept;
+
+        /********************************************************************************
+         * \brief Returns the stream offset of the next sequence to be decoded
+         *
+         * After invalid_input this is the offset of the ill-formed sequence.
+         ********************************************************************************/
+        [[nodiscard]] usize position() const noexcept;
+
+        /********************************************************************************
+         * \brief Returns whether a sequence split across chunks is being carried
+         ********************************************************************************/
+        [[nodiscard]] bool has_pending() const noexcept;
+    };
+
     /********************************************************************************
      * \brief Bidirectional iterator for iterating over a UTF-8 string
      *
      ********************************************************************************/
     class iterator final
     {
-        const code_unit* ptr; ///< Pointer to a code unit in a UTF-8 string
+        const code_unit* ptr;            ///< Pointer to a code unit in a UTF-8 string
+        mutable code_point cached {};    ///< Code point at ptr, decoded by the last dereference
+        mutable u8 cached_length {0};    ///< Code units in cached, 0 if nothing is cached
     public:
 
         // member types
@@ -307,13 +736,13 @@ namespace Envy::utf8
          * \brief Constructs a null utf8 iterator
          *
          ********************************************************************************/
-        iterator() noexcept;
+        constexpr iterator() noexcept;
 
         /********************************************************************************
          * \brief Constructs a utf8 iterator from a pointer
          *
          ********************************************************************************/
-        iterator(const code_unit*) noexcept;
+        constexpr iterator(const code_unit*) noexcept;
 
         iterator(const iterator&) = default;
         iterator& operator=(const iterator&) = default;
@@ -325,35 +754,38 @@ namespace Envy::utf8
          *
          * \return iterator& this
          ********************************************************************************/
-        iterator& operator++() noexcept(!Envy::debug);
+        constexpr iterator& operator++() noexcept(!Envy::debug);
 
         /********************************************************************************
          * \brief Increments iterator to refer to next code point in the string
          *
          * \return iterator copy of this
          ********************************************************************************/
-        iterator operator++(int) noexcept(!Envy::debug);
+        constexpr iterator operator++(int) noexcept(!Envy::debug);
 
         /********************************************************************************
          * \brief Decrements iterator to point at previous code point
          *
          * \return iterator& this
          ********************************************************************************/
-        iterator& operator--() noexcept(!Envy::debug);
+        constexpr iterator& operator--() noexcept(!Envy::debug);
 
         /********************************************************************************
          * \brief Decrements iterator to point at previous code point
          *
          * \return iterator this copy
          ********************************************************************************/
-        iterator operator--(int) noexcept(!Envy::debug);
+        constexpr iterator operator--(int) noexcept(!Envy::debug);
 
         /********************************************************************************
          * \brief Decodes the current code point
          *
+         * The code point is cached until the iterator moves, so repeated dereferences
+         * and the following increment don't decode again.
+         *
          * \return value_type code point
          ********************************************************************************/
-        [[nodiscard]] value_type operator*() const noexcept(!Envy::debug);
+        [[nodiscard]] constexpr value_type operator*() const noexcept(!Envy::debug);
 
         /********************************************************************************
          * \brief Equality comparison
@@ -361,9 +793,9 @@ namespace Envy::utf8
          * \return true The iterators are pointing to the same code point
          * \return false The iterators are pointing to different code points
          ********************************************************************************/
-        [[nodiscard]] bool operator==(const iterator&) const noexcept;
+        [[nodiscard]] constexpr bool operator==(const iterator&) const noexcept;
 
-        auto operator <=> (const iterator& other) const
+        constexpr auto operator <=> (const iterator& other) const
         { return ptr <=> other.ptr; }
 
         // iterator non-member funcs
@@ -373,19 +805,19 @@ namespace Envy::utf8
          *
          * \return const code_unit* pointer
          ********************************************************************************/
-        [[nodiscard]] friend const code_unit* iterator_ptr(const iterator&) noexcept;
+        [[nodiscard]] friend constexpr const code_unit* iterator_ptr(const iterator&) noexcept;
 
         /********************************************************************************
          * \brief Returns the distance in bytes between two utf8 iterators
          *
          * \return usize distance
          ********************************************************************************/
-        [[nodiscard]] friend usize iterator_distance_bytes(const iterator&, const iterator&) noexcept;
+        [[nodiscard]] friend constexpr usize iterator_distance_bytes(const iterator&, const iterator&) noexcept;
 
     };
 
-    [[nodiscard]] const code_unit* iterator_ptr(const iterator&) noexcept;
-    [[nodiscard]] usize iterator_distance_bytes(const iterator&, const iterator&) noexcept;
+    [[nodiscard]] constexpr const code_unit* iterator_ptr(const iterator&) noexcept;
+    [[nodiscard]] constexpr usize iterator_distance_bytes(const iterator&, const iterator&) noexcept;
 
     using reverse_iterator = std::reverse_iterator<iterator>;
 
@@ -396,4 +828,564 @@ namespace Envy::utf8
     static_assert(std::forward_iterator<iterator>);
     static_assert(std::bidirectional_iterator<iterator>);
 
-}
\ No newline at end of file
+    // ==== inline definitions ====
+    //
+    // The decoder and iterator are defined here rather than in utf8.cpp so loops
+    // over Envy::string inline and vectorize, and so they work in constant expressions.
+
+    namespace detail
+    {
+        // these are used to mask off the encoding bits of the code units so we can get at that jucy unicode code point data
+        inline constexpr code_unit  c_mask {0b00111111}; // continuation unit
+        inline constexpr code_unit l2_mask {0b00011111}; // lead unit indicating 2 continuation units
+        inline constexpr code_unit l3_mask {0b00001111}; // lead unit indicating 3 continuation units
+        inline constexpr code_unit l4_mask {0b00000111}; // lead unit indicating 4 continuation units
+
+        // prefixes for unicode code units, used for encoding code points
+        inline constexpr code_unit  c_prefix {0b10000000}; // continuation unit
+        inline constexpr code_unit f2_prefix {0b11000000}; // lead unit indicating 2 continuation units
+        inline constexpr code_unit f3_prefix {0b11100000}; // lead unit indicating 3 continuation units
+        inline constexpr code_unit f4_prefix {0b11110000}; // lead unit indicating 4 continuation units
+
+        // All continuation units contain exactly six bits from the code point
+        inline constexpr i32 bits_per_continuation_unit {6};
+
+
+        // -- DFA decoder, after Bjoern Hoehrmann's "Flexible and Economical UTF-8 Decoder"
+
+        // Every byte maps to a class, bytes in a class are interchangeable in every state.
+        // The classes are numbered so that '0xFF >> class' masks the payload bits of a lead unit
+        enum byte_class : u8
+        {
+            ascii_class     = 0,  // 00..7F
+            cont_80_class   = 1,  // 80..8F
+            lead_c2_class   = 2,  // C2..DF
+            lead_e1_class   = 3,  // E1..EC, EE..EF
+            lead_ed_class   = 4,  // ED
+            lead_f4_class   = 5,  // F4
+            lead_f1_class   = 6,  // F1..F3
+            cont_a0_class   = 7,  // A0..BF
+            invalid_class   = 8,  // C0..C1, F5..FF
+            cont_90_class   = 9,  // 90..9F
+            lead_e0_class   = 10, // E0
+            lead_f0_class   = 11, // F0
+            byte_class_count
+        };
+
+        // States are named for the code units still expected, and the range allowed for the next one
+        enum dfa_state : u8
+        {
+            accept,        // between sequences
+            reject,        // ill-formed
+            need_1,        // 80..BF
+            need_2,        // 80..BF, then 1
+            need_2_a0,     // A0..BF, then 1, after E0
+            need_2_9f,     // 80..9F, then 1, after ED
+            need_3_90,     // 90..BF, then 2, after F0
+            need_3,        // 80..BF, then 2
+            need_3_8f,     // 80..8F, then 2, after F4
+            dfa_state_count
+        };
+
+        inline constexpr auto byte_classes {[]
+        {
+            std::array<u8, 256> classes {};
+
+            for(u32 b {}; b < 256u; ++b)
+            {
+                if(b < 0x80u)       classes[b] = ascii_class;
+                else if(b < 0x90u)  classes[b] = cont_80_class;
+                else if(b < 0xA0u)  classes[b] = cont_90_class;
+                else if(b < 0xC0u)  classes[b] = cont_a0_class;
+                else if(b < 0xC2u)  classes[b] = invalid_class;
+                else if(b < 0xE0u)  classes[b] = lead_c2_class;
+                else if(b == 0xE0u) classes[b] = lead_e0_class;
+                else if(b == 0xEDu) classes[b] = lead_ed_class;
+                else if(b < 0xF0u)  classes[b] = lead_e1_class;
+                else if(b == 0xF0u) classes[b] = lead_f0_class;
+                else if(b < 0xF4u)  classes[b] = lead_f1_class;
+                else if(b == 0xF4u) classes[b] = lead_f4_class;
+                else                classes[b] = invalid_class;
+            }
+
+            return classes;
+        }()};
+
+        // units in the sequence a lead unit begins, 0 for units which can't begin a sequence
+        inline constexpr auto sequence_lengths {[]
+        {
+            std::array<u8, 256> lengths {};
+
+            for(u32 b {}; b < 256u; ++b)
+            {
+                if(b < 0x80u)      lengths[b] = 1u;
+                else if(b < 0xC2u) lengths[b] = 0u;
+                else if(b < 0xE0u) lengths[b] = 2u;
+                else if(b < 0xF0u) lengths[b] = 3u;
+                else if(b < 0xF5u) lengths[b] = 4u;
+            }
+
+            return lengths;
+        }()};
+
+        inline constexpr auto dfa_transitions {[]
+        {
+            std::array<std::array<u8, byte_class_count>, dfa_state_count> next {};
+
+            for(auto& row : next)
+            { row.fill(reject); }
+
+            next[accept][ascii_class]   = accept;
+            next[accept][lead_c2_class] = need_1;
+            next[accept][lead_e0_class] = need_2_a0;
+            next[accept][lead_e1_class] = need_2;
+            next[accept][lead_ed_class] = need_2_9f;
+            next[accept][lead_f0_class] = need_3_90;
+            next[accept][lead_f1_class] = need_3;
+            next[accept][lead_f4_class] = need_3_8f;
+
+            const auto allow = [&](u8 from, u8 to, std::initializer_list<u8> classes)
+            {
+                for(const u8 c : classes)
+                { next[from][c] = to; }
+            };
+
+            allow(need_1,    accept, {cont_80_class, cont_90_class, cont_a0_class});
+            allow(need_2,    need_1, {cont_80_class, cont_90_class, cont_a0_class});
+            allow(need_2_a0, need_1, {cont_a0_class});
+            allow(need_2_9f, need_1, {cont_80_class, cont_90_class});
+            allow(need_3_90, need_2, {cont_90_class, cont_a0_class});
+            allow(need_3,    need_2, {cont_80_class, cont_90_class, cont_a0_class});
+            allow(need_3_8f, need_2, {cont_80_class});
+
+            return next;
+        }()};
+
+
+        struct sequence
+        {
+            u32 cp;       // decoded code point, U+FFFD if ill-formed
+            usize length; // units in the sequence, or in the maximal subpart of an ill-formed sequence
+            bool valid;
+        };
+
+
+        // Decodes the sequence starting at 'seq' following Table 3-7 of the Unicode Standard.
+        // The DFA rejects on the first unit that can't continue a well-formed sequence, so the
+        // units accepted before it are the maximal subpart of an ill-formed sequence, or 1 if none.
+        // Templated on the unit so string literals can be decoded in constant expressions
+        template <typename Unit>
+        constexpr sequence decode_sequence(const Unit* seq, usize available) noexcept
+        {
+            const auto unit = [seq](usize i) { return static_cast<code_unit>(seq[i]); };
+
+            if(unit(0) < 0x80u)
+            { return { unit(0), 1u, true }; }
+
+            u32 cp {};
+            u8 state {accept};
+
+            // well-formed input runs the DFA over the length given by the lead, stopping at
+            // the first rejected unit so nothing past it (such as a null-terminator) is read
+            const usize length {sequence_lengths[unit(0)]};
+
+            if(length != 0u && length <= available)
+            {
+                for(usize i {}; i < length; ++i)
+                {
+                    const u8 type {byte_classes[unit(i)]};
+                    cp = (i == 0u) ? (0xFFu >> type) & unit(i) : (cp << bits_per_continuation_unit) | (unit(i) & c_mask);
+                    state = dfa_transitions[state][type];
+
+                    if(state == reject)
+                    { break; }
+                }
+
+                if(state == accept)
+                { return { cp, length, true }; }
+
+                state = accept;
+            }
+
+            // ill-formed or truncated, step until the DFA rejects to find the maximal subpart
+            for(usize i {}; i < available; ++i)
+            {
+                const u8 type {byte_classes[unit(i)]};
+
+                cp = (state == accept) ? (0xFFu >> type) & unit(i) : (cp << bits_per_continuation_unit) | (unit(i) & c_mask);
+                state = dfa_transitions[state][type];
+
+                if(state == accept)
+                { return { cp, i + 1u, true }; }
+
+                if(state == reject)
+                { return { 0xFFFDu, i != 0u ? i : 1u, false }; }
+            }
+
+            // truncated
+            return { 0xFFFDu, available, false };
+        }
+
+
+        // reports ill-formed input to Envy::debug_assert(), only called in debug builds.
+        // Not constexpr, so reaching it in a constant expression is a compile error
+        void invalid_utf8(const char* msg) noexcept(!Envy::debug);
+    }
+
+
+    // -- Envy::utf8::code_point
+
+
+    constexpr code_point::code_point(code_unit value) noexcept :
+        cp { static_cast<u32>(value) }
+    {}
+
+
+    constexpr code_point::code_point(char value) noexcept :
+        cp { static_cast<u32>(value) }
+    {}
+
+
+    constexpr code_point::code_point(char8_t value) noexcept :
+        cp { static_cast<u32>(value) }
+    {}
+
+
+    constexpr code_point::code_point(u32 value) noexcept :
+        cp {value}
+    {}
+
+
+    constexpr code_point::code_point(const char* value) noexcept :
+        cp { detail::decode_sequence(value, 4u).cp }
+    {
+        if constexpr (Envy::debug)
+        {
+            if(value[0] == '\0' || value[detail::decode_sequence(value, 4u).length] != '\0')
+            { detail::invalid_utf8("Trying to construct Envy::utf8::code_point from multi character string"); }
+        }
+    }
+
+
+    constexpr u32& code_point::get() noexcept
+    { return cp; }
+
+
+    constexpr code_point::operator u32() const noexcept
+    { return cp; }
+
+
+    // -- utf8 helper funcs
+
+
+    constexpr i32 code_units_encoded(const code_unit* lead) noexcept(!Envy::debug)
+    {
+        if constexpr (Envy::debug)
+        {
+            if(!is_lead_unit(lead))
+            { detail::invalid_utf8("Invalid UTF-8"); }
+        }
+
+        i32 units {std::countl_one(*lead)};
+        return units + (units?0:1);
+    }
+
+
+    constexpr i32 code_units_required(code_point cp) noexcept
+    {
+        i32 code_units {1};
+        if( static_cast<u32>(cp) > 0x007Fu) ++code_units;
+        if( static_cast<u32>(cp) > 0x07FFu) ++code_units;
+        if( static_cast<u32>(cp) > 0xFFFFu) ++code_units;
+        return code_units;
+    }
+
+
+    constexpr i32 count_code_points(std::string_view str) noexcept
+    {
+        if(std::is_constant_evaluated())
+        {
+            i32 count {};
+
+            for(const char c : str)
+            { count += (static_cast<code_unit>(c) >> detail::bits_per_continuation_unit) != 0b10; }
+
+            return count;
+        }
+
+        return count_code_points(reinterpret_cast<const code_unit*>(str.data()), str.size());
+    }
+
+
+    constexpr bool is_lead_unit(const code_unit* unit) noexcept
+    {
+        // must begin with 0, 2, 3, or 4 ones
+        i32 ones {std::countl_one(*unit)};
+        return ones != 1 && ones < 5;
+    }
+
+
+    constexpr bool is_continuation_unit(const code_unit* unit) noexcept
+    {
+        // first two bits must be '10'
+        return (*unit >> detail::bits_per_continuation_unit) == 0b10;
+    }
+
+
+    constexpr bool is_valid_char(const code_unit* lead) noexcept
+    {
+        int units {std::countl_one(*lead)};
+
+        if(units == 1 || units > 4)
+        { return false; }
+
+        units -= (units?1:0);
+
+        ++lead;
+
+        for(int i {}; i < units; ++i)
+        {
+            if(!is_continuation_unit(lead))
+            { return false; }
+            ++lead;
+        }
+
+        return true;
+    }
+
+
+    constexpr void increment_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug)
+    {
+        *lead_ptr += code_units_encoded(*lead_ptr);
+    }
+
+
+    constexpr void decrement_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug)
+    {
+        do { --(*lead_ptr); } while (is_continuation_unit(*lead_ptr));
+    }
+
+
+    constexpr void increment_ptr(code_unit** lead_ptr) noexcept(!Envy::debug)
+    { *lead_ptr += code_units_encoded(*lead_ptr); }
+
+
+    constexpr void decrement_ptr(code_unit** lead_ptr) noexcept(!Envy::debug)
+    { do { --(*lead_ptr); } while (is_continuation_unit(*lead_ptr)); }
+
+
+    constexpr code_point decode(const code_unit* lead) noexcept(!Envy::debug)
+    {
+        if constexpr (Envy::debug)
+        {
+            if(lead == nullptr)
+            { detail::invalid_utf8("Trying to decode nullptr"); }
+        }
+
+        // the DFA rejects a truncated sequence at the null-terminator and decoding stops there,
+        // so no unit past the terminator is read
+        const detail::sequence s {detail::decode_sequence(lead, 4u)};
+
+        if constexpr (Envy::debug)
+        {
+            if(!s.valid)
+            { detail::invalid_utf8("Trying to decode invalid UTF-8"); }
+        }
+
+        return code_point {s.cp};
+    }
+
+
+    constexpr decode_result decode_checked(const code_unit* lead, usize available) noexcept
+    {
+        if(lead == nullptr || available == 0u)
+        { return { code_point {0xFFFDu}, 0, false }; }
+
+        const detail::sequence s {detail::decode_sequence(lead, available)};
+
+        return { code_point {s.cp}, static_cast<i32>(s.length), s.valid };
+    }
+
+
+    constexpr void encode(code_point cp, code_unit* ptr) noexcept(!Envy::debug)
+    {
+        if constexpr (Envy::debug)
+        {
+            if(ptr == nullptr)
+            { detail::invalid_utf8("Trying to encode to nullptr"); }
+        }
+
+        const u32 codepoint {cp.get()};
+
+        const i32 continuation_units { code_units_required(cp) - 1 };
+        const i32 continuation_bits  { detail::bits_per_continuation_unit * continuation_units };
+
+        // -- encode first code_unit
+
+        switch(continuation_units)
+        {
+            // ascii
+            case 0: *ptr = (code_unit) codepoint; return;
+
+            case 1: *ptr = detail::f2_prefix | (static_cast<code_unit>(codepoint >> continuation_bits) & detail::l2_mask); break;
+            case 2: *ptr = detail::f3_prefix | (static_cast<code_unit>(codepoint >> continuation_bits) & detail::l3_mask); break;
+            case 3: *ptr = detail::f4_prefix | (static_cast<code_unit>(codepoint >> continuation_bits) & detail::l4_mask); break;
+        }
+
+        // -- encode continuation units
+
+        for(i32 i {1}; i <= continuation_units; ++i)
+        {
+            ++ptr;
+
+            // number of bits we need to shift to get to this code unit's data
+            i32 bits { detail::bits_per_continuation_unit * (continuation_units - i) };
+
+            *ptr = detail::c_prefix | ( static_cast<code_unit>(codepoint >> bits) & detail::c_mask );
+        }
+    }
+
+
+    constexpr code_point next_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug)
+    {
+        const detail::sequence s {detail::decode_sequence(*lead_ptr, 4u)};
+
+        if constexpr (Envy::debug)
+        {
+            if(!s.valid)
+            { detail::invalid_utf8("Trying to decode invalid UTF-8"); }
+        }
+
+        *lead_ptr += s.length;
+        return code_point {s.cp};
+    }
+
+
+    constexpr code_point prev_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug)
+    {
+        code_point cp {decode(*lead_ptr)};
+        decrement_ptr(lead_ptr);
+        return cp;
+    }
+
+
+    constexpr bool is_valid_utf8(std::string_view str) noexcept
+    {
+        if(std::is_constant_evaluated())
+        {
+            for(usize i {}; i < str.size();)
+            {
+                const detail::sequence s {detail::decode_sequence(str.data() + i, str.size() - i)};
+
+                if(!s.valid)
+                { return false; }
+
+                i += s.length;
+            }
+
+            return true;
+        }
+
+        return is_valid_utf8(reinterpret_cast<const code_unit*>(str.data()), str.size());
+    }
+
+
+    // -- Envy::utf8::iterator
+
+
+    constexpr iterator::iterator() noexcept :
+        ptr {nullptr}
+    {}
+
+
+    constexpr iterator::iterator(const code_unit* p) noexcept :
+        ptr {p}
+    {}
+
+
+    constexpr iterator& iterator::operator++() noexcept(!Envy::debug)
+    {
+        // the cache is mutable, which constant expressions may not read
+        if(std::is_constant_evaluated())
+        {
+            increment_ptr(&ptr);
+            return *this;
+        }
+
+        // a dereference has already measured the code point
+        if(cached_length != 0u)
+        { ptr += cached_length; }
+        else
+        { increment_ptr(&ptr); }
+
+        cached_length = 0u;
+        return *this;
+    }
+
+
+    constexpr iterator iterator::operator++(int) noexcept(!Envy::debug)
+    {
+        iterator i {*this};
+        ++(*this);
+        return i;
+    }
+
+
+    constexpr iterator& iterator::operator--() noexcept(!Envy::debug)
+    {
+        decrement_ptr(&ptr);
+
+        if(!std::is_constant_evaluated())
+        { cached_length = 0u; }
+
+        return *this;
+    }
+
+
+    constexpr iterator iterator::operator--(int) noexcept(!Envy::debug)
+    {
+        iterator i {*this};
+        --(*this);
+        return i;
+    }
+
+
+    constexpr iterator::value_type iterator::operator*() const noexcept(!Envy::debug)
+    {
+        if(std::is_constant_evaluated())
+        { return decode(ptr); }
+
+        if(cached_length == 0u)
+        {
+            const detail::sequence s {detail::decode_sequence(ptr, 4u)};
+
+            if constexpr (Envy::debug)
+            {
+                if(!s.valid)
+                { detail::invalid_utf8("Trying to decode invalid UTF-8"); }
+            }
+
+            cached = code_point {s.cp};
+            cached_length = static_cast<u8>(s.length);
+        }
+
+        return cached;
+    }
+
+
+    constexpr bool iterator::operator==(const iterator& other) const noexcept
+    {
+        return ptr == other.ptr;
+    }
+
+
+    constexpr const code_unit* iterator_ptr(const iterator& i) noexcept
+    { return i.ptr; }
+
+
+    constexpr usize iterator_distance_bytes(const iterator& i1, const iterator& i2) noexcept
+    {
+        return (usize) (i1.ptr - i2.ptr);
+    }
+
+}
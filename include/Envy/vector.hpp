@@ -136,7 +136,7 @@ namespace Envy
         [[nodiscard]]
         std::string to_string() const
         {
-            return std::format("({},{})",x,y);
+            return std::format("{}",*this);
         }
 
 
@@ -291,4 +291,27 @@ namespace Envy
     [[nodiscard]]
     auto operator ^ (vector2<T> left, const vector2<U>& right)
     { return left ^= right; }
-}
\ No newline at end of file
+}
+
+
+// formats as (x,y), the format spec applies to each component
+template <Envy::numeric T>
+struct std::formatter<Envy::vector2<T>, char> : std::formatter<T, char>
+{
+    template <typename FormatContext>
+    auto format(const Envy::vector2<T>& vec, FormatContext& ctx) const
+    {
+        auto out {ctx.out()};
+
+        *out++ = '(';
+        ctx.advance_to(out);
+        out = std::formatter<T, char>::format(vec.x, ctx);
+
+        *out++ = ',';
+        ctx.advance_to(out);
+        out = std::formatter<T, char>::format(vec.y, ctx);
+
+        *out++ = ')';
+        return out;
+    }
+};
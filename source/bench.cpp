@@ -26,6 +26,20 @@ namespace Envy
     { times.clear(); }
 
 
+    f64 bench::mean() const noexcept
+    {
+        if(times.empty())
+        { return 0.0; }
+
+        f64 sum {};
+
+        for(auto t : times)
+        { sum += t; }
+
+        return sum / (f64) times.size();
+    }
+
+
     std::string bench::to_string() const
     {
         if(times.empty())
@@ -20,7 +20,7 @@ namespace Envy
 
 
     const_buffer::operator bool() const noexcept
-    { return empty(); }
+    { return !empty(); }
 
 
     u8 const_buffer::operator[](usize i) const noexcept
@@ -104,7 +104,7 @@ namespace Envy
 
 
     mutable_buffer::operator bool() const noexcept
-    { return empty(); }
+    { return !empty(); }
 
 
     mutable_buffer::operator const_buffer() const noexcept
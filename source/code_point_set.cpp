@@ -0,0 +1,351 @@
+#include <code_point_set.hpp>
+#include <cpu.hpp>
+
+#include <algorithm>
+#include <bit>
+
+#if defined(ENVY_ARCH_X86)
+    #include <immintrin.h>
+#endif
+
+namespace Envy::utf8
+{
+
+    // ==== scan kernels ====
+
+
+    namespace
+    {
+        // decodes the sequence at 'at' and tests it against the set, returns
+        // true if it matched what the scan is looking for
+        bool test_sequence(const code_point_set& set, const code_unit* at, const code_unit* last, bool member, usize& length) noexcept
+        {
+            const decode_result r {decode_checked(at, static_cast<usize>(last - at))};
+            length = static_cast<usize>(r.length);
+            return set.contains(r.cp) == member;
+        }
+
+
+        const code_unit* scan_scalar(const code_point_set& set, const u64* ascii, const code_unit* p, const code_unit* last, bool member) noexcept
+        {
+            while(p < last)
+            {
+                if(*p < 0x80u)
+                {
+                    if((((ascii[*p >> 6u] >> (*p & 63u)) & 1u) != 0u) == member)
+                    { return p; }
+
+                    ++p;
+                    continue;
+                }
+
+                usize length {};
+                if(test_sequence(set, p, last, member, length))
+                { return p; }
+
+                p += length;
+            }
+
+            return nullptr;
+        }
+
+
+        // 'non_members' has a bit set for each byte of a block that is not an ASCII member,
+        // multi-unit sequences included. Returns the match in the block, or nullptr with
+        // 'p' advanced to where scanning should resume
+        const code_unit* resolve_block(const code_point_set& set, const code_unit*& p, const code_unit* last,
+            u32 non_members, u32 wide, usize block, bool has_ranges, bool member) noexcept
+        {
+            const u32 block_mask {block == 32u ? ~0u : (1u << block) - 1u};
+
+            // without ranges a multi-unit sequence is never a member, so it only stops a search for non-members
+            u32 stops {(member ? ~non_members | (has_ranges ? wide : 0u) : non_members) & block_mask};
+
+            while(stops != 0u)
+            {
+                const usize index {static_cast<usize>(std::countr_zero(stops))};
+                const code_unit* at {p + index};
+
+                if(*at < 0x80u || !has_ranges)
+                { return at; }
+
+                usize length {};
+                if(test_sequence(set, at, last, member, length))
+                { return at; }
+
+                // the sequence may run into the next block
+                if(index + length >= block)
+                {
+                    p = at + length;
+                    return nullptr;
+                }
+
+                stops &= ~0u << (index + length);
+            }
+
+            p += block;
+            return nullptr;
+        }
+
+
+        #if defined(ENVY_ARCH_X86)
+
+        // ASCII membership without byte shuffles, each run of members is two signed compares.
+        // multi-unit sequences are negative as signed bytes and fall outside every run
+        ENVY_TARGET_SSE2 const code_unit* scan_sse2(const code_point_set& set, const u64* ascii, const code_point_set::range* runs, usize run_count,
+            bool has_ranges, const code_unit* p, const code_unit* last, bool member) noexcept
+        {
+            std::array<__m128i, 8> above;
+            std::array<__m128i, 8> beyond;
+
+            for(usize r {}; r < run_count; ++r)
+            {
+                above[r] = _mm_set1_epi8(static_cast<char>(runs[r].first - 1u));
+                beyond[r] = _mm_set1_epi8(static_cast<char>(runs[r].last));
+            }
+
+            while(last - p >= 16)
+            {
+                const __m128i v {_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+
+                __m128i members {_mm_setzero_si128()};
+
+                for(usize r {}; r < run_count; ++r)
+                { members = _mm_or_si128(members, _mm_andnot_si128(_mm_cmpgt_epi8(v, beyond[r]), _mm_cmpgt_epi8(v, above[r]))); }
+
+                const u32 non_members {~static_cast<u32>(_mm_movemask_epi8(members)) & 0xFFFFu};
+                const u32 wide {static_cast<u32>(_mm_movemask_epi8(v))};
+
+                if(const auto* found {resolve_block(set, p, last, non_members, wide, 16u, has_ranges, member)})
+                { return found; }
+            }
+
+            return scan_scalar(set, ascii, p, last, member);
+        }
+
+
+        // ASCII membership as a two level nibble lookup, the low nibble selects a row of
+        // the bitmap and the high nibble a bit in it. High nibbles of multi-unit
+        // sequences select no bit
+        ENVY_TARGET_AVX2 const code_unit* scan_avx2(const code_point_set& set, const u64* ascii, const u8* nibble_rows,
+            bool has_ranges, const code_unit* p, const code_unit* last, bool member) noexcept
+        {
+            const __m256i rows {_mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(nibble_rows)))};
+            const __m256i bits {_mm256_setr_epi8(
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0,
+                1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0
+            )};
+            const __m256i low_nibble {_mm256_set1_epi8(0x0F)};
+
+            while(last - p >= 32)
+            {
+                const __m256i v {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))};
+
+                const __m256i row {_mm256_shuffle_epi8(rows, _mm256_and_si256(v, low_nibble))};
+                const __m256i bit {_mm256_shuffle_epi8(bits, _mm256_and_si256(_mm256_srli_epi16(v, 4), low_nibble))};
+
+                const u32 non_members {static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_and_si256(row, bit), _mm256_setzero_si256())))};
+                const u32 wide {static_cast<u32>(_mm256_movemask_epi8(v))};
+
+                if(const auto* found {resolve_block(set, p, last, non_members, wide, 32u, has_ranges, member)})
+                { return found; }
+            }
+
+            return scan_scalar(set, ascii, p, last, member);
+        }
+
+        #endif
+    }
+
+
+    // ==== Envy::utf8::code_point_set ====
+
+
+    code_point_set::code_point_set(Envy::string_view characters)
+    {
+        insert(characters);
+    }
+
+
+    code_point_set::code_point_set(code_point first, code_point last)
+    {
+        insert(first, last);
+    }
+
+
+    code_point_set& code_point_set::insert(code_point cp)
+    {
+        insert_range(static_cast<u32>(cp), static_cast<u32>(cp));
+        update_tables();
+        return *this;
+    }
+
+
+    code_point_set& code_point_set::insert(code_point first, code_point last)
+    {
+        insert_range(static_cast<u32>(first), static_cast<u32>(last));
+        update_tables();
+        return *this;
+    }
+
+
+    code_point_set& code_point_set::insert(Envy::string_view characters)
+    {
+        const code_unit* p {characters.data()};
+        const code_unit* const last {p + characters.size_bytes()};
+
+        while(p < last)
+        {
+            if(*p < 0x80u)
+            {
+                ascii[*p >> 6u] |= u64 {1u} << (*p & 63u);
+                ++p;
+                continue;
+            }
+
+            const decode_result r {decode_checked(p, static_cast<usize>(last - p))};
+            insert_range(static_cast<u32>(r.cp), static_cast<u32>(r.cp));
+            p += r.length;
+        }
+
+        update_tables();
+        return *this;
+    }
+
+
+    bool code_point_set::contains(code_point cp) const noexcept
+    {
+        const u32 value {static_cast<u32>(cp)};
+
+        if(value < 0x80u)
+        { return ((ascii[value >> 6u] >> (value & 63u)) & 1u) != 0u; }
+
+        const auto it {std::upper_bound(ranges.begin(), ranges.end(), value, [](u32 v, const range& r){ return v < r.first; })};
+        return it != ranges.begin() && value <= std::prev(it)->last;
+    }
+
+
+    usize code_point_set::size() const noexcept
+    {
+        return count;
+    }
+
+
+    bool code_point_set::empty() const noexcept
+    {
+        return count == 0u;
+    }
+
+
+    const code_unit* code_point_set::find_first_of(const code_unit* buffer, usize size_bytes) const noexcept
+    {
+        return scan(buffer, size_bytes, true);
+    }
+
+
+    const code_unit* code_point_set::find_first_not_of(const code_unit* buffer, usize size_bytes) const noexcept
+    {
+        return scan(buffer, size_bytes, false);
+    }
+
+
+    iterator code_point_set::find_first_of(Envy::string_view str) const noexcept
+    {
+        const code_unit* found {scan(str.data(), str.size_bytes(), true)};
+        return found ? iterator {found} : str.end();
+    }
+
+
+    iterator code_point_set::find_first_not_of(Envy::string_view str) const noexcept
+    {
+        const code_unit* found {scan(str.data(), str.size_bytes(), false)};
+        return found ? iterator {found} : str.end();
+    }
+
+
+    void code_point_set::insert_range(u32 first, u32 last)
+    {
+        last = std::min(last, 0x10FFFFu);
+
+        for(; first < 0x80u && first <= last; ++first)
+        { ascii[first >> 6u] |= u64 {1u} << (first & 63u); }
+
+        if(first > last)
+        { return; }
+
+        // merge with every range that overlaps or touches [first, last]
+        const auto begin {std::lower_bound(ranges.begin(), ranges.end(), first, [](const range& r, u32 v){ return r.last + 1u < v; })};
+        auto end {begin};
+
+        for(; end != ranges.end() && end->first <= last + 1u; ++end)
+        {
+            first = std::min(first, end->first);
+            last = std::max(last, end->last);
+        }
+
+        if(begin == end)
+        { ranges.insert(begin, range {first, last}); }
+        else
+        {
+            *begin = range {first, last};
+            ranges.erase(std::next(begin), end);
+        }
+    }
+
+
+    void code_point_set::update_tables() noexcept
+    {
+        count = static_cast<usize>(std::popcount(ascii[0]) + std::popcount(ascii[1]));
+
+        for(const auto& r : ranges)
+        { count += r.last - r.first + 1u; }
+
+        nibble_rows.fill(0u);
+        ascii_run_count = 0u;
+
+        for(u32 cp {}; cp < 0x80u; ++cp)
+        {
+            if(((ascii[cp >> 6u] >> (cp & 63u)) & 1u) == 0u)
+            { continue; }
+
+            nibble_rows[cp & 0x0Fu] |= static_cast<u8>(1u << (cp >> 4u));
+
+            if(ascii_run_count == 0xFFu)
+            { continue; }
+
+            if(ascii_run_count > 0u && ascii_runs[ascii_run_count - 1u].last + 1u == cp)
+            { ascii_runs[ascii_run_count - 1u].last = cp; }
+            else if(ascii_run_count < ascii_runs.size())
+            { ascii_runs[ascii_run_count++] = range {cp, cp}; }
+            else
+            { ascii_run_count = 0xFFu; }
+        }
+    }
+
+
+    const code_unit* code_point_set::scan(const code_unit* buffer, usize size_bytes, bool member) const noexcept
+    {
+        if(size_bytes == 0u || (member && count == 0u))
+        { return nullptr; }
+
+        const code_unit* const last {buffer + size_bytes};
+        const bool has_ranges {!ranges.empty()};
+
+        #if defined(ENVY_ARCH_X86)
+        switch(cpu::active_simd_level())
+        {
+            case cpu::simd_level::avx2:
+                return scan_avx2(*this, ascii.data(), nibble_rows.data(), has_ranges, buffer, last, member);
+            case cpu::simd_level::sse2:
+                if(ascii_run_count <= ascii_runs.size())
+                { return scan_sse2(*this, ascii.data(), ascii_runs.data(), ascii_run_count, has_ranges, buffer, last, member); }
+                return scan_scalar(*this, ascii.data(), buffer, last, member);
+            default:
+                return scan_scalar(*this, ascii.data(), buffer, last, member);
+        }
+        #else
+        return scan_scalar(*this, ascii.data(), buffer, last, member);
+        #endif
+    }
+
+}
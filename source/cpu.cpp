@@ -0,0 +1,84 @@
+#include <cpu.hpp>
+
+#include <atomic>
+#include <algorithm>
+
+#if defined(ENVY_ARCH_X86) && defined(_MSC_VER)
+    #include <intrin.h>
+    #include <immintrin.h>
+#endif
+
+namespace Envy::cpu
+{
+
+    namespace
+    {
+        std::atomic<simd_level> simd_limit {simd_level::avx2};
+
+
+        simd_level detect() noexcept
+        {
+            #if defined(ENVY_ARCH_X86) && defined(_MSC_VER)
+
+                int info[4] {};
+
+                __cpuid(info, 0);
+                const int max_leaf {info[0]};
+
+                __cpuid(info, 1);
+                const bool sse2    { (info[3] & (1 << 26)) != 0 };
+                const bool osxsave { (info[2] & (1 << 27)) != 0 };
+                const bool avx     { (info[2] & (1 << 28)) != 0 };
+
+                if(!sse2)
+                { return simd_level::scalar; }
+
+                // the OS must also save the upper halves of the ymm registers on context switch
+                if(max_leaf < 7 || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+                { return simd_level::sse2; }
+
+                __cpuidex(info, 7, 0);
+                const bool avx2 { (info[1] & (1 << 5)) != 0 };
+
+                return avx2 ? simd_level::avx2 : simd_level::sse2;
+
+            #elif defined(ENVY_ARCH_X86) && (defined(__GNUC__) || defined(__clang__))
+
+                __builtin_cpu_init();
+
+                if(__builtin_cpu_supports("avx2"))
+                { return simd_level::avx2; }
+
+                if(__builtin_cpu_supports("sse2"))
+                { return simd_level::sse2; }
+
+                return simd_level::scalar;
+
+            #else
+
+                return simd_level::scalar;
+
+            #endif
+        }
+    }
+
+
+    simd_level detected_simd_level() noexcept
+    {
+        static const simd_level level {detect()};
+        return level;
+    }
+
+
+    simd_level active_simd_level() noexcept
+    {
+        return std::min(detected_simd_level(), simd_limit.load(std::memory_order_relaxed));
+    }
+
+
+    void limit_simd_level(simd_level level) noexcept
+    {
+        simd_limit.store(level, std::memory_order_relaxed);
+    }
+
+}
@@ -2,6 +2,7 @@
 
 #include <graphics.hpp>
 #include <event.hpp>
+#include <frame_arena.hpp>
 
 #include <thread>
 #include <chrono>
@@ -28,6 +29,9 @@ namespace Envy::engine
         // main loop
         while(window::is_open())
         {
+            // frees last frame's transient allocations
+            frame::begin();
+
             // update input state / dispach system events
             Envy::dispach_events();
 
@@ -43,7 +47,8 @@ namespace Envy::engine
         Envy::info("Application exited")
              .note("runtime: {}", runtime)
              .note("{LRED}errors: {}",   Envy::log::errors())
-             .note("{LYEL}warnings: {}", Envy::log::warnings());
+             .note("{LYEL}warnings: {}", Envy::log::warnings())
+             .note("frame arena peak: {} bytes, overflows: {}", frame::arena().stats().peak, frame::arena().stats().overflows);
     }
 
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <event.hpp>
+#include <frame_arena.hpp>
 
 #include <map>
 #include <memory>
@@ -13,9 +14,22 @@ namespace Envy
         std::map<listener_id,event_callback> listener_callbacks;
         std::multimap<event_type, listener_id> listeners;
 
-        using event_queue_entry = std::pair<event_type, std::unique_ptr<const event>>;
+        // queued events live in event_arena, only their destructors need to run
+        struct destroy_event
+        {
+            void operator()(const event* e) const noexcept
+            { e->~event(); }
+        };
+
+        using event_queue_entry = std::pair<event_type, std::unique_ptr<const event, destroy_event>>;
         std::vector<event_queue_entry> event_queue;
         std::mutex event_queue_mutex;
+
+        // guarded by event_queue_mutex, reset once the queue is dispatched
+        frame_arena event_arena {16u * 1024u};
+
+        // events whose storage is reserved but whose constructor is still running, guarded by event_queue_mutex
+        usize events_in_construction {0};
     }
 
 
@@ -49,10 +63,33 @@ namespace Envy
     }
 
 
-    void queue_event(event_type event_ty, const event* e)
+    void queue_event(event_type event_ty, usize size, usize alignment, const event* (*construct)(void* storage, void* args), void* args)
     {
+        void* storage {nullptr};
+
+        {
+            std::scoped_lock<std::mutex> l {event_queue_mutex};
+            storage = event_arena.allocate(size, alignment);
+            ++events_in_construction;
+        }
+
+        // the event's constructor runs unlocked so it may log or post events of its own
+        const event* constructed {nullptr};
+
+        try
+        { constructed = construct(storage, args); }
+        catch(...)
+        {
+            std::scoped_lock<std::mutex> l {event_queue_mutex};
+            --events_in_construction;
+            throw;
+        }
+
+        std::unique_ptr<const event, destroy_event> e {constructed};
+
         std::scoped_lock<std::mutex> l {event_queue_mutex};
-        event_queue.emplace_back(event_ty, std::unique_ptr<const event>(e));
+        --events_in_construction;
+        event_queue.emplace_back(event_ty, std::move(e));
     }
 
 
@@ -85,5 +122,9 @@ namespace Envy
         }
 
         event_queue.clear();
+
+        // storage handed out to a constructor still running elsewhere must survive, the next dispatch resets instead
+        if(events_in_construction == 0u)
+        { event_arena.reset(); }
     }
 }
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include <frame_arena.hpp>
+#include <log.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+
+namespace Envy
+{
+
+    //**********************************************************************
+    frame_arena::frame_arena(usize capacity, std::pmr::memory_resource* upstream) :
+        upstream {upstream}
+    {
+        allocate_block(capacity);
+    }
+
+
+    //**********************************************************************
+    frame_arena::~frame_arena()
+    {
+        for(const auto& o : overflowed)
+        { upstream->deallocate(o.ptr, o.bytes, o.alignment); }
+
+        if(block != nullptr)
+        { upstream->deallocate(block, block_size, alignof(std::max_align_t)); }
+    }
+
+
+    //**********************************************************************
+    void frame_arena::reset()
+    {
+        for(const auto& o : overflowed)
+        { upstream->deallocate(o.ptr, o.bytes, o.alignment); }
+
+        overflowed.clear();
+
+        // a frame this large should fit next time
+        if(counters.used > block_size)
+        { allocate_block(std::bit_ceil(counters.used)); }
+        else if(Envy::debug && offset > 0u)
+        { std::memset(block, poison, offset); }
+
+        counters.last_frame_used = counters.used;
+        counters.peak = std::max(counters.peak, counters.used);
+        counters.used = 0u;
+        counters.allocations = 0u;
+        ++counters.frames;
+
+        offset = 0u;
+    }
+
+
+    //**********************************************************************
+    usize frame_arena::capacity() const noexcept
+    {
+        return block_size;
+    }
+
+
+    //**********************************************************************
+    const frame_arena::statistics& frame_arena::stats() const noexcept
+    {
+        return counters;
+    }
+
+
+    //**********************************************************************
+    void* frame_arena::do_allocate(std::size_t bytes, std::size_t alignment)
+    {
+        ++counters.allocations;
+
+        // align the address rather than the offset, the block is only aligned to max_align_t
+        const auto base {reinterpret_cast<std::uintptr_t>(block)};
+        const usize start {static_cast<usize>(((base + offset + alignment - 1u) & ~(alignment - 1u)) - base)};
+
+        if(block != nullptr && start + bytes <= block_size)
+        {
+            std::byte* const ptr {block + start};
+
+            if constexpr (Envy::debug)
+            {
+                const bool untouched {std::all_of(ptr, ptr + bytes, [](std::byte b){ return b == std::byte {poison}; })};
+                Envy::debug_assert(untouched, "Envy::frame_arena memory was written to after it was freed");
+            }
+
+            counters.used += start + bytes - offset;
+            offset = start + bytes;
+            return ptr;
+        }
+
+        void* const ptr {upstream->allocate(bytes, alignment)};
+
+        try
+        { overflowed.push_back({ptr, bytes, alignment}); }
+        catch(...)
+        {
+            upstream->deallocate(ptr, bytes, alignment);
+            throw;
+        }
+
+        counters.used += bytes;
+        ++counters.overflows;
+        return ptr;
+    }
+
+
+    //**********************************************************************
+    void frame_arena::do_deallocate(void* ptr, std::size_t bytes, std::size_t)
+    {
+        // memory is only reclaimed by reset()
+        if constexpr (Envy::debug)
+        { std::memset(ptr, poison, bytes); }
+    }
+
+
+    //**********************************************************************
+    bool frame_arena::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+    {
+        return this == &other;
+    }
+
+
+    //**********************************************************************
+    void frame_arena::allocate_block(usize bytes)
+    {
+        if(block != nullptr)
+        {
+            upstream->deallocate(block, block_size, alignof(std::max_align_t));
+            block = nullptr;
+            block_size = 0u;
+        }
+
+        if(bytes == 0u)
+        { return; }
+
+        block = static_cast<std::byte*>(upstream->allocate(bytes, alignof(std::max_align_t)));
+        block_size = bytes;
+
+        if constexpr (Envy::debug)
+        { std::memset(block, poison, block_size); }
+    }
+
+
+    //**********************************************************************
+    double_frame_arena::double_frame_arena(usize capacity, std::pmr::memory_resource* upstream) :
+        arenas {frame_arena {capacity, upstream}, frame_arena {capacity, upstream}}
+    { }
+
+
+    //**********************************************************************
+    void double_frame_arena::flip()
+    {
+        current_index ^= 1u;
+        arenas[current_index].reset();
+    }
+
+
+    //**********************************************************************
+    frame_arena& double_frame_arena::current() noexcept
+    {
+        return arenas[current_index];
+    }
+
+
+    //**********************************************************************
+    const frame_arena& double_frame_arena::previous() const noexcept
+    {
+        return arenas[current_index ^ 1u];
+    }
+
+
+    namespace frame
+    {
+
+        //**********************************************************************
+        frame_arena& arena()
+        {
+            static frame_arena a {256u * 1024u};
+            return a;
+        }
+
+
+        //**********************************************************************
+        double_frame_arena& double_buffered()
+        {
+            static double_frame_arena a {64u * 1024u};
+            return a;
+        }
+
+
+        //**********************************************************************
+        void begin()
+        {
+            arena().reset();
+            double_buffered().flip();
+        }
+
+    }
+
+}
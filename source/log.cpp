@@ -9,8 +9,13 @@
 #include <fstream>
 #include <sstream>
 #include <mutex>
+#include <array>
+#include <algorithm>
+#include <memory_resource>
 
 #include <string.hpp>
+#include <string_builder.hpp>
+#include <unicode.hpp>
 #include <macro.hpp>
 #include <exception.hpp>
 
@@ -74,7 +79,7 @@ namespace Envy::log
 
         message_source  msg_source;
         severity        msg_severity;
-        Envy::string    msg_logger;
+        Envy::string_id msg_logger;
 
         // -- macros
 
@@ -91,11 +96,12 @@ namespace Envy::log
 
 
     static [[nodiscard]] Envy::string indent_string();
-    static [[nodiscard]] Envy::string process_message(Envy::string_view msg);
+    static void process_message(Envy::string_builder& logmsg, Envy::string_view msg);
 
-    static [[nodiscard]] Envy::string build_preamble();
-    static [[nodiscard]] Envy::string expand_column(column column, Envy::string macro, column_description desc);
+    static void build_preamble(Envy::string_builder& preamble);
+    static void expand_column(Envy::string_builder& preamble, column column, Envy::string_id macro, column_description desc);
     static [[nodiscard]] Envy::string color_str(color c);
+    static void append_color(Envy::string_builder& b, color c);
 
     static [[nodiscard]] void build_column_color_cache();
     static [[nodiscard]] void determine_preamble_width();
@@ -117,22 +123,22 @@ namespace Envy::log
 
 
     //**********************************************************************
-    logger::logger(Envy::string name) noexcept :
-        name {std::move(name)}
+    logger::logger(Envy::string name) :
+        name {Envy::string_id{name}}
     { }
 
 
     //**********************************************************************
-    logger::logger(Envy::string name, Envy::string log_file) noexcept :
-        name     {std::move(name)},
-        logfile  {std::move(log_file)}
+    logger::logger(Envy::string name, Envy::string_view log_file) :
+        name     {Envy::string_id{name}},
+        logfile  {log_file}
     { }
 
 
     //**********************************************************************
-    logger::logger(Envy::string name, Envy::string log_file, bool console) noexcept :
-        name             { std::move(name) },
-        logfile          { std::move(log_file) },
+    logger::logger(Envy::string name, Envy::string_view log_file, bool console) :
+        name             { Envy::string_id{name} },
+        logfile          { log_file },
         console_logging  { console }
     { }
 
@@ -217,14 +223,15 @@ namespace Envy::log
             }
 
             printl(header_underline);
-            printl(header + name);
+            print(header);
+            printl(name);
             printl(header_underline);
         }
 
         if(!logfile.empty())
         {
             std::ofstream fs;
-            fs.open(logfile, std::ios::app);
+            fs.open(logfile.c_str(), std::ios::app);
 
             fs << header_underline << '\n';
             fs << header << name <<'\n';
@@ -241,7 +248,7 @@ namespace Envy::log
 
 
     //**********************************************************************
-    Envy::string logger::get_file() const noexcept
+    Envy::shared_string logger::get_file() const noexcept
     { return logfile; }
 
 
@@ -251,8 +258,8 @@ namespace Envy::log
 
 
     //**********************************************************************
-    void logger::set_file(Envy::string file) noexcept
-    { logfile = std::move(file); }
+    void logger::set_file(Envy::string_view file)
+    { logfile = Envy::shared_string {file}; }
 
 
     //**********************************************************************
@@ -261,7 +268,7 @@ namespace Envy::log
         if(!logfile.empty())
         {
             std::ofstream fs;
-            fs.open(logfile, std::ios::trunc);
+            fs.open(logfile.c_str(), std::ios::trunc);
             fs.close();
         }
     }
@@ -272,6 +279,11 @@ namespace Envy::log
 
     //**********************************************************************
     Envy::string_view logger::get_name()
+    { return name.view(); }
+
+
+    //**********************************************************************
+    Envy::string_id logger::get_id() const noexcept
     { return name; }
 
 
@@ -279,8 +291,8 @@ namespace Envy::log
     scope_logger::scope_logger(Envy::string msg, logger& l, std::source_location loc) :
         log {l}
     {
-        update_log_state(log.get_name(), severity::scope, loc);
-        raw_log(log.get_file(), log.logs_to_console(), expand_macros("{{ " + color_str(desc.border_color) + msg, log_macros));
+        update_log_state(log.get_id(), severity::scope, loc);
+        raw_log(log.get_file(), log.logs_to_console(), expand_macros(("{{ " + color_str(desc.border_color) + msg).str(), log_macros));
         indent_log();
         t = std::chrono::high_resolution_clock::now();
     }
@@ -291,8 +303,10 @@ namespace Envy::log
     {
         std::chrono::duration<f64> delta { std::chrono::high_resolution_clock::now() - t };
         unindent_log();
-        update_log_state(log.get_name(), severity::scope, {});
-        raw_log(log.get_file(), log.logs_to_console(), expand_macros("} " + color_str(desc.border_color) + std::format("{}", delta), log_macros));
+        update_log_state(log.get_id(), severity::scope, {});
+        Envy::string line {("} " + color_str(desc.border_color)).str()};
+        Envy::format_to(line, "{}", delta);
+        raw_log(log.get_file(), log.logs_to_console(), expand_macros(line, log_macros));
     }
 
 
@@ -391,12 +405,17 @@ namespace Envy::log
 
     //**********************************************************************
     void update_log_state(Envy::string_view logger_name, severity sev, message_source loc)
+    {
+        update_log_state(Envy::string_id{logger_name}, sev, loc);
+    }
+
+
+    //**********************************************************************
+    void update_log_state(Envy::string_id logger_name, severity sev, message_source loc)
     {
         msg_source = loc;
         msg_severity = sev;
-
-        // TODO: Envy::string copy asign from std::strin and Envy::string_view
-        msg_logger = Envy::string(logger_name);
+        msg_logger = logger_name;
     }
 
 
@@ -427,17 +446,25 @@ namespace Envy::log
 
         // -- process message
 
-        Envy::string preamble { build_preamble() };
-        Envy::string logmsg { process_message(msg) };
+        // the line lives only for this call, so build it on the stack
+        // and only touch the heap for unusually long messages
+        std::array<std::byte, 2048> scratch;
+        std::pmr::monotonic_buffer_resource arena { scratch.data(), scratch.size() };
+
+        // record every piece first, then join them with a single allocation
+        Envy::string_builder builder { &arena };
+        build_preamble(builder);
+        builder.append(indent_string());
+        process_message(builder, msg);
+
+        const Envy::string line { builder.str() };
 
         // -- log message
 
         if(log_to_console)
         {
             std::scoped_lock l {console_mutex};
-            print(preamble);
-            print(indent_string());
-            print(logmsg);
+            print(line);
         }
 
         if(!logger_file.empty())
@@ -446,7 +473,7 @@ namespace Envy::log
             fs.open(logger_file, std::ios::app);
 
             // TODO: skip writing ansi escape sequences
-            fs << preamble << indent_string() << logmsg;
+            fs << line;
 
             fs.close();
         }
@@ -558,7 +585,7 @@ namespace Envy::log
                 header_underline += Envy::string ((std::size_t)desc.severity_column_desc.width,'-');
 
                 msg_severity = log::severity::note;
-                note_preamble += " " + clamp(log_macros.expand("severity",desc.severity_column_desc.fmt_spec), desc.severity_column_desc.width, desc.severity_column_desc.align, ' ') + " ";
+                note_preamble += " " + clamp(log_macros.expand("severity"_id,desc.severity_column_desc.fmt_spec), desc.severity_column_desc.width, desc.severity_column_desc.align, ' ') + " ";
                 break;
 
             }
@@ -574,43 +601,42 @@ namespace Envy::log
 
 
     //**********************************************************************
-    Envy::string build_preamble()
+    void build_preamble(Envy::string_builder& preamble)
     {
-        Envy::string preamble;
-
         for(auto column : desc.preamble)
         {
-            preamble += color_str(desc.border_color) + "| ";
+            append_color(preamble, desc.border_color);
+            preamble.append("| ");
 
             switch(column)
             {
-            case column::source_function:  preamble += expand_column(column::source_function, "func",     desc.func_column_desc);     break;
-            case column::source_file:      preamble += expand_column(column::source_file,     "file",     desc.file_column_desc);     break;
-            case column::source_line:      preamble += expand_column(column::source_line,     "line",     desc.line_column_desc);     break;
-            case column::source_column:    preamble += expand_column(column::source_column,   "col",      desc.col_column_desc);      break;
-            case column::datetime:         preamble += expand_column(column::datetime,        "datetime", desc.datetime_column_desc); break;
-            case column::logger_name:      preamble += expand_column(column::logger_name,     "logger",   desc.logger_column_desc);   break;
-            case column::severity:         preamble += expand_column(column::severity,        "severity", desc.severity_column_desc); break;
+            case column::source_function:  expand_column(preamble, column::source_function, "func"_id,     desc.func_column_desc);     break;
+            case column::source_file:      expand_column(preamble, column::source_file,     "file"_id,     desc.file_column_desc);     break;
+            case column::source_line:      expand_column(preamble, column::source_line,     "line"_id,     desc.line_column_desc);     break;
+            case column::source_column:    expand_column(preamble, column::source_column,   "col"_id,      desc.col_column_desc);      break;
+            case column::datetime:         expand_column(preamble, column::datetime,        "datetime"_id, desc.datetime_column_desc); break;
+            case column::logger_name:      expand_column(preamble, column::logger_name,     "logger"_id,   desc.logger_column_desc);   break;
+            case column::severity:         expand_column(preamble, column::severity,        "severity"_id, desc.severity_column_desc); break;
             }
 
-            preamble += color_str(desc.border_color) + " ";
+            append_color(preamble, desc.border_color);
+            preamble.append(' ');
         }
 
-        preamble += color_str(desc.border_color) + "| : " + message_color;
-
-        return preamble;
+        append_color(preamble, desc.border_color);
+        preamble.append("| : ").append(message_color);
     }
 
 
     //**********************************************************************
-    Envy::string expand_column(column column, Envy::string macro, column_description desc)
+    void expand_column(Envy::string_builder& preamble, column column, Envy::string_id macro, column_description desc)
     {
         auto expantion { log_macros.expand(macro, desc.fmt_spec) };
 
         // severity color changes per message, so we can't use the cached color string edit
-        Envy::string color { /* (macro=="severity") ? */ color_str(desc.color) /* : column_colors[static_cast<u8>(column)] */ };
+        append_color(preamble, desc.color);
 
-        return color + clamp(expantion, desc.width, desc.align, ' ');
+        preamble.append(clamp(expantion, desc.width, desc.align, ' '));
     }
 
 
@@ -626,27 +652,46 @@ namespace Envy::log
 
 
     //**********************************************************************
-    Envy::string process_message(Envy::string_view msg)
+    void append_color(Envy::string_builder& b, color c)
     {
-        Envy::string logmsg { Envy::string::reserve_tag , msg.size() * 2u };
+        if(c == color::severity)
+        { c = severity_colors[static_cast<u8>(msg_severity)]; }
 
+        b.append_format("\x1b[{}m", static_cast<u32>(c));
+    }
+
+
+    //**********************************************************************
+    void process_message(Envy::string_builder& logmsg, Envy::string_view msg)
+    {
         if(msg_severity == severity::note)
         {
-            logmsg += color_str(desc.border_color);
+            append_color(logmsg, desc.border_color);
         }
         else
         {
-            logmsg += color_str(desc.message_color);
+            append_color(logmsg, desc.message_color);
         }
 
         indent_log();
 
         // every newline is a note, so add the note preamble
-        logmsg += Envy::replace(msg, "\n", "\n" + color_str(desc.border_color) + note_preamble + indent_string() + color_str(desc.border_color)) + "\x1b[0m\n";
+        const utf8::code_unit* first {msg.data()};
+        const utf8::code_unit* const last {first + msg.size_bytes()};
 
-        unindent_log();
+        for(auto newline {std::find(first, last, '\n')}; newline != last; newline = std::find(first, last, '\n'))
+        {
+            logmsg.append(Envy::string_view {first, static_cast<usize>(newline - first)}).append('\n');
+            append_color(logmsg, desc.border_color);
+            logmsg.append(note_preamble).append(indent_string());
+            append_color(logmsg, desc.border_color);
+
+            first = newline + 1;
+        }
 
-        return logmsg;
+        logmsg.append(Envy::string_view {first, static_cast<usize>(last - first)}).append("\x1b[0m\n");
+
+        unindent_log();
     }
 
 
@@ -735,7 +780,7 @@ namespace Envy::log
     //**********************************************************************
     Envy::string logger_name_macro(Envy::string_view param)
     {
-        return std::format( build_fmt_str(param) , (std::string) msg_logger );
+        return std::format( build_fmt_str(param) , msg_logger.c_str() );
     }
 
 
@@ -748,7 +793,11 @@ namespace Envy::log
         if(s.empty())
         { return Envy::string { (usize) width, fill }; }
 
-        if(s.size() == width)
+        // columns, wide characters take two and combining marks none
+        const bool ascii { s.is_ascii() };
+        const i32 columns { ascii ? (i32) s.size() : (i32) utf8::display_width(s) };
+
+        if(columns == width)
         { return s; }
 
         Envy::string r { Envy::string::reserve_tag, (usize) width };
@@ -756,12 +805,12 @@ namespace Envy::log
         constexpr char cut[] { ".." };
 
 
-        if( width > s.size() )
+        if( width > columns )
         {
             // fill to width
 
             f64 a { static_cast<u8>(align) / 2.0 };
-            i32 f { width - (i32) s.size() };
+            i32 f { width - columns };
 
             i32 fill_right { (i32) std::floor( f * (1.0-a)) };
             i32 fill_left  { (i32)  std::ceil( f * (  a  )) };
@@ -776,26 +825,62 @@ namespace Envy::log
         {
             // cut to width
 
-            i32 c { (i32) s.size() - (width - ((i32) std::size(cut)-1)) };
+            const i32 keep { width - ((i32) std::size(cut)-1) };
 
+            // ascii is cut by byte offset rather than stepping over code points
             if(align == alignment::right)
             {
-                auto it {s.begin()};
+                auto it {s.end()};
+                i32 kept {0};
+
+                if(ascii)
+                { it = utf8::iterator(s.data() + s.size_bytes() - keep); kept = keep; }
+                else
+                {
+                    // a wide character straddling the cut is dropped and padded over
+                    for(auto prev {it}; it != s.begin(); it = prev)
+                    {
+                        const i32 w { (i32) utf8::display_width(*--prev) };
+
+                        if(kept + w > keep)
+                        { break; }
+
+                        kept += w;
+                    }
 
-                while(--c >= 0) ++it;
+                    // don't lead with marks whose base character was cut
+                    while(it != s.end() && utf8::display_width(*it) == 0u)
+                    { ++it; }
+                }
 
                 r += cut;
+                r += Envy::string( keep - kept, fill );
                 r += s.view_from(it);
 
                 return r;
             }
             else
             {
-                auto it {s.end()};
+                auto it {s.begin()};
+                i32 kept {0};
+
+                if(ascii)
+                { it = utf8::iterator(s.data() + keep); kept = keep; }
+                else
+                {
+                    for(; it != s.end(); ++it)
+                    {
+                        const i32 w { (i32) utf8::display_width(*it) };
+
+                        if(kept + w > keep)
+                        { break; }
 
-                while(--c >= 0) --it;
+                        kept += w;
+                    }
+                }
 
                 r += s.view_until(it);
+                r += Envy::string( keep - kept, fill );
                 r += cut;
 
                 return r;
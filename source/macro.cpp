@@ -1,8 +1,8 @@
 #include <macro.hpp>
+#include <unicode.hpp>
 
 #include <exception>
 #include <utility>
-#include <ctype.h>
 #include <format>
 
 namespace Envy
@@ -30,12 +30,21 @@ namespace Envy
     //**********************************************************************
     void macro_map::add(Envy::string_view name, macro_t m)
     {
-        macros.insert({Envy::string(name),m});
+        macros.insert({Envy::string_id(name),m});
     }
 
 
     //**********************************************************************
-    void macro_map::remove(const Envy::string& name)
+    void macro_map::remove(Envy::string_view name)
+    {
+        // a name that was never interned can't be in the map
+        if(auto id {Envy::string_id::find(name)})
+        { remove(*id); }
+    }
+
+
+    //**********************************************************************
+    void macro_map::remove(Envy::string_id name)
     {
         macros.erase(name);
     }
@@ -49,7 +58,17 @@ namespace Envy
 
 
     //**********************************************************************
-    macro_expantion_result macro_map::expand(const Envy::string& name, Envy::string_view fmt) const
+    macro_expantion_result macro_map::expand(Envy::string_view name, Envy::string_view fmt) const
+    {
+        if(auto id {Envy::string_id::find(name)})
+        { return expand(*id, fmt); }
+
+        return { "", false };
+    }
+
+
+    //**********************************************************************
+    macro_expantion_result macro_map::expand(Envy::string_id name, Envy::string_view fmt) const
     {
         auto it {macros.find(name)};
 
@@ -200,9 +219,15 @@ namespace Envy
     {
         macro_expantion_result r {};
 
+        // every macro name is interned when added, so an unknown name can't expand
+        const auto name {Envy::string_id::find(m.name)};
+
+        if(!name)
+        { return {}; }
+
         if(use_global)
         {
-            r = std::move( global_macros.expand(m.name, m.param));
+            r = std::move( global_macros.expand(*name, m.param));
 
             if(r.success)
             { return r; }
@@ -210,7 +235,7 @@ namespace Envy
 
         for(const auto& map : maps)
         {
-            r = std::move( map.get().expand(m.name, m.param));
+            r = std::move( map.get().expand(*name, m.param));
 
             if(r.success)
             { return r; }
@@ -292,12 +317,12 @@ namespace Envy
         if(s.empty())
         { return false; }
 
-        if(isdigit((int)s.front().get()))
+        if(utf8::is_digit(s.front()))
         { return false; }
 
         for(auto c : s)
         {
-            if(!isalnum((int)c.get()) && c != '_' && c != '-')
+            if(!utf8::is_alphanumeric(c) && c != '_' && c != '-')
             { return false; }
         }
 
@@ -0,0 +1,586 @@
+#include <segmentation.hpp>
+#include "unicode_tables.hpp"
+
+#include <array>
+#include <cstring>
+
+namespace Envy::utf8
+{
+
+    // ==== break properties ====
+
+    namespace
+    {
+        using unicode_tables::break_record;
+
+
+        constexpr const break_record& lookup_breaks(u32 value) noexcept
+        {
+            using namespace unicode_tables;
+
+            if(value > 0x10FFFFu)
+            { value = 0x10FFFFu; }
+
+            const u32 block { break_stage1[value >> break_shift] };
+            const u32 offset { value & ((1u << break_shift) - 1u) };
+
+            return breaks[break_stage2[(block << break_shift) + offset]];
+        }
+
+
+        // ascii is resolved at compile time so the common case skips the two-stage lookup
+        constexpr std::array<break_record, 128> ascii_breaks { []
+        {
+            std::array<break_record, 128> records {};
+
+            for(u32 i {0}; i < 128u; ++i)
+            { records[i] = lookup_breaks(i); }
+
+            return records;
+        }() };
+
+
+        // returns the break properties of the code point at 'ptr' and advances past it,
+        // an ill-formed subpart is classified as U+FFFD
+        const break_record& classify(const code_unit*& ptr, const code_unit* last) noexcept
+        {
+            if(*ptr < 0x80u)
+            { return ascii_breaks[*ptr++]; }
+
+            const decode_result result { decode_checked(ptr, static_cast<usize>(last - ptr)) };
+            ptr += result.length;
+
+            return lookup_breaks(static_cast<u32>(result.cp));
+        }
+
+
+        grapheme_break grapheme_at(const code_unit* ptr, const code_unit* last) noexcept
+        { return classify(ptr, last).grapheme; }
+
+
+        // returns the start of the code point ending at 'pos', ill-formed input steps back one code unit
+        const code_unit* code_point_before(const code_unit* first, const code_unit* pos) noexcept
+        {
+            const code_unit* lead {pos - 1};
+
+            for(i32 i {0}; i < 3 && lead > first && (*lead & 0xC0u) == 0x80u; ++i)
+            { --lead; }
+
+            if(decode_checked(lead, static_cast<usize>(pos - lead)).length == pos - lead)
+            { return lead; }
+
+            return pos - 1;
+        }
+
+
+        // returns the start of the code point containing 'pos'
+        const code_unit* code_point_containing(const code_unit* first, const code_unit* last, const code_unit* pos) noexcept
+        {
+            if(pos == last || (*pos & 0xC0u) != 0x80u)
+            { return pos; }
+
+            const code_unit* lead {pos};
+
+            for(i32 i {0}; i < 3 && lead > first && (*lead & 0xC0u) == 0x80u; ++i)
+            { --lead; }
+
+            if(decode_checked(lead, static_cast<usize>(last - lead)).length > pos - lead)
+            { return lead; }
+
+            return pos;
+        }
+    }
+
+
+    // ==== grapheme clusters ====
+
+    namespace
+    {
+        // GB3 - GB999, whether there is a boundary between code points 'a' and 'b',
+        // 'a_start' is where 'a' begins for the rules that look further back
+        bool is_grapheme_break(grapheme_break a, grapheme_break b, const code_unit* first, const code_unit* a_start) noexcept
+        {
+            using enum grapheme_break;
+
+            if(a == cr && b == lf)
+            { return false; }
+
+            if(a == cr || a == lf || a == control || b == cr || b == lf || b == control)
+            { return true; }
+
+            if(a == l && (b == l || b == v || b == lv || b == lvt))
+            { return false; }
+
+            if((a == lv || a == v) && (b == v || b == t))
+            { return false; }
+
+            if((a == lvt || a == t) && b == t)
+            { return false; }
+
+            if(b == extend || b == zwj || b == spacing_mark || a == prepend)
+            { return false; }
+
+            // GB11, ExtPict Extend* ZWJ x ExtPict
+            if(a == zwj && b == extended_pictographic)
+            {
+                const code_unit* ptr {a_start};
+
+                while(ptr > first)
+                {
+                    ptr = code_point_before(first, ptr);
+                    const grapheme_break property { grapheme_at(ptr, a_start) };
+
+                    if(property != extend)
+                    { return property != extended_pictographic; }
+                }
+
+                return true;
+            }
+
+            // GB12, GB13, regional indicators pair up from the start of a run
+            if(a == regional_indicator && b == regional_indicator)
+            {
+                usize run {1};
+
+                for(const code_unit* ptr {a_start}; ptr > first; ++run)
+                {
+                    ptr = code_point_before(first, ptr);
+
+                    if(grapheme_at(ptr, a_start) != regional_indicator)
+                    { break; }
+                }
+
+                return run % 2u == 0u;
+            }
+
+            return true;
+        }
+
+
+        // returns the first boundary after 'pos', which must start a code point
+        const code_unit* next_boundary(const code_unit* first, const code_unit* pos, const code_unit* last) noexcept
+        {
+            // an ascii code point followed by ascii is a cluster of its own, save for CR LF
+            if(*pos < 0x80u && *pos != '\r' && (pos + 1 == last || pos[1] < 0x80u))
+            { return pos + 1; }
+
+            const code_unit* a_start {pos};
+            const code_unit* ptr {pos};
+            grapheme_break a { classify(ptr, last).grapheme };
+
+            while(ptr < last)
+            {
+                const code_unit* const b_start {ptr};
+                const grapheme_break b { classify(ptr, last).grapheme };
+
+                if(is_grapheme_break(a, b, first, a_start))
+                { return b_start; }
+
+                a = b;
+                a_start = b_start;
+            }
+
+            return last;
+        }
+
+
+        // returns the last boundary before 'pos', which must start a code point
+        const code_unit* prev_boundary(const code_unit* first, const code_unit* pos, const code_unit* last) noexcept
+        {
+            if(pos == first)
+            { return first; }
+
+            const code_unit* b_start { code_point_before(first, pos) };
+
+            while(b_start > first)
+            {
+                if(*b_start < 0x80u && b_start[-1] < 0x80u && !(b_start[-1] == '\r' && *b_start == '\n'))
+                { return b_start; }
+
+                const code_unit* const a_start { code_point_before(first, b_start) };
+
+                if(is_grapheme_break(grapheme_at(a_start, last), grapheme_at(b_start, last), first, a_start))
+                { return b_start; }
+
+                b_start = a_start;
+            }
+
+            return first;
+        }
+    }
+
+
+    grapheme_iterator::grapheme_iterator(const Envy::string_view& str, const code_unit* position) noexcept :
+        first   {str.data()},
+        last    {str.data() + str.size_bytes()},
+        current {position},
+        next    {position == last ? last : next_boundary(first, position, last)}
+    {}
+
+
+    grapheme_iterator& grapheme_iterator::operator++() noexcept
+    {
+        current = next;
+
+        if(next != last)
+        { next = next_boundary(first, next, last); }
+
+        return *this;
+    }
+
+
+    grapheme_iterator grapheme_iterator::operator++(int) noexcept
+    {
+        grapheme_iterator temp {*this};
+        ++(*this);
+        return temp;
+    }
+
+
+    grapheme_iterator& grapheme_iterator::operator--() noexcept
+    {
+        next = current;
+        current = prev_boundary(first, current, last);
+        return *this;
+    }
+
+
+    grapheme_iterator grapheme_iterator::operator--(int) noexcept
+    {
+        grapheme_iterator temp {*this};
+        --(*this);
+        return temp;
+    }
+
+
+    grapheme_iterator::value_type grapheme_iterator::operator*() const noexcept
+    { return { current, static_cast<usize>(next - current) }; }
+
+
+    usize count_graphemes(const Envy::string_view& str) noexcept
+    {
+        const code_unit* const first {str.data()};
+        const code_unit* const last {first + str.size_bytes()};
+
+        constexpr u64 high_bits {0x8080808080808080ull};
+        constexpr u64 low_bits  {0x0101010101010101ull};
+        constexpr u64 carriage_returns {low_bits * '\r'};
+
+        usize count {0};
+        const code_unit* ptr {first};
+
+        while(ptr < last)
+        {
+            // eight ascii code units without a CR, followed by ascii, are eight clusters
+            if(last - ptr > 8)
+            {
+                u64 word;
+                std::memcpy(&word, ptr, 8u);
+
+                const u64 cr { word ^ carriage_returns };
+
+                if(((word | ((cr - low_bits) & ~cr)) & high_bits) == 0u && ptr[8] < 0x80u)
+                {
+                    ptr += 8;
+                    count += 8u;
+                    continue;
+                }
+            }
+
+            ptr = next_boundary(first, ptr, last);
+            ++count;
+        }
+
+        return count;
+    }
+
+
+    bool is_grapheme_boundary(const Envy::string_view& str, usize offset) noexcept
+    {
+        const code_unit* const first {str.data()};
+        const code_unit* const last {first + str.size_bytes()};
+        const code_unit* const pos {first + offset};
+
+        if(offset == 0u || offset >= str.size_bytes())
+        { return true; }
+
+        if(code_point_containing(first, last, pos) != pos)
+        { return false; }
+
+        const code_unit* const a_start { code_point_before(first, pos) };
+        return is_grapheme_break(grapheme_at(a_start, last), grapheme_at(pos, last), first, a_start);
+    }
+
+
+    usize next_grapheme_boundary(const Envy::string_view& str, usize offset) noexcept
+    {
+        const code_unit* const first {str.data()};
+        const code_unit* const last {first + str.size_bytes()};
+
+        if(offset >= str.size_bytes())
+        { return str.size_bytes(); }
+
+        const code_unit* const pos { code_point_containing(first, last, first + offset) };
+        return static_cast<usize>(next_boundary(first, pos, last) - first);
+    }
+
+
+    usize prev_grapheme_boundary(const Envy::string_view& str, usize offset) noexcept
+    {
+        const code_unit* const first {str.data()};
+        const code_unit* const last {first + str.size_bytes()};
+
+        if(offset > str.size_bytes())
+        { offset = str.size_bytes(); }
+
+        const code_unit* const pos { code_point_containing(first, last, first + offset) };
+
+        if(pos != first + offset && is_grapheme_boundary(str, static_cast<usize>(pos - first)))
+        { return static_cast<usize>(pos - first); }
+
+        return static_cast<usize>(prev_boundary(first, pos, last) - first);
+    }
+
+
+    // ==== line breaks ====
+
+    namespace
+    {
+        constexpr bool is_alphabetic(line_break c) noexcept
+        { return c == line_break::alphabetic || c == line_break::hebrew_letter; }
+
+
+        constexpr bool is_closing(line_break c) noexcept
+        { return c == line_break::close_punctuation || c == line_break::close_parenthesis; }
+
+
+        constexpr bool is_newline(line_break c) noexcept
+        {
+            using enum line_break;
+            return c == mandatory_break || c == carriage_return || c == line_feed || c == next_line;
+        }
+
+
+        enum class pair_rule : u8
+        {
+            allowed,    ///< break between the pair
+            prohibited, ///< no break between the pair
+            contextual  ///< break unless the context before the pair, or the flags of either, says otherwise
+        };
+
+
+        // LB11 - LB31 between two adjacent classes after LB1 and LB10, 'a' is not a space
+        constexpr pair_rule rule_for(line_break a, line_break b) noexcept
+        {
+            using enum line_break;
+
+            const bool prohibited
+            {
+                a == word_joiner || b == word_joiner || a == glue // LB11, LB12
+                || (b == glue && a != break_after && a != hyphen) // LB12a
+                || is_closing(b) || b == exclamation || b == infix_numeric || b == break_symbols // LB13
+                || a == open_punctuation // LB14
+                || (a == quotation && b == open_punctuation) // LB15
+                || (is_closing(a) && b == nonstarter) // LB16
+                || (a == break_both && b == break_both) // LB17
+                || a == quotation || b == quotation // LB19
+            };
+
+            if(prohibited)
+            { return pair_rule::prohibited; }
+
+            if(a == contingent_break || b == contingent_break) // LB20
+            { return pair_rule::allowed; }
+
+            const bool jamo_a { a == jl || a == jv || a == jt || a == h2 || a == h3 };
+            const bool jamo_b { b == jl || b == jv || b == jt || b == h2 || b == h3 };
+
+            const bool joined
+            {
+                b == break_after || b == hyphen || b == nonstarter || a == break_before // LB21
+                || (a == break_symbols && b == hebrew_letter) // LB21b
+                || b == inseparable // LB22
+                || (is_alphabetic(a) && b == numeric) || (a == numeric && is_alphabetic(b)) // LB23
+                || (a == prefix_numeric && (b == ideographic || b == e_base || b == e_modifier)) // LB23a
+                || ((a == ideographic || a == e_base || a == e_modifier) && b == postfix_numeric)
+                || ((a == prefix_numeric || a == postfix_numeric) && is_alphabetic(b)) // LB24
+                || (is_alphabetic(a) && (b == prefix_numeric || b == postfix_numeric))
+                || ((is_closing(a) || a == numeric) && (b == postfix_numeric || b == prefix_numeric)) // LB25
+                || ((a == postfix_numeric || a == prefix_numeric) && (b == open_punctuation || b == numeric))
+                || ((a == hyphen || a == infix_numeric || a == numeric || a == break_symbols) && b == numeric)
+                || (a == jl && (b == jl || b == jv || b == h2 || b == h3)) // LB26
+                || ((a == jv || a == h2) && (b == jv || b == jt))
+                || ((a == jt || a == h3) && b == jt)
+                || (jamo_a && b == postfix_numeric) || (a == prefix_numeric && jamo_b) // LB27
+                || (is_alphabetic(a) && is_alphabetic(b)) // LB28
+                || (a == infix_numeric && is_alphabetic(b)) // LB29
+                || (a == e_base && b == e_modifier) // LB30b
+            };
+
+            if(joined)
+            { return pair_rule::prohibited; }
+
+            const bool contextual
+            {
+                a == hyphen || a == break_after // LB21a, HL before a
+                || ((is_alphabetic(a) || a == numeric) && b == open_punctuation) // LB30, east asian width of b
+                || (a == close_parenthesis && (is_alphabetic(b) || b == numeric)) // LB30, east asian width of a
+                || (a == regional_indicator && b == regional_indicator) // LB30a, length of the run
+                || b == e_modifier // LB30b, a is unassigned extended pictographic
+            };
+
+            return contextual ? pair_rule::contextual : pair_rule::allowed; // LB31
+        }
+
+
+        constexpr usize line_break_classes { static_cast<usize>(line_break::unknown) + 1u };
+
+        // the pair table of UAX #14, resolved at compile time
+        constexpr std::array<std::array<pair_rule, line_break_classes>, line_break_classes> pair_rules { []
+        {
+            std::array<std::array<pair_rule, line_break_classes>, line_break_classes> rules {};
+
+            for(usize a {0}; a < line_break_classes; ++a)
+            {
+                for(usize b {0}; b < line_break_classes; ++b)
+                { rules[a][b] = rule_for(static_cast<line_break>(a), static_cast<line_break>(b)); }
+            }
+
+            return rules;
+        }() };
+    }
+
+
+    line_break_iterator::line_break_iterator(const Envy::string_view& str) noexcept :
+        first {str.data()},
+        last  {str.data() + str.size_bytes()},
+        ptr   {str.data()}
+    {
+        if(first == last)
+        { *this = {}; }
+        else
+        { advance(); }
+    }
+
+
+    void line_break_iterator::advance() noexcept
+    {
+        using enum line_break;
+
+        const usize size { static_cast<usize>(last - first) };
+
+        while(ptr < last)
+        {
+            // ascii alphabetic after alphabetic never breaks (LB28), the pair context becomes that of an ascii letter
+            if(prev == alphabetic && raw_prev == alphabetic && *ptr < 0x80u && ascii_breaks[*ptr].resolved_line == alphabetic)
+            {
+                do { ++ptr; }
+                while(ptr < last && *ptr < 0x80u && ascii_breaks[*ptr].resolved_line == alphabetic);
+
+                prev_prev = alphabetic;
+                prev_flags = ascii_breaks[ptr[-1]].flags;
+                continue;
+            }
+
+            const usize offset { static_cast<usize>(ptr - first) };
+            const break_record& record { *ptr < 0x80u ? ascii_breaks[*ptr++] : classify(ptr, last) };
+
+            line_break b {record.resolved_line};
+
+            bool allowed {false};
+            bool mandatory {false};
+
+            if(start) // LB2
+            { start = false; }
+            else if(raw_prev == mandatory_break || raw_prev == line_feed || raw_prev == next_line
+                  || (raw_prev == carriage_return && b != line_feed)) // LB4, LB5
+            { allowed = mandatory = true; }
+            else if(is_newline(b) || b == space || b == zw_space) // LB6, LB7
+            { allowed = false; }
+            else if(after_zw) // LB8
+            { allowed = true; }
+            else if((b == combining_mark || b == zwj) && prev != space && !is_newline(prev)) // LB9, before LB8a so marks after a ZWJ still attach
+            {
+                raw_prev = b;
+                continue;
+            }
+            else if(raw_prev == zwj) // LB8a
+            { allowed = false; }
+            else
+            {
+                if(b == combining_mark || b == zwj) // LB10
+                { b = alphabetic; }
+
+                const line_break a {prev};
+
+                if(a == space)
+                {
+                    allowed = !(b == word_joiner                                        // LB11
+                        || is_closing(b) || b == exclamation || b == infix_numeric || b == break_symbols // LB13
+                        || before_spaces == open_punctuation                           // LB14
+                        || (before_spaces == quotation && b == open_punctuation)       // LB15
+                        || (is_closing(before_spaces) && b == nonstarter)              // LB16
+                        || (before_spaces == break_both && b == break_both));          // LB17
+                                                                                       // LB18
+                }
+                else
+                {
+                    const pair_rule rule { pair_rules[static_cast<usize>(a)][static_cast<usize>(b)] };
+
+                    allowed = rule == pair_rule::allowed || (rule == pair_rule::contextual
+                        && !((prev_prev == hebrew_letter && (a == hyphen || a == break_after)) // LB21a
+                            || ((is_alphabetic(a) || a == numeric) && b == open_punctuation && !(record.flags & unicode_tables::east_asian)) // LB30
+                            || (a == close_parenthesis && (is_alphabetic(b) || b == numeric) && !(prev_flags & unicode_tables::east_asian))
+                            || (a == regional_indicator && b == regional_indicator && regional_indicators % 2u == 1u) // LB30a
+                            || (b == e_modifier && (prev_flags & unicode_tables::pictographic_unassigned)))); // LB30b
+                }
+            }
+
+            // carry the pair context past this code point, marks that weren't absorbed are alphabetic (LB10)
+            if(b == combining_mark || b == zwj)
+            { b = alphabetic; }
+
+            if(b == space && prev != space)
+            { before_spaces = prev; }
+
+            after_zw = b == zw_space || (after_zw && b == space);
+            regional_indicators = b == regional_indicator ? regional_indicators + 1u : 0u;
+            prev_prev = prev;
+            prev = b;
+            prev_flags = record.flags;
+            raw_prev = record.resolved_line;
+
+            if(allowed)
+            {
+                current = { offset, mandatory };
+                return;
+            }
+        }
+
+        // LB3, the end is the last opportunity
+        if(current.offset == size)
+        { *this = {}; }
+        else
+        { current = { size, true }; }
+    }
+
+
+    line_break_iterator& line_break_iterator::operator++() noexcept
+    {
+        advance();
+        return *this;
+    }
+
+
+    line_break_iterator line_break_iterator::operator++(int) noexcept
+    {
+        line_break_iterator temp {*this};
+        advance();
+        return temp;
+    }
+
+
+    bool line_break_iterator::operator==(const line_break_iterator& other) const noexcept
+    { return first == other.first && current.offset == other.current.offset; }
+
+}
@@ -0,0 +1,45 @@
+#include <shared_string.hpp>
+
+#include <cstring>
+#include <new>
+
+namespace Envy
+{
+
+    //**********************************************************************
+    shared_string::shared_string(Envy::string_view str, std::pmr::memory_resource* resource)
+    {
+        if(str.size_bytes() == 0u)
+        { return; }
+
+        // +1 for the null-terminator
+        void* storage {resource->allocate(sizeof(detail::shared_string_header) + str.size_bytes() + 1u, alignof(detail::shared_string_header))};
+
+        header = ::new (storage) detail::shared_string_header {{1u}, str.size_bytes(), resource, str.is_ascii()};
+
+        auto* text {reinterpret_cast<utf8::code_unit*>(header + 1)};
+        std::memcpy(text, str.data(), str.size_bytes());
+        text[str.size_bytes()] = '\0';
+    }
+
+
+    //**********************************************************************
+    void shared_string::release() noexcept
+    {
+        if(header == nullptr)
+        { return; }
+
+        // acq_rel so every other owner's reads happen before the storage is freed
+        if(header->refs.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+        {
+            std::pmr::memory_resource* resource {header->resource};
+            const usize bytes {sizeof(detail::shared_string_header) + header->size + 1u};
+
+            header->~shared_string_header();
+            resource->deallocate(header, bytes, alignof(detail::shared_string_header));
+        }
+
+        header = nullptr;
+    }
+
+}
@@ -1,6 +1,10 @@
 #include <string.hpp>
+#include <log.hpp>
+#include <unicode.hpp>
+#include <code_point_set.hpp>
 
 #include <exception>
+#include <new>
 #include <utility>
 #include <cctype>
 #include <format>
@@ -8,29 +12,45 @@
 #include <cstring>
 #include <algorithm>
 #include <ranges>
+#include <functional>
 
 namespace Envy
 {
 
+    // Side index for access by code point into heap strings, allocated from the string's resource on first use
+    struct string::offset_index
+    {
+        static constexpr usize stride {64u}; ///< Code points between samples
+
+        std::pmr::vector<usize> samples;  ///< Byte offset of every stride'th code point
+        usize bytes {0};                  ///< Bytes of the buffer covered by samples
+        usize code_points {0};            ///< Code points in the bytes covered by samples
+
+        explicit offset_index(std::pmr::memory_resource* resource) :
+            samples {resource}
+        { }
+    };
+
+
     // [[[[[[[[[[[[[[[[[[[[[[[[[[[[[[ Construction ]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]
 
 
     //**********************************************************************
-    string::string(reserve_tag_t, usize bytes) :
-        buffer_size      { 0 },
-        buffer_capacity  { new_capacity(bytes) },
-        buffer           { new utf8::code_unit[buffer_capacity] }
+    string::string(reserve_tag_t, usize bytes, std::pmr::memory_resource* resource) :
+        resource         { resource },
+        buffer_size      { 0 }
     {
+        allocate(bytes);
         buffer[0] = '\0';
     }
 
 
     //**********************************************************************
-    string::string(size_tag_t, usize bytes) :
-        buffer_size      { bytes },
-        buffer_capacity  { new_capacity(bytes+5) },
-        buffer           { new utf8::code_unit[buffer_capacity] }
+    string::string(size_tag_t, usize bytes, std::pmr::memory_resource* resource) :
+        resource         { resource },
+        buffer_size      { bytes }
     {
+        allocate(bytes);
         buffer[0] = '\0';
         buffer[buffer_size] = '\0';
     }
@@ -38,16 +58,23 @@ namespace Envy
 
     //**********************************************************************
     string::string() :
-        string(reserve_tag, 30u)
+        string(reserve_tag, 0u)
     { }
 
 
     //**********************************************************************
-    string::string(const char* cstr) :
-        string(size_tag, utf8::size_bytes(cstr))
+    string::string(std::pmr::memory_resource* resource) noexcept :
+        string(reserve_tag, 0u, resource)
+    { }
+
+
+    //**********************************************************************
+    string::string(const char* cstr, std::pmr::memory_resource* resource) :
+        string(size_tag, utf8::size_bytes(cstr), resource)
     {
         // +1 to copy null-terminator
         std::memcpy(buffer, cstr, buffer_size + 1u);
+        ascii = utf8::is_ascii(buffer, buffer_size);
     }
 
 
@@ -62,61 +89,58 @@ namespace Envy
         string(size_tag, count)
     {
         std::fill(buffer, buffer + buffer_size, (u8) fill);
+        ascii = (u8) fill < 0x80u;
     }
 
 
     //**********************************************************************
     string::string(const string& from) :
+        string(from, std::pmr::get_default_resource())
+    { }
+
+
+    //**********************************************************************
+    string::string(const string& from, std::pmr::memory_resource* resource) :
+        resource          { resource },
         buffer_size       { from.buffer_size },
-        buffer_capacity   { from.buffer_capacity },
-        buffer            { new utf8::code_unit[buffer_capacity] },
-        code_point_count  { from.code_point_count }
+        code_point_count  { from.code_point_count },
+        ascii             { from.ascii }
     {
-        std::copy(from.buffer, from.buffer + buffer_size, this->buffer);
-        buffer[buffer_size] = '\0';
+        allocate(buffer_size);
+        std::memcpy(buffer, from.buffer, buffer_size + 1u);
     }
 
 
     //**********************************************************************
     string::string(string&& from) noexcept :
-        buffer_size       { from.buffer_size },
-        buffer_capacity   { from.buffer_capacity },
-        buffer            { from.buffer },
-        code_point_count  { from.code_point_count }
+        resource      { from.resource }
     {
-        from.buffer_size = 0u;
-        from.buffer_capacity = 0u;
-        from.buffer = nullptr;
-        from.code_point_count = npos;
+        steal(from);
     }
 
 
     //**********************************************************************
     string::string(const std::string& from) :
-        buffer_size       { from.size() },
-        buffer_capacity   { from.capacity() + 1u },
-        buffer            { new utf8::code_unit[buffer_capacity] },
-        code_point_count  { npos }
+        string(size_tag, from.size())
     {
-        std::copy(from.data(), from.data() + buffer_size, this->buffer);
-
-        buffer[buffer_size] = '\0';
+        std::memcpy(buffer, from.data(), buffer_size);
+        ascii = utf8::is_ascii(buffer, buffer_size);
     }
 
 
     //**********************************************************************
-    string::string(string_view from) :
-        string(size_tag, from.size_bytes())
+    string::string(string_view from, std::pmr::memory_resource* resource) :
+        string(size_tag, from.size_bytes(), resource)
     {
-        std::copy(from.data(), from.data() + buffer_size, this->buffer);
+        std::memcpy(buffer, from.data(), buffer_size);
+        ascii = from.is_ascii();
     }
 
 
     //**********************************************************************
     string::~string()
     {
-        if(buffer)
-        { delete[] buffer; }
+        release();
     }
 
 
@@ -125,39 +149,33 @@ namespace Envy
     {
         if(&from != this)
         {
-            if(buffer)
-            { delete[] buffer; }
+            discard_to_fit(from.buffer_size);
 
             buffer_size       = from.buffer_size;
-            buffer_capacity   = from.buffer_capacity;
-            buffer            = new utf8::code_unit[buffer_capacity];
             code_point_count  = from.code_point_count;
+            ascii             = from.ascii;
 
-            std::copy(from.buffer, from.buffer + buffer_size, this->buffer);
+            reset_index();
 
-            buffer[buffer_size] = '\0';
+            std::memcpy(buffer, from.buffer, buffer_size + 1u);
         }
         return *this;
     }
 
 
     //**********************************************************************
-    string& string::operator=(string&& from) noexcept
+    string& string::operator=(string&& from)
     {
         if(&from != this)
         {
-            if(buffer)
-            { delete[] buffer; }
-
-            buffer_size       = from.buffer_size;
-            buffer_capacity   = from.buffer_capacity;
-            buffer            = from.buffer;
-            code_point_count  = from.code_point_count;
-
-            from.buffer_size       = 0u;
-            from.buffer_capacity   = 0u;
-            from.buffer            = nullptr;
-            from.code_point_count   = npos;
+            // storage can only change hands between equal resources
+            if(resource->is_equal(*from.resource))
+            {
+                release();
+                steal(from);
+            }
+            else
+            { *this = static_cast<const string&>(from); }
         }
         return *this;
     }
@@ -166,13 +184,16 @@ namespace Envy
     //**********************************************************************
     string& string::operator=(const std::string& from)
     {
+        discard_to_fit(from.size());
+
         buffer_size       = from.size();
-        buffer_capacity   = from.capacity() + 1u;
-        buffer            = new utf8::code_unit[buffer_capacity];
         code_point_count  = npos;
 
-        std::copy(from.data(), from.data() + buffer_size, this->buffer);
+        reset_index();
+
+        std::memcpy(buffer, from.data(), buffer_size);
         buffer[buffer_size] = '\0';
+        ascii = utf8::is_ascii(buffer, buffer_size);
 
         return *this;
     }
@@ -280,6 +301,43 @@ namespace Envy
     }
 
 
+    //**********************************************************************
+    utf8::code_point string::at(usize i) const noexcept(!Envy::debug)
+    {
+        Envy::debug_assert(i < size(), "Envy::string::at() index out of range");
+
+        if(ascii)
+        { return utf8::code_point {buffer[i]}; }
+
+        return utf8::decode(buffer + byte_offset(i));
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::iterator_at(usize i) const noexcept(!Envy::debug)
+    {
+        return utf8::iterator(buffer + byte_offset(i));
+    }
+
+
+    //**********************************************************************
+    string_view string::view(usize first, usize last) const noexcept(!Envy::debug)
+    {
+        Envy::debug_assert(first <= last, "Envy::string::view() range is reversed");
+
+        const usize first_byte {byte_offset(first)};
+        return { buffer + first_byte, byte_offset(last) - first_byte };
+    }
+
+
+    //**********************************************************************
+    string string::substr(usize first, usize count) const
+    {
+        const usize last {count >= size() - first ? size() : first + count};
+        return string { view(first, last) };
+    }
+
+
     //**********************************************************************
     bool string::empty() const noexcept
     { return buffer_size == 0; }
@@ -288,22 +346,46 @@ namespace Envy
     //**********************************************************************
     usize string::size() const noexcept(!Envy::debug)
     {
+        if(ascii)
+        { return buffer_size; }
+
         if(code_point_count == npos)
         {
-            code_point_count = utf8::count_code_points(buffer);
+            // only the bytes appended since the offset index was last updated need counting
+            const offset_index* const offsets {is_local() ? nullptr : heap.offsets};
+            const usize indexed_bytes {offsets ? offsets->bytes : 0u};
+            const usize indexed_code_points {offsets ? offsets->code_points : 0u};
+
+            code_point_count = indexed_code_points + utf8::count_code_points(buffer + indexed_bytes, buffer_size - indexed_bytes);
         }
 
         return code_point_count;
     }
 
 
+    //**********************************************************************
+    bool string::is_ascii() const noexcept
+    { return ascii; }
+
+
     //**********************************************************************
     usize string::capacity() const noexcept
-    { return buffer_capacity; }
+    { return is_local() ? local_capacity : heap.capacity; }
+
+
+    //**********************************************************************
+    std::pmr::memory_resource* string::get_resource() const noexcept
+    { return resource; }
 
 
     void string::clear() noexcept
-    { *buffer = '\0'; buffer_size = 0; }
+    {
+        *buffer = '\0';
+        buffer_size = 0;
+        code_point_count = 0;
+        ascii = true;
+        reset_index();
+    }
 
 
     //**********************************************************************
@@ -323,13 +405,16 @@ namespace Envy
     //**********************************************************************
     string& string::append(Envy::string_view str)
     {
+        // counts the appended code points as a side effect, keeping the cached count current
+        ascii = ascii && str.is_ascii();
+
+        if(code_point_count != npos)
+        { code_point_count += str.size(); }
+
         adjust_buffer( buffer_size + str.size_bytes() );
 
-        for(auto cu : str.code_units())
-        {
-            buffer[buffer_size] = cu;
-            ++buffer_size;
-        }
+        std::memcpy(buffer + buffer_size, str.data(), str.size_bytes());
+        buffer_size += str.size_bytes();
 
         buffer[buffer_size] = '\0';
 
@@ -344,11 +429,15 @@ namespace Envy
         adjust_buffer( buffer_size + units );
 
         utf8::encode(cp, buffer + buffer_size);
+        ascii = ascii && units == 1;
 
         buffer_size += units;
 
         buffer[buffer_size] = '\0';
 
+        if(code_point_count != npos)
+        { ++code_point_count; }
+
         return *this;
     }
 
@@ -358,9 +447,13 @@ namespace Envy
     {
         adjust_buffer( buffer_size + 1 );
         buffer[buffer_size] = (utf8::code_unit) c;
+        ascii = ascii && buffer[buffer_size] < 0x80u;
         ++buffer_size;
         buffer[buffer_size] = '\0';
 
+        if(code_point_count != npos)
+        { ++code_point_count; }
+
         return *this;
     }
 
@@ -394,89 +487,247 @@ namespace Envy
 
 
     //**********************************************************************
-    bool string::contains(string_view sv) const noexcept
+    utf8::iterator string::insert(utf8::iterator pos, string_view str)
     {
-        return ! std::ranges::search(*this, sv).empty();
+        return splice(static_cast<usize>(utf8::iterator_ptr(pos) - buffer), 0u, str);
     }
 
 
     //**********************************************************************
-    bool string::contains(utf8::code_point cp) const noexcept
+    utf8::iterator string::insert(utf8::iterator pos, utf8::iterator first, utf8::iterator last)
+    {
+        return insert(pos, string_view {first, last});
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::insert(utf8::iterator pos, utf8::iterator first, usize count)
+    {
+        return insert(pos, string_view {first, std::ranges::next(first, static_cast<std::ptrdiff_t>(count))});
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::remove(utf8::iterator pos)
+    {
+        return remove(pos, std::ranges::next(pos));
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::remove(utf8::iterator first, usize count)
+    {
+        return remove(first, std::ranges::next(first, static_cast<std::ptrdiff_t>(count), end()));
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::remove(utf8::iterator first, utf8::iterator last)
+    {
+        return replace(first, last, string_view {});
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::find(string_view sv) const noexcept
+    {
+        const auto* match {utf8::find_sequence(buffer, buffer_size, sv.data(), sv.size_bytes())};
+        return match ? utf8::iterator {match} : end();
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::find(utf8::code_point cp) const noexcept
+    {
+        if(static_cast<u32>(cp) >= 0x80u && ascii)
+        { return end(); }
+
+        utf8::code_unit encoded[4];
+        utf8::encode(cp, encoded);
+
+        return find(string_view {encoded, static_cast<usize>(utf8::code_units_required(cp))});
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::find_last(string_view sv) const noexcept
+    {
+        const auto* match {utf8::find_last_sequence(buffer, buffer_size, sv.data(), sv.size_bytes())};
+        return match ? utf8::iterator {match} : end();
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::find_last(utf8::code_point cp) const noexcept
+    {
+        if(static_cast<u32>(cp) >= 0x80u && ascii)
+        { return end(); }
+
+        utf8::code_unit encoded[4];
+        utf8::encode(cp, encoded);
+
+        return find_last(string_view {encoded, static_cast<usize>(utf8::code_units_required(cp))});
+    }
+
+
+    //**********************************************************************
+    i32 string::replace(string_view target, string_view replacement)
+    {
+        const auto aliases {[this](string_view sv)
+            { return !sv.empty() && std::less_equal<>{}(buffer, sv.data()) && std::less<>{}(sv.data(), buffer + buffer_size); }};
+
+        // text viewing this string would be overwritten while it is still being read
+        if(aliases(target) || aliases(replacement))
+        { return replace(string_view {Envy::string {target}}, string_view {Envy::string {replacement}}); }
+
+        const usize matches {utf8::count_sequence(buffer, buffer_size, target.data(), target.size_bytes())};
+
+        if(matches == 0u)
+        { return 0; }
+
+        const usize new_size {buffer_size - matches * target.size_bytes() + matches * replacement.size_bytes()};
+        const utf8::code_unit* read {buffer};
+        const utf8::code_unit* const end {buffer + buffer_size};
+
+        // writing never overtakes reading when the text doesn't grow, so that can happen in place
+        string grown {resource};
+
+        if(new_size > buffer_size)
+        { grown.allocate(new_size); }
+
+        utf8::code_unit* write {new_size > buffer_size ? grown.buffer : buffer};
+
+        for(usize m {}; m < matches; ++m)
+        {
+            const auto* match {utf8::find_sequence(read, static_cast<usize>(end - read), target.data(), target.size_bytes())};
+
+            std::memmove(write, read, static_cast<usize>(match - read));
+            write += match - read;
+            std::memcpy(write, replacement.data(), replacement.size_bytes());
+            write += replacement.size_bytes();
+            read = match + target.size_bytes();
+        }
+
+        std::memmove(write, read, static_cast<usize>(end - read));
+        write[end - read] = '\0';
+
+        const usize new_count {code_point_count == npos ? npos : code_point_count - matches * target.size() + matches * replacement.size()};
+        const bool new_ascii {ascii ? replacement.is_ascii() : utf8::is_ascii(new_size > buffer_size ? grown.buffer : buffer, new_size)};
+
+        if(new_size > buffer_size)
+        {
+            grown.buffer_size = new_size;
+            release();
+            steal(grown);
+        }
+
+        buffer_size = new_size;
+        code_point_count = new_count;
+        ascii = new_ascii;
+        reset_index();
+
+        return static_cast<i32>(matches);
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::replace(utf8::iterator first, utf8::iterator last, string_view replacement)
+    {
+        const usize offset {static_cast<usize>(utf8::iterator_ptr(first) - buffer)};
+        const usize erase {static_cast<usize>(utf8::iterator_ptr(last) - utf8::iterator_ptr(first))};
+
+        return std::ranges::next(splice(offset, erase, replacement), static_cast<std::ptrdiff_t>(replacement.size()));
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::replace(utf8::iterator first, usize count, string_view replacement)
+    {
+        return replace(first, std::ranges::next(first, static_cast<std::ptrdiff_t>(count), end()), replacement);
+    }
+
+
+    //**********************************************************************
+    i32 string::count(string_view sv) const noexcept
+    {
+        return static_cast<i32>(utf8::count_sequence(buffer, buffer_size, sv.data(), sv.size_bytes()));
+    }
+
+
+    //**********************************************************************
+    i32 string::count(utf8::code_point cp) const noexcept
     {
-        // for(const auto& this_cp : *this)
-        // {
-        //     if(this_cp == cp)
-        //     { return true; }
-        // }
+        if(static_cast<u32>(cp) >= 0x80u && ascii)
+        { return 0; }
+
+        utf8::code_unit encoded[4];
+        utf8::encode(cp, encoded);
 
-        return std::ranges::any_of(*this, [&cp](const utf8::code_point& this_cp){ return this_cp == cp; });
+        return count(string_view {encoded, static_cast<usize>(utf8::code_units_required(cp))});
     }
 
 
     //**********************************************************************
-    bool string::contains_any(string_view sv) const noexcept
+    bool string::contains(string_view sv) const noexcept
     {
-        // if(sv.empty())
-        // { return true; }
+        // UTF-8 is self-synchronizing, a byte match of a well-formed needle always begins on a code point
+        return sv.empty() || utf8::find_sequence(buffer, buffer_size, sv.data(), sv.size_bytes()) != nullptr;
+    }
 
-        // for(const auto& cp : *this)
-        // {
-        //     for(const auto& sv_cp : sv)
-        //     {
-        //         if(cp == sv_cp)
-        //         { return true; }
-        //     }
-        // }
 
-        return std::ranges::any_of(*this, [&sv](const utf8::code_point& cp){ return sv.contains(cp); });
+    //**********************************************************************
+    bool string::contains(utf8::code_point cp) const noexcept
+    {
+        return find(cp) != end();
     }
 
 
     //**********************************************************************
-    bool string::contains_all(string_view sv) const noexcept
+    bool string::contains_any(string_view sv) const
     {
-        // if(sv.empty())
-        // { return true; }
+        return utf8::code_point_set {sv}.find_first_of(buffer, buffer_size) != nullptr;
+    }
+
+
+    //**********************************************************************
+    bool string::contains_all(string_view sv) const
+    {
+        return string_view {*this}.contains_all(sv);
+    }
 
-        // for(const auto& sv_cp : sv)
-        // {
-        //     bool in {false};
 
-        //     for(const auto& cp : *this)
-        //     {
-        //         if(cp == sv_cp)
-        //         { in = true; }
-        //     }
+    //**********************************************************************
+    bool string::contains_only(string_view sv) const
+    {
+        return utf8::code_point_set {sv}.find_first_not_of(buffer, buffer_size) == nullptr;
+    }
 
-        //     if(!in)
-        //     { return false; }
-        // }
 
-        return std::ranges::all_of(sv, [this](const utf8::code_point& cp){ return this->contains(cp); });
+    //**********************************************************************
+    bool string::equals_ignore_case(string_view sv) const noexcept
+    {
+        return utf8::equal_ignore_case(*this, sv);
     }
 
 
     //**********************************************************************
-    bool string::contains_only(string_view sv) const noexcept
+    std::weak_ordering string::compare_ignore_case(string_view sv) const noexcept
     {
-        // if(sv.empty())
-        // { return this->empty(); }
+        return utf8::compare_ignore_case(*this, sv);
+    }
 
-        // for(const auto& cp : *this)
-        // {
-        //     bool in {false};
 
-        //     for(const auto& sv_cp : sv)
-        //     {
-        //         if(cp == sv_cp)
-        //         { in = true; }
-        //     }
+    //**********************************************************************
+    usize string::hash_ignore_case() const noexcept
+    {
+        return utf8::hash_ignore_case(*this);
+    }
 
-        //     if(!in)
-        //     { return false; }
-        // }
 
-        return std::ranges::all_of(*this, [&sv](const utf8::code_point& cp){ return sv.contains(cp); });
+    //**********************************************************************
+    string string::fold_case() const
+    {
+        return string_view{*this}.fold_case();
     }
 
 
@@ -490,20 +741,47 @@ namespace Envy
     }
 
 
-    //**********************************************************************
-    Envy::string operator+(Envy::string left, Envy::string right)
+    std::ostream& operator<<(std::ostream& os, Envy::string str)
     {
-        Envy::string s { Envy::string::reserve_tag , left.size_bytes() + right.size_bytes() };
-        s += left;
-        s += right;
-        return s;
+        os << (std::string_view) str;
+        return os;
     }
 
 
-    std::ostream& operator<<(std::ostream& os, Envy::string str)
+    //**********************************************************************
+    Envy::string utf8::sanitize(const_buffer from)
     {
-        os << (std::string_view) str;
-        return os;
+        const utf8::code_unit* data {from.data()};
+        usize remaining {from.size()};
+
+        utf8::validation_result v {utf8::validate(data, remaining)};
+
+        // well-formed input is copied as is, validation already found whether it is ascii
+        if(v.valid)
+        {
+            Envy::string result { Envy::string::size_tag, remaining };
+            std::memcpy(result.buffer, data, remaining);
+            result.ascii = v.ascii;
+            return result;
+        }
+
+        Envy::string result { Envy::string::reserve_tag, remaining };
+
+        while(true)
+        {
+            result.append(Envy::string_view{data, v.error_offset});
+
+            if(v.valid)
+            { return result; }
+
+            result.append(utf8::code_point{0xFFFDu});
+
+            const usize skipped {static_cast<usize>(utf8::decode_checked(data + v.error_offset, remaining - v.error_offset).length)};
+            data += v.error_offset + skipped;
+            remaining -= v.error_offset + skipped;
+
+            v = utf8::validate(data, remaining);
+        }
     }
 
 
@@ -518,38 +796,269 @@ namespace Envy
     //**********************************************************************
     void string::adjust_buffer(usize required_size)
     {
-        if(required_size > buffer_capacity)
+        // capacity includes the null-terminator
+        if(required_size >= capacity())
         {
-            buffer_capacity = new_capacity(required_size);
+            const usize capacity {new_capacity(required_size)};
+            utf8::code_unit* new_buffer { static_cast<utf8::code_unit*>(resource->allocate(capacity, alignof(utf8::code_unit))) };
+
+            std::memcpy(new_buffer, buffer, buffer_size+1);
 
-            utf8::code_unit* new_buffer { new utf8::code_unit[buffer_capacity] };
+            // the offset index stays valid, only the storage moves
+            offset_index* offsets {nullptr};
 
-            if(buffer)
+            if(!is_local())
             {
-                std::memcpy(new_buffer, buffer, buffer_size+1);
-                delete[] buffer;
+                offsets = heap.offsets;
+                resource->deallocate(buffer, heap.capacity, alignof(utf8::code_unit));
             }
 
             buffer = new_buffer;
+            heap = { capacity, offsets };
         }
+    }
+
 
+    //**********************************************************************
+    void string::discard_to_fit(usize required_size)
+    {
+        // for callers about to overwrite the contents, nothing is copied and
+        // the string is left untouched if the allocation throws
+        if(required_size >= capacity())
+        {
+            string grown {reserve_tag, required_size, resource};
+            release();
+            steal(grown);
+        }
+    }
+
+
+    //**********************************************************************
+    void string::allocate(usize required_size)
+    {
+        if(required_size < local_capacity)
+        { buffer = local_buffer; }
+        else
+        {
+            const usize capacity {new_capacity(required_size)};
+            buffer = static_cast<utf8::code_unit*>(resource->allocate(capacity, alignof(utf8::code_unit)));
+            heap = { capacity, nullptr };
+        }
+    }
+
+
+    //**********************************************************************
+    void string::release() noexcept
+    {
+        if(!is_local())
+        {
+            if(heap.offsets != nullptr)
+            { std::pmr::polymorphic_allocator<> {resource}.delete_object(heap.offsets); }
+
+            resource->deallocate(buffer, heap.capacity, alignof(utf8::code_unit));
+        }
+    }
+
+
+    //**********************************************************************
+    void string::steal(string& from) noexcept
+    {
+        if(from.is_local())
+        {
+            buffer = local_buffer;
+            std::memcpy(local_buffer, from.local_buffer, from.buffer_size + 1u);
+        }
+        else
+        {
+            buffer = from.buffer;
+            heap = from.heap;
+        }
+
+        buffer_size          = from.buffer_size;
+        code_point_count     = from.code_point_count;
+        ascii                = from.ascii;
+
+        // leave 'from' empty and usable, its index went along with the heap buffer
+        from.buffer = from.local_buffer;
+        from.buffer_size = 0u;
+        from.buffer[0] = '\0';
+        from.code_point_count = npos;
+        from.ascii = true;
+    }
+
+
+    //**********************************************************************
+    bool string::is_local() const noexcept
+    { return buffer == local_buffer; }
+
+
+    //**********************************************************************
+    usize string::byte_offset(usize index) const noexcept(!Envy::debug)
+    {
+        if(ascii)
+        {
+            Envy::debug_assert(index <= buffer_size, "Envy::string code point index out of range");
+            return std::min(index, buffer_size);
+        }
+
+        const utf8::code_unit* ptr {buffer};
+        usize steps {index};
+
+        // short strings and strings without an index, for want of memory, are walked from the start
+        if(!is_local() && update_index())
+        {
+            const offset_index* const offsets {heap.offsets};
+
+            Envy::debug_assert(index <= offsets->code_points, "Envy::string code point index out of range");
+
+            if(index >= offsets->code_points)
+            { return buffer_size; }
+
+            ptr += offsets->samples[index / offset_index::stride];
+            steps = index % offset_index::stride;
+        }
+
+        const utf8::code_unit* const end {buffer + buffer_size};
+
+        for(; steps > 0u && ptr < end; --steps)
+        { utf8::increment_ptr(&ptr); }
+
+        Envy::debug_assert(steps == 0u, "Envy::string code point index out of range");
+
+        return static_cast<usize>(ptr - buffer);
+    }
+
+
+    //**********************************************************************
+    bool string::update_index() const noexcept
+    {
+        constexpr u64 high_bits {0x8080808080808080ull};
+        constexpr usize stride {offset_index::stride};
+
+        try
+        {
+            offset_index*& offsets {heap.offsets};
+
+            if(offsets == nullptr)
+            { offsets = std::pmr::polymorphic_allocator<> {resource}.new_object<offset_index>(resource); }
+
+            usize i {offsets->bytes};
+            usize indexed {offsets->code_points};
+
+            while(i < buffer_size)
+            {
+                // ascii eight code units at a time, holds at most one sample as the stride is wider
+                if(buffer_size - i >= 8u)
+                {
+                    u64 word;
+                    std::memcpy(&word, buffer + i, 8u);
+
+                    if((word & high_bits) == 0u)
+                    {
+                        const usize to_sample {(stride - indexed % stride) % stride};
+
+                        if(to_sample < 8u)
+                        { offsets->samples.push_back(i + to_sample); }
+
+                        indexed += 8u;
+                        i += 8u;
+                        continue;
+                    }
+                }
+
+                if(!utf8::is_continuation_unit(buffer + i))
+                {
+                    if(indexed % stride == 0u)
+                    { offsets->samples.push_back(i); }
+
+                    ++indexed;
+                }
+
+                ++i;
+            }
+
+            offsets->bytes = buffer_size;
+            offsets->code_points = indexed;
+            code_point_count = indexed;
+        }
+        catch(const std::bad_alloc&)
+        {
+            // samples past the covered prefix may have been pushed, start over next time
+            reset_index();
+            return false;
+        }
+
+        return true;
+    }
+
+
+    //**********************************************************************
+    void string::reset_index() const noexcept
+    {
+        if(is_local())
+        { return; }
+
+        if(offset_index* const offsets {heap.offsets}; offsets != nullptr)
+        {
+            offsets->samples.clear();
+            offsets->bytes = 0u;
+            offsets->code_points = 0u;
+        }
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string::splice(usize offset, usize erase_bytes, string_view insert)
+    {
+        // the inserted text may view this string, copy it before the buffer can move
+        if(!insert.empty() && std::less_equal<>{}(buffer, insert.data()) && std::less<>{}(insert.data(), buffer + buffer_size))
+        { return splice(offset, erase_bytes, string_view {Envy::string {insert}}); }
+
+        const usize inserted {insert.size_bytes()};
+        const usize new_size {buffer_size - erase_bytes + inserted};
+
+        if(code_point_count != npos)
+        { code_point_count = code_point_count - static_cast<usize>(utf8::count_code_points(buffer + offset, erase_bytes)) + insert.size(); }
+
+        adjust_buffer(new_size);
+
+        // +1 to move the null-terminator along
+        std::memmove(buffer + offset + inserted, buffer + offset + erase_bytes, buffer_size - offset - erase_bytes + 1u);
+        if(inserted > 0u)
+        { std::memcpy(buffer + offset, insert.data(), inserted); }
+
+        buffer_size = new_size;
+        ascii = ascii ? insert.is_ascii() : utf8::is_ascii(buffer, buffer_size);
+
+        // samples before the edit are still valid, but the index has to stay a prefix
+        if(!is_local() && heap.offsets != nullptr && offset < heap.offsets->bytes)
+        { reset_index(); }
+
+        return utf8::iterator {buffer + offset};
     }
 
 
     //**********************************************************************
     std::string replace(std::string_view str, std::string_view target, std::string_view replacement)
     {
-        std::size_t prev {0u};
-        std::size_t pos  {str.find(target)};
+        const auto* const first {reinterpret_cast<const utf8::code_unit*>(str.data())};
+        const auto* const needle {reinterpret_cast<const utf8::code_unit*>(target.data())};
+
+        const usize matches {utf8::count_sequence(first, str.size(), needle, target.size())};
+
         std::string result;
+        result.reserve(str.size() - matches * target.size() + matches * replacement.size());
+
+        std::size_t prev {0u};
 
-        while(pos != std::string::npos)
+        for(usize m {}; m < matches; ++m)
         {
+            const auto pos {static_cast<std::size_t>(utf8::find_sequence(first + prev, str.size() - prev, needle, target.size()) - first)};
+
             result += str.substr(prev, pos - prev);
             result += replacement;
 
             prev = pos + target.size();
-            pos = str.find(target, pos+1);
         }
 
         result += str.substr(prev);
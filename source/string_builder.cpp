@@ -0,0 +1,229 @@
+#include <string_builder.hpp>
+
+#include <cstring>
+
+namespace Envy
+{
+
+    //**********************************************************************
+    string_builder::string_builder(std::pmr::memory_resource* resource) noexcept :
+        resource {resource}
+    { }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(Envy::string_view str)
+    {
+        return push_view(str.data(), str.size_bytes());
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(const char* cstr)
+    {
+        return push_view(reinterpret_cast<const utf8::code_unit*>(cstr), std::strlen(cstr));
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(const Envy::string& str)
+    {
+        return push_view(str.data(), str.size_bytes());
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(const std::string& str)
+    {
+        return push_view(reinterpret_cast<const utf8::code_unit*>(str.data()), str.size());
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(Envy::string&& str)
+    {
+        const usize offset {owned.size()};
+        owned.append(reinterpret_cast<const char*>(str.data()), str.size_bytes());
+        return push_owned(offset);
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(std::string&& str)
+    {
+        const usize offset {owned.size()};
+        owned.append(str);
+        return push_owned(offset);
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(utf8::code_point cp)
+    {
+        utf8::code_unit units[4];
+        utf8::encode(cp, units);
+
+        const usize offset {owned.size()};
+        owned.append(reinterpret_cast<const char*>(units), static_cast<usize>(utf8::code_units_required(cp)));
+        return push_owned(offset);
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::append(char c)
+    {
+        const usize offset {owned.size()};
+        owned.push_back(c);
+        return push_owned(offset);
+    }
+
+
+    //**********************************************************************
+    usize string_builder::size_bytes() const noexcept
+    {
+        return total_bytes;
+    }
+
+
+    //**********************************************************************
+    bool string_builder::empty() const noexcept
+    {
+        return total_bytes == 0u;
+    }
+
+
+    //**********************************************************************
+    void string_builder::clear() noexcept
+    {
+        spilled.clear();
+        owned.clear();
+        piece_count = 0u;
+        total_bytes = 0u;
+    }
+
+
+    //**********************************************************************
+    Envy::string string_builder::str() const
+    {
+        return str(resource);
+    }
+
+
+    //**********************************************************************
+    Envy::string string_builder::str(std::pmr::memory_resource* resource) const
+    {
+        Envy::string result {Envy::string::size_tag, total_bytes, resource};
+
+        write(result.buffer);
+        result.buffer[total_bytes] = '\0';
+        result.ascii = utf8::is_ascii(result.buffer, total_bytes);
+
+        return result;
+    }
+
+
+    //**********************************************************************
+    void string_builder::append_to(Envy::string& to) const
+    {
+        to.adjust_buffer(to.buffer_size + total_bytes);
+
+        utf8::code_unit* const first {to.buffer + to.buffer_size};
+        write(first);
+
+        to.ascii = to.ascii && utf8::is_ascii(first, total_bytes);
+        to.buffer_size += total_bytes;
+        to.buffer[to.buffer_size] = '\0';
+
+        if(to.code_point_count != Envy::string::npos)
+        { to.code_point_count += static_cast<usize>(utf8::count_code_points(first, total_bytes)); }
+    }
+
+
+    //**********************************************************************
+    usize string_builder::copy_to(mutable_buffer to) const noexcept
+    {
+        if(to.size() < total_bytes)
+        { return 0u; }
+
+        write(to.data());
+        return total_bytes;
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::push_view(const utf8::code_unit* data, usize size)
+    {
+        if(size == 0u)
+        { return *this; }
+
+        const piece p {data, 0u, size};
+
+        if(piece_count < local_pieces)
+        { local[piece_count] = p; }
+        else
+        {
+            // first spill moves the inline pieces over so the list stays contiguous
+            if(piece_count == local_pieces)
+            { spilled.assign(local.begin(), local.end()); }
+
+            spilled.push_back(p);
+        }
+
+        ++piece_count;
+        total_bytes += size;
+
+        return *this;
+    }
+
+
+    //**********************************************************************
+    string_builder& string_builder::push_owned(usize offset)
+    {
+        const usize size {owned.size() - offset};
+
+        if(size == 0u)
+        { return *this; }
+
+        // owned text is appended in order, so consecutive owned pieces merge into one
+        if(piece_count > 0u)
+        {
+            piece& last {piece_count <= local_pieces ? local[piece_count - 1u] : spilled.back()};
+
+            if(last.data == nullptr)
+            {
+                last.size += size;
+                total_bytes += size;
+                return *this;
+            }
+        }
+
+        push_view(nullptr, size);
+        (piece_count <= local_pieces ? local[piece_count - 1u] : spilled.back()).offset = offset;
+
+        return *this;
+    }
+
+
+    //**********************************************************************
+    std::span<const string_builder::piece> string_builder::pieces() const noexcept
+    {
+        if(piece_count <= local_pieces)
+        { return {local.data(), piece_count}; }
+
+        return {spilled.data(), spilled.size()};
+    }
+
+
+    //**********************************************************************
+    void string_builder::write(utf8::code_unit* out) const noexcept
+    {
+        const auto* owned_data {reinterpret_cast<const utf8::code_unit*>(owned.data())};
+
+        for(const auto& p : pieces())
+        {
+            std::memcpy(out, p.data ? p.data : owned_data + p.offset, p.size);
+            out += p.size;
+        }
+    }
+
+}
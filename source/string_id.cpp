@@ -0,0 +1,165 @@
+#include <string_id.hpp>
+
+#include <cstring>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <vector>
+
+namespace Envy
+{
+
+    // [[[[[[[[[[[[[[[[[[[[[[[[[[[[[[ Intern Pool ]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]
+
+
+    namespace
+    {
+        // open addressing table of entries, entries and their text are allocated
+        // from a monotonic arena and never move, so ids stay valid without the lock
+        struct intern_pool
+        {
+            std::shared_mutex mutex;
+            std::pmr::monotonic_buffer_resource arena {4096u};
+            std::vector<const detail::string_id_entry*> slots = std::vector<const detail::string_id_entry*>(256u, nullptr);
+            usize count {};
+
+
+            // returns the slot holding the string, or the empty slot it belongs in
+            [[nodiscard]] usize probe(const char* data, usize size, usize hash) const noexcept
+            {
+                const usize mask {slots.size() - 1u};
+
+                for(usize i {hash & mask};; i = (i + 1u) & mask)
+                {
+                    const auto* e {slots[i]};
+
+                    if(e == nullptr)
+                    { return i; }
+
+                    if(e->hash == hash && e->size == size && std::memcmp(e->data, data, size) == 0)
+                    { return i; }
+                }
+            }
+
+
+            // doubles the table, keeps the load factor under one half
+            void grow()
+            {
+                std::vector<const detail::string_id_entry*> old {std::move(slots)};
+                slots.assign(old.size() * 2u, nullptr);
+
+                const usize mask {slots.size() - 1u};
+
+                for(const auto* e : old)
+                {
+                    if(e == nullptr)
+                    { continue; }
+
+                    usize i {e->hash & mask};
+                    while(slots[i] != nullptr)
+                    { i = (i + 1u) & mask; }
+                    slots[i] = e;
+                }
+            }
+
+
+            [[nodiscard]] const detail::string_id_entry* find(const char* data, usize size, usize hash)
+            {
+                std::shared_lock l {mutex};
+                return slots[probe(data, size, hash)];
+            }
+
+
+            // 'is_static' text outlives the pool and is not copied
+            [[nodiscard]] const detail::string_id_entry* intern(const char* data, usize size, usize hash, bool is_static)
+            {
+                if(size == 0u)
+                { return &detail::empty_string_id_entry; }
+
+                if(const auto* e {find(data, size, hash)})
+                { return e; }
+
+                std::unique_lock l {mutex};
+
+                // another thread may have interned it between the locks
+                usize slot {probe(data, size, hash)};
+
+                if(slots[slot] != nullptr)
+                { return slots[slot]; }
+
+                if((count + 1u) * 2u > slots.size())
+                {
+                    grow();
+                    slot = probe(data, size, hash);
+                }
+
+                if(!is_static)
+                {
+                    auto* text {static_cast<char*>(arena.allocate(size + 1u, alignof(char)))};
+                    std::memcpy(text, data, size);
+                    text[size] = '\0';
+                    data = text;
+                }
+
+                auto* e {static_cast<detail::string_id_entry*>(arena.allocate(sizeof(detail::string_id_entry), alignof(detail::string_id_entry)))};
+                slots[slot] = ::new (e) detail::string_id_entry {hash, size, data};
+                ++count;
+
+                return e;
+            }
+        };
+
+
+        // never destroyed, ids held by static objects must outlive it
+        intern_pool& pool()
+        {
+            static intern_pool* p {new intern_pool};
+            return *p;
+        }
+    }
+
+
+    // [[[[[[[[[[[[[[[[[[[[[[[[[[[[[[ Envy::string_id ]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]
+
+
+    //**********************************************************************
+    string_id::string_id(Envy::string_view str) :
+        entry
+        {
+            pool().intern(reinterpret_cast<const char*>(str.data()), str.size_bytes(),
+                detail::hash_string_id(reinterpret_cast<const char*>(str.data()), str.size_bytes()), false)
+        }
+    {}
+
+
+    //**********************************************************************
+    string_id::string_id(literal lit) :
+        entry {pool().intern(lit.data, lit.size, lit.hash, true)}
+    {}
+
+
+    //**********************************************************************
+    std::optional<string_id> string_id::find(Envy::string_view str)
+    {
+        const auto* data {reinterpret_cast<const char*>(str.data())};
+
+        if(str.size_bytes() == 0u)
+        { return string_id {}; }
+
+        if(const auto* e {pool().find(data, str.size_bytes(), detail::hash_string_id(data, str.size_bytes()))})
+        { return string_id {e}; }
+
+        return std::nullopt;
+    }
+
+
+    //**********************************************************************
+    usize string_id::pool_size()
+    {
+        auto& p {pool()};
+        std::shared_lock l {p.mutex};
+        return p.count;
+    }
+
+}
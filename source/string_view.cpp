@@ -1,7 +1,10 @@
 #include <string_view.hpp>
 #include <string.hpp>
+#include <unicode.hpp>
+#include <code_point_set.hpp>
 
 #include <ranges>
+#include <cstring>
 #include <algorithm>
 
 namespace Envy
@@ -19,7 +22,7 @@ namespace Envy
     string_view::string_view(const Envy::string& str) noexcept :
         size_{str.size_bytes()},
         ptr_{str.data()},
-        code_point_count { string::npos }
+        code_point_count { str.is_ascii() ? str.size_bytes() : string::npos }
     {}
 
 
@@ -155,6 +158,11 @@ namespace Envy
     }
 
 
+    //**********************************************************************
+    bool string_view::is_ascii() const noexcept(!Envy::debug)
+    { return size() == size_; }
+
+
     //**********************************************************************
     utf8::code_point string_view::front() const noexcept(!Envy::debug)
     { return utf8::decode(ptr_); }
@@ -190,38 +198,153 @@ namespace Envy
     }
 
 
+    //**********************************************************************
+    utf8::iterator string_view::find(string_view sv) const noexcept
+    {
+        const auto* match {utf8::find_sequence(ptr_, size_, sv.ptr_, sv.size_)};
+        return match ? utf8::iterator {match} : end();
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string_view::find(utf8::code_point cp) const noexcept
+    {
+        // a known ascii view can't contain anything wider
+        if(static_cast<u32>(cp) >= 0x80u && code_point_count == size_)
+        { return end(); }
+
+        utf8::code_unit encoded[4];
+        utf8::encode(cp, encoded);
+
+        return find(string_view {encoded, static_cast<usize>(utf8::code_units_required(cp))});
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string_view::find_last(string_view sv) const noexcept
+    {
+        const auto* match {utf8::find_last_sequence(ptr_, size_, sv.ptr_, sv.size_)};
+        return match ? utf8::iterator {match} : end();
+    }
+
+
+    //**********************************************************************
+    utf8::iterator string_view::find_last(utf8::code_point cp) const noexcept
+    {
+        if(static_cast<u32>(cp) >= 0x80u && code_point_count == size_)
+        { return end(); }
+
+        utf8::code_unit encoded[4];
+        utf8::encode(cp, encoded);
+
+        return find_last(string_view {encoded, static_cast<usize>(utf8::code_units_required(cp))});
+    }
+
+
+    //**********************************************************************
+    i32 string_view::count(string_view sv) const noexcept
+    {
+        return static_cast<i32>(utf8::count_sequence(ptr_, size_, sv.ptr_, sv.size_));
+    }
+
+
+    //**********************************************************************
+    i32 string_view::count(utf8::code_point cp) const noexcept
+    {
+        utf8::code_unit encoded[4];
+        utf8::encode(cp, encoded);
+
+        return count(string_view {encoded, static_cast<usize>(utf8::code_units_required(cp))});
+    }
+
+
     //**********************************************************************
     bool string_view::contains(string_view sv) const noexcept
     {
-        return ! std::ranges::search(*this, sv).empty();
+        // UTF-8 is self-synchronizing, a byte match of a well-formed needle always begins on a code point
+        return sv.size_ == 0u || utf8::find_sequence(ptr_, size_, sv.ptr_, sv.size_) != nullptr;
     }
 
 
     //**********************************************************************
     bool string_view::contains(utf8::code_point cp) const noexcept
     {
-        return std::ranges::any_of(*this, [&cp](const utf8::code_point& this_cp){ return this_cp == cp; });
+        return find(cp) != end();
+    }
+
+
+    //**********************************************************************
+    bool string_view::contains_any(string_view sv) const
+    {
+        return utf8::code_point_set {sv}.find_first_of(ptr_, size_) != nullptr;
+    }
+
+
+    //**********************************************************************
+    bool string_view::contains_all(string_view sv) const
+    {
+        const utf8::code_point_set wanted {sv};
+        utf8::code_point_set found;
+
+        const utf8::code_unit* p {ptr_};
+        const utf8::code_unit* const last {ptr_ + size_};
+
+        // jump between members, recording each distinct one until all have been seen
+        while(found.size() < wanted.size())
+        {
+            p = wanted.find_first_of(p, static_cast<usize>(last - p));
+
+            if(p == nullptr)
+            { return false; }
+
+            const utf8::decode_result r {utf8::decode_checked(p, static_cast<usize>(last - p))};
+
+            if(!found.contains(r.cp))
+            { found.insert(r.cp); }
+
+            p += r.length;
+        }
+
+        return true;
+    }
+
+
+    //**********************************************************************
+    bool string_view::contains_only(string_view sv) const
+    {
+        return utf8::code_point_set {sv}.find_first_not_of(ptr_, size_) == nullptr;
+    }
+
+
+    //**********************************************************************
+    bool string_view::equals_ignore_case(string_view sv) const noexcept
+    {
+        return utf8::equal_ignore_case(*this, sv);
     }
 
 
     //**********************************************************************
-    bool string_view::contains_any(string_view sv) const noexcept
+    std::weak_ordering string_view::compare_ignore_case(string_view sv) const noexcept
     {
-        return std::ranges::any_of(*this, [&sv](const utf8::code_point& cp){ return sv.contains(cp); });
+        return utf8::compare_ignore_case(*this, sv);
     }
 
 
     //**********************************************************************
-    bool string_view::contains_all(string_view sv) const noexcept
+    usize string_view::hash_ignore_case() const noexcept
     {
-        return std::ranges::all_of(sv, [this](const utf8::code_point& cp){ return this->contains(cp); });
+        return utf8::hash_ignore_case(*this);
     }
 
 
     //**********************************************************************
-    bool string_view::contains_only(string_view sv) const noexcept
+    Envy::string string_view::fold_case() const
     {
-        return std::ranges::all_of(*this, [&sv](const utf8::code_point& cp){ return sv.contains(cp); });
+        Envy::string folded { Envy::string::reserve_tag, utf8::max_folded_size(size_) };
+        folded.buffer_size = utf8::fold_case(ptr_, size_, folded.buffer);
+        folded.buffer[folded.buffer_size] = '\0';
+        folded.ascii = utf8::is_ascii(folded.buffer, folded.buffer_size);
+        return folded;
     }
 
 
@@ -0,0 +1,375 @@
+#include <text_buffer.hpp>
+#include <log.hpp>
+
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <utility>
+
+namespace Envy
+{
+
+    //**********************************************************************
+    text_buffer::text_buffer(std::pmr::memory_resource* resource) noexcept :
+        resource {resource}
+    { }
+
+
+    //**********************************************************************
+    text_buffer::text_buffer(Envy::string_view text, std::pmr::memory_resource* resource) :
+        resource {resource}
+    {
+        insert(0u, text);
+    }
+
+
+    //**********************************************************************
+    text_buffer::text_buffer(const text_buffer& other) :
+        resource {std::pmr::get_default_resource()}
+    {
+        *this = other;
+    }
+
+
+    //**********************************************************************
+    text_buffer::text_buffer(text_buffer&& other) noexcept :
+        resource {other.resource}
+    {
+        steal(other);
+    }
+
+
+    //**********************************************************************
+    text_buffer& text_buffer::operator=(const text_buffer& other)
+    {
+        if(&other != this)
+        {
+            clear();
+            reserve_gap(other.size_bytes());
+
+            const auto parts {other.segments()};
+            const usize first_bytes {parts[0].size_bytes()};
+
+            if(first_bytes > 0u)
+            { std::memcpy(buffer, parts[0].data(), first_bytes); }
+            if(parts[1].size_bytes() > 0u)
+            { std::memcpy(buffer + first_bytes, parts[1].data(), parts[1].size_bytes()); }
+
+            gap_begin = other.size_bytes();
+            code_point_count = other.code_point_count;
+        }
+        return *this;
+    }
+
+
+    //**********************************************************************
+    text_buffer& text_buffer::operator=(text_buffer&& other)
+    {
+        if(&other != this)
+        {
+            // storage can only change hands between equal resources, otherwise copy, which can throw
+            if(resource->is_equal(*other.resource))
+            {
+                release();
+                steal(other);
+            }
+            else
+            { *this = static_cast<const text_buffer&>(other); }
+        }
+        return *this;
+    }
+
+
+    //**********************************************************************
+    text_buffer::~text_buffer()
+    {
+        release();
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::size_bytes() const noexcept
+    {
+        return buffer_capacity - gap_size();
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::size() const noexcept
+    {
+        return code_point_count;
+    }
+
+
+    //**********************************************************************
+    bool text_buffer::empty() const noexcept
+    {
+        return size_bytes() == 0u;
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::next(usize offset) const noexcept(!Envy::debug)
+    {
+        check_offset(offset);
+        Envy::debug_assert(offset < size_bytes(), "Envy::text_buffer::next() at the end of the text");
+
+        return offset + static_cast<usize>(utf8::code_units_encoded(unit_at(offset)));
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::prev(usize offset) const noexcept(!Envy::debug)
+    {
+        check_offset(offset);
+        Envy::debug_assert(offset > 0u, "Envy::text_buffer::prev() at the start of the text");
+
+        do { --offset; }
+        while(offset > 0u && utf8::is_continuation_unit(unit_at(offset)));
+
+        return offset;
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::offset_of(usize index) const noexcept(!Envy::debug)
+    {
+        Envy::debug_assert(index <= code_point_count, "Envy::text_buffer code point index out of range");
+
+        // the text before the gap is counted in one pass rather than walked
+        const usize before_gap {static_cast<usize>(utf8::count_code_points(buffer, gap_begin))};
+
+        usize offset {};
+
+        if(index >= before_gap)
+        {
+            offset = gap_begin;
+            index -= before_gap;
+        }
+
+        for(; index > 0u; --index)
+        { offset += static_cast<usize>(utf8::code_units_encoded(unit_at(offset))); }
+
+        return offset;
+    }
+
+
+    //**********************************************************************
+    utf8::code_point text_buffer::at(usize offset) const noexcept(!Envy::debug)
+    {
+        check_offset(offset);
+        Envy::debug_assert(offset < size_bytes(), "Envy::text_buffer::at() offset out of range");
+
+        return *utf8::iterator {unit_at(offset)};
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::insert(usize offset, Envy::string_view text)
+    {
+        check_offset(offset);
+
+        if(text.empty())
+        { return offset; }
+
+        // growing could free the text being inserted
+        if(overlaps(text))
+        {
+            const Envy::string copy {text};
+            return insert(offset, copy);
+        }
+
+        reserve_gap(text.size_bytes());
+        move_gap(offset);
+
+        std::memcpy(buffer + gap_begin, text.data(), text.size_bytes());
+        gap_begin += text.size_bytes();
+        code_point_count += static_cast<usize>(utf8::count_code_points(text.data(), text.size_bytes()));
+
+        return gap_begin;
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::insert(usize offset, const char* text)
+    {
+        return insert(offset, Envy::string_view {text});
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::insert(usize offset, utf8::code_point cp)
+    {
+        utf8::code_unit units[4];
+        utf8::encode(cp, units);
+
+        return insert(offset, Envy::string_view {units, static_cast<usize>(utf8::code_units_required(cp))});
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::remove(usize offset, usize count) noexcept(!Envy::debug)
+    {
+        check_offset(offset);
+        move_gap(offset);
+
+        // the text after the gap starts at a code point, swallow it one code point at a time
+        usize removed {};
+        for(; removed < count && gap_end < buffer_capacity; ++removed)
+        { gap_end += static_cast<usize>(utf8::code_units_encoded(buffer + gap_end)); }
+
+        code_point_count -= removed;
+        return offset;
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::replace(usize offset, usize count, Envy::string_view text)
+    {
+        if(overlaps(text))
+        {
+            const Envy::string copy {text};
+            return replace(offset, count, copy);
+        }
+
+        return insert(remove(offset, count), text);
+    }
+
+
+    //**********************************************************************
+    void text_buffer::clear() noexcept
+    {
+        gap_begin = 0u;
+        gap_end = buffer_capacity;
+        code_point_count = 0u;
+    }
+
+
+    //**********************************************************************
+    std::array<Envy::string_view, 2> text_buffer::segments() const noexcept
+    {
+        return
+        {
+            Envy::string_view {buffer, gap_begin},
+            Envy::string_view {buffer + gap_end, buffer_capacity - gap_end}
+        };
+    }
+
+
+    //**********************************************************************
+    Envy::string_view text_buffer::view() noexcept
+    {
+        move_gap(size_bytes());
+        return {buffer, gap_begin};
+    }
+
+
+    //**********************************************************************
+    Envy::string text_buffer::str(std::pmr::memory_resource* resource) const
+    {
+        Envy::string result {Envy::string::reserve_tag, size_bytes(), resource};
+
+        for(const auto& segment : segments())
+        { result.append(segment); }
+
+        return result;
+    }
+
+
+    //**********************************************************************
+    usize text_buffer::gap_size() const noexcept
+    {
+        return gap_end - gap_begin;
+    }
+
+
+    //**********************************************************************
+    const utf8::code_unit* text_buffer::unit_at(usize offset) const noexcept
+    {
+        return offset < gap_begin ? buffer + offset : buffer + offset + gap_size();
+    }
+
+
+    //**********************************************************************
+    bool text_buffer::overlaps(Envy::string_view text) const noexcept
+    {
+        return !text.empty() && std::less_equal<>{}(buffer, text.data()) && std::less<>{}(text.data(), buffer + buffer_capacity);
+    }
+
+
+    //**********************************************************************
+    void text_buffer::move_gap(usize offset) noexcept
+    {
+        if(offset < gap_begin)
+        {
+            const usize moved {gap_begin - offset};
+            std::memmove(buffer + gap_end - moved, buffer + offset, moved);
+            gap_begin -= moved;
+            gap_end -= moved;
+        }
+        else if(offset > gap_begin)
+        {
+            const usize moved {offset - gap_begin};
+            std::memmove(buffer + gap_begin, buffer + gap_end, moved);
+            gap_begin += moved;
+            gap_end += moved;
+        }
+    }
+
+
+    //**********************************************************************
+    void text_buffer::reserve_gap(usize bytes)
+    {
+        if(gap_size() >= bytes)
+        { return; }
+
+        const usize capacity {std::bit_ceil(size_bytes() + bytes + min_gap)};
+        const usize after_gap {buffer_capacity - gap_end};
+
+        auto* grown {static_cast<utf8::code_unit*>(resource->allocate(capacity, alignof(utf8::code_unit)))};
+
+        if(buffer != nullptr)
+        {
+            std::memcpy(grown, buffer, gap_begin);
+            std::memcpy(grown + capacity - after_gap, buffer + gap_end, after_gap);
+            resource->deallocate(buffer, buffer_capacity, alignof(utf8::code_unit));
+        }
+
+        buffer = grown;
+        buffer_capacity = capacity;
+        gap_end = capacity - after_gap;
+    }
+
+
+    //**********************************************************************
+    void text_buffer::release() noexcept
+    {
+        if(buffer != nullptr)
+        { resource->deallocate(buffer, buffer_capacity, alignof(utf8::code_unit)); }
+    }
+
+
+    //**********************************************************************
+    void text_buffer::steal(text_buffer& from) noexcept
+    {
+        buffer           = std::exchange(from.buffer, nullptr);
+        buffer_capacity  = std::exchange(from.buffer_capacity, 0u);
+        gap_begin        = std::exchange(from.gap_begin, 0u);
+        gap_end          = std::exchange(from.gap_end, 0u);
+        code_point_count = std::exchange(from.code_point_count, 0u);
+    }
+
+
+    //**********************************************************************
+    void text_buffer::check_offset(usize offset) const noexcept(!Envy::debug)
+    {
+        if constexpr (Envy::debug)
+        {
+            Envy::debug_assert(offset <= size_bytes(), "Envy::text_buffer offset out of range");
+
+            if(offset < size_bytes())
+            { Envy::debug_assert(!utf8::is_continuation_unit(unit_at(offset)), "Envy::text_buffer offset splits a code point"); }
+        }
+    }
+
+}
@@ -0,0 +1,564 @@
+#include <unicode.hpp>
+#include <cpu.hpp>
+#include "unicode_tables.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(ENVY_ARCH_X86)
+    #include <immintrin.h>
+#endif
+
+namespace Envy::utf8
+{
+
+    // ==== table lookups ====
+
+    namespace
+    {
+        const unicode_tables::property_record& lookup_properties(code_point cp) noexcept
+        {
+            using namespace unicode_tables;
+
+            u32 value { static_cast<u32>(cp) };
+
+            if(value > 0x10FFFFu)
+            { value = 0x10FFFFu; } // a noncharacter, unassigned and neutral
+
+            const u32 block { property_stage1[value >> property_shift] };
+            const u32 offset { value & ((1u << property_shift) - 1u) };
+
+            return unicode_tables::properties[property_stage2[(block << property_shift) + offset]];
+        }
+
+
+        const unicode_tables::case_record& lookup_cases(code_point cp) noexcept
+        {
+            using namespace unicode_tables;
+
+            const u32 value { static_cast<u32>(cp) };
+
+            if(value >= case_limit)
+            { return unicode_tables::cases[0]; } // no mapping
+
+            const u32 block { case_stage1[value >> case_shift] };
+            const u32 offset { value & ((1u << case_shift) - 1u) };
+
+            return unicode_tables::cases[case_stage2[(block << case_shift) + offset]];
+        }
+
+
+        const unicode_tables::break_record& lookup_breaks(code_point cp) noexcept
+        {
+            using namespace unicode_tables;
+
+            u32 value { static_cast<u32>(cp) };
+
+            if(value > 0x10FFFFu)
+            { value = 0x10FFFFu; }
+
+            const u32 block { break_stage1[value >> break_shift] };
+            const u32 offset { value & ((1u << break_shift) - 1u) };
+
+            return breaks[break_stage2[(block << break_shift) + offset]];
+        }
+    }
+
+
+    // ==== property queries ====
+
+    general_category category(code_point cp) noexcept
+    { return lookup_properties(cp).category; }
+
+
+    east_asian_width width_class(code_point cp) noexcept
+    { return lookup_properties(cp).width; }
+
+
+    usize display_width(code_point cp) noexcept
+    { return lookup_properties(cp).columns; }
+
+
+    usize display_width(const Envy::string_view& str) noexcept
+    {
+        const code_unit* ptr { str.data() };
+        const code_unit* const end { ptr + str.size_bytes() };
+
+        usize columns {0};
+
+        while(ptr < end)
+        {
+            // ascii is one column, save for the controls
+            if(*ptr < 0x80u)
+            {
+                columns += (*ptr >= 0x20u && *ptr != 0x7Fu);
+                ++ptr;
+                continue;
+            }
+
+            const decode_result result { decode_checked(ptr, static_cast<usize>(end - ptr)) };
+            columns += result.valid ? display_width(result.cp) : 1u; // rendered as U+FFFD
+            ptr += result.length;
+        }
+
+        return columns;
+    }
+
+
+    code_point to_upper(code_point cp) noexcept
+    { return static_cast<u32>(static_cast<i32>(static_cast<u32>(cp)) + lookup_cases(cp).to_upper); }
+
+
+    code_point to_lower(code_point cp) noexcept
+    { return static_cast<u32>(static_cast<i32>(static_cast<u32>(cp)) + lookup_cases(cp).to_lower); }
+
+
+    code_point fold_case(code_point cp) noexcept
+    { return static_cast<u32>(static_cast<i32>(static_cast<u32>(cp)) + lookup_cases(cp).fold); }
+
+
+    bool is_letter(code_point cp) noexcept
+    { return category(cp) <= general_category::other_letter; }
+
+
+    bool is_digit(code_point cp) noexcept
+    { return category(cp) == general_category::decimal_number; }
+
+
+    bool is_alphanumeric(code_point cp) noexcept
+    {
+        const general_category c { category(cp) };
+        return c <= general_category::other_letter || c == general_category::decimal_number;
+    }
+
+
+    bool is_whitespace(code_point cp) noexcept
+    {
+        const u32 value { static_cast<u32>(cp) };
+
+        if(value < 0x80u)
+        { return value == ' ' || (value >= '\t' && value <= '\r'); }
+
+        const general_category c { category(cp) };
+        return c >= general_category::space_separator && c <= general_category::paragraph_separator;
+    }
+
+
+    bool is_upper(code_point cp) noexcept
+    {
+        const general_category c { category(cp) };
+        return c == general_category::uppercase_letter || c == general_category::titlecase_letter;
+    }
+
+
+    bool is_lower(code_point cp) noexcept
+    { return category(cp) == general_category::lowercase_letter; }
+
+
+    grapheme_break grapheme_break_property(code_point cp) noexcept
+    { return lookup_breaks(cp).grapheme; }
+
+
+    line_break line_break_class(code_point cp) noexcept
+    { return lookup_breaks(cp).line; }
+
+
+    // ==== case folding kernels ====
+
+    namespace
+    {
+        constexpr u64 high_bits {0x8080808080808080ull};
+        constexpr u64 low_bits  {0x0101010101010101ull};
+
+
+        constexpr code_unit fold_ascii(code_unit c) noexcept
+        { return (c >= 'A' && c <= 'Z') ? static_cast<code_unit>(c | 0x20u) : c; }
+
+
+        // folds eight ascii code units at once, every byte of 'word' must be ascii
+        constexpr u64 fold_ascii_word(u64 word) noexcept
+        {
+            const u64 at_least_a { word + low_bits * (0x80u - 'A') };     // high bit set where byte >= 'A'
+            const u64 past_z     { word + low_bits * (0x80u - 'Z' - 1u) }; // high bit set where byte > 'Z'
+            return word | ((at_least_a & ~past_z & high_bits) >> 2);     // 0x80 >> 2 is the case bit
+        }
+
+
+        // returns the length of the common prefix of a and b that is ascii and equal ignoring case
+        usize common_ascii_prefix_scalar(const code_unit* a, const code_unit* b, usize size) noexcept
+        {
+            usize i {};
+
+            for(; size - i >= 8u; i += 8u)
+            {
+                u64 word_a;
+                u64 word_b;
+                std::memcpy(&word_a, a + i, 8u);
+                std::memcpy(&word_b, b + i, 8u);
+
+                if((word_a | word_b) & high_bits)
+                { break; }
+
+                const u64 difference { fold_ascii_word(word_a) ^ fold_ascii_word(word_b) };
+
+                if(difference)
+                { return i + static_cast<usize>(std::countr_zero(difference) / 8); }
+            }
+
+            for(; i < size; ++i)
+            {
+                if(((a[i] | b[i]) & 0x80u) || fold_ascii(a[i]) != fold_ascii(b[i]))
+                { break; }
+            }
+
+            return i;
+        }
+
+
+        // folds the leading ascii of 'buffer' into 'out', returns the code units folded
+        usize fold_ascii_prefix_scalar(const code_unit* buffer, usize size, code_unit* out) noexcept
+        {
+            usize i {};
+
+            for(; size - i >= 8u; i += 8u)
+            {
+                u64 word;
+                std::memcpy(&word, buffer + i, 8u);
+
+                if(word & high_bits)
+                { break; }
+
+                word = fold_ascii_word(word);
+                std::memcpy(out + i, &word, 8u);
+            }
+
+            for(; i < size && buffer[i] < 0x80u; ++i)
+            { out[i] = fold_ascii(buffer[i]); }
+
+            return i;
+        }
+
+
+        #if defined(ENVY_ARCH_X86)
+
+        ENVY_TARGET_SSE2 __m128i fold_ascii_sse2(__m128i v) noexcept
+        {
+            // signed compares, non-ascii bytes are negative and never uppercase
+            const __m128i upper { _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1))) };
+            return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+        }
+
+
+        ENVY_TARGET_SSE2 usize common_ascii_prefix_sse2(const code_unit* a, const code_unit* b, usize size) noexcept
+        {
+            usize i {};
+
+            for(; size - i >= 16u; i += 16u)
+            {
+                const __m128i va { _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)) };
+                const __m128i vb { _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i)) };
+
+                const u32 non_ascii { static_cast<u32>(_mm_movemask_epi8(_mm_or_si128(va, vb))) };
+                const u32 equal { static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(fold_ascii_sse2(va), fold_ascii_sse2(vb)))) };
+                const u32 stop { (non_ascii | ~equal) & 0xFFFFu };
+
+                if(stop)
+                { return i + static_cast<usize>(std::countr_zero(stop)); }
+            }
+
+            return i + common_ascii_prefix_scalar(a + i, b + i, size - i);
+        }
+
+
+        ENVY_TARGET_SSE2 usize fold_ascii_prefix_sse2(const code_unit* buffer, usize size, code_unit* out) noexcept
+        {
+            usize i {};
+
+            for(; size - i >= 16u; i += 16u)
+            {
+                const __m128i v { _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i)) };
+
+                if(_mm_movemask_epi8(v))
+                { break; }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), fold_ascii_sse2(v));
+            }
+
+            return i + fold_ascii_prefix_scalar(buffer + i, size - i, out + i);
+        }
+
+
+        ENVY_TARGET_AVX2 __m256i fold_ascii_avx2(__m256i v) noexcept
+        {
+            const __m256i upper { _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), v)) };
+            return _mm256_or_si256(v, _mm256_and_si256(upper, _mm256_set1_epi8(0x20)));
+        }
+
+
+        ENVY_TARGET_AVX2 usize common_ascii_prefix_avx2(const code_unit* a, const code_unit* b, usize size) noexcept
+        {
+            usize i {};
+
+            for(; size - i >= 32u; i += 32u)
+            {
+                const __m256i va { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)) };
+                const __m256i vb { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i)) };
+
+                const u32 non_ascii { static_cast<u32>(_mm256_movemask_epi8(_mm256_or_si256(va, vb))) };
+                const u32 equal { static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(fold_ascii_avx2(va), fold_ascii_avx2(vb)))) };
+                const u32 stop { non_ascii | ~equal };
+
+                if(stop)
+                { return i + static_cast<usize>(std::countr_zero(stop)); }
+            }
+
+            return i + common_ascii_prefix_scalar(a + i, b + i, size - i);
+        }
+
+
+        ENVY_TARGET_AVX2 usize fold_ascii_prefix_avx2(const code_unit* buffer, usize size, code_unit* out) noexcept
+        {
+            usize i {};
+
+            for(; size - i >= 32u; i += 32u)
+            {
+                const __m256i v { _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i)) };
+
+                if(_mm256_movemask_epi8(v))
+                { break; }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), fold_ascii_avx2(v));
+            }
+
+            return i + fold_ascii_prefix_scalar(buffer + i, size - i, out + i);
+        }
+
+        #endif
+
+
+        usize common_ascii_prefix(const code_unit* a, const code_unit* b, usize size) noexcept
+        {
+            #if defined(ENVY_ARCH_X86)
+            switch(cpu::active_simd_level())
+            {
+                case cpu::simd_level::avx2: return common_ascii_prefix_avx2(a, b, size);
+                case cpu::simd_level::sse2: return common_ascii_prefix_sse2(a, b, size);
+                default: return common_ascii_prefix_scalar(a, b, size);
+            }
+            #else
+            return common_ascii_prefix_scalar(a, b, size);
+            #endif
+        }
+
+
+        usize fold_ascii_prefix(const code_unit* buffer, usize size, code_unit* out) noexcept
+        {
+            #if defined(ENVY_ARCH_X86)
+            switch(cpu::active_simd_level())
+            {
+                case cpu::simd_level::avx2: return fold_ascii_prefix_avx2(buffer, size, out);
+                case cpu::simd_level::sse2: return fold_ascii_prefix_sse2(buffer, size, out);
+                default: return fold_ascii_prefix_scalar(buffer, size, out);
+            }
+            #else
+            return fold_ascii_prefix_scalar(buffer, size, out);
+            #endif
+        }
+
+
+        // a case folded code point, or the code units of an ill-formed subpart tagged past every code point
+        struct folded_unit
+        {
+            u32 key;
+            i32 length;
+            bool valid;
+        };
+
+
+        folded_unit fold_next(const code_unit* ptr, const code_unit* last) noexcept
+        {
+            if(*ptr < 0x80u)
+            { return { fold_ascii(*ptr), 1, true }; }
+
+            const decode_result result { decode_checked(ptr, static_cast<usize>(last - ptr)) };
+
+            if(result.valid)
+            { return { static_cast<u32>(fold_case(result.cp)), result.length, true }; }
+
+            u32 units {}; // ill-formed subparts are at most three code units
+
+            for(i32 i {0}; i < result.length; ++i)
+            { units = (units << 8) | ptr[i]; }
+
+            return { units | 0x80000000u, result.length, false };
+        }
+
+
+        // compares a and b up to the first code point that differs when folded
+        std::weak_ordering compare_folded(const Envy::string_view& a, const Envy::string_view& b) noexcept
+        {
+            const code_unit* pa {a.data()};
+            const code_unit* pb {b.data()};
+            const code_unit* const end_a {pa + a.size_bytes()};
+            const code_unit* const end_b {pb + b.size_bytes()};
+
+            while(true)
+            {
+                const usize common { common_ascii_prefix(pa, pb, static_cast<usize>(std::min(end_a - pa, end_b - pb))) };
+                pa += common;
+                pb += common;
+
+                if(pa == end_a && pb == end_b)
+                { return std::weak_ordering::equivalent; }
+
+                if(pa == end_a)
+                { return std::weak_ordering::less; }
+
+                if(pb == end_b)
+                { return std::weak_ordering::greater; }
+
+                const folded_unit fa { fold_next(pa, end_a) };
+                const folded_unit fb { fold_next(pb, end_b) };
+
+                if(fa.key != fb.key)
+                { return fa.key < fb.key ? std::weak_ordering::less : std::weak_ordering::greater; }
+
+                pa += fa.length;
+                pb += fb.length;
+            }
+        }
+
+
+        // hashes a stream of folded code units eight at a time, independent of how the stream is split
+        class folded_hasher
+        {
+            u64 state {0x9E3779B97F4A7C15ull};
+            u64 pending {0};
+            u32 pending_size {0};
+            u64 length {0};
+
+            void mix(u64 word) noexcept
+            {
+                state = (state ^ word) * 0xBF58476D1CE4E5B9ull;
+                state ^= state >> 31;
+            }
+
+        public:
+
+            // appends the low 'count' bytes of 'units', count is at most 8
+            void append(u64 units, u32 count) noexcept
+            {
+                pending |= units << (8u * pending_size);
+                length += count;
+
+                if(pending_size + count < 8u)
+                {
+                    pending_size += count;
+                    return;
+                }
+
+                mix(pending);
+
+                const u32 used {8u - pending_size};
+                pending = used < 8u ? units >> (8u * used) : 0u;
+                pending_size = pending_size + count - 8u;
+            }
+
+            [[nodiscard]] usize finish() noexcept
+            {
+                mix(pending ^ (length << 56));
+
+                u64 h {state};
+                h = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ull;
+                h = (h ^ (h >> 27)) * 0x94D049BB133111EBull;
+                return static_cast<usize>(h ^ (h >> 31));
+            }
+        };
+    }
+
+
+    usize fold_case(const code_unit* buffer, usize size_bytes, code_unit* out) noexcept
+    {
+        const code_unit* ptr {buffer};
+        const code_unit* const last {buffer + size_bytes};
+        code_unit* const out_first {out};
+
+        while(ptr < last)
+        {
+            const usize ascii { fold_ascii_prefix(ptr, static_cast<usize>(last - ptr), out) };
+            ptr += ascii;
+            out += ascii;
+
+            if(ptr == last)
+            { break; }
+
+            const folded_unit folded { fold_next(ptr, last) };
+
+            if(folded.valid)
+            {
+                encode(folded.key, out);
+                out += code_units_required(folded.key);
+            }
+            else
+            {
+                std::memcpy(out, ptr, static_cast<usize>(folded.length));
+                out += folded.length;
+            }
+
+            ptr += folded.length;
+        }
+
+        return static_cast<usize>(out - out_first);
+    }
+
+
+    bool equal_ignore_case(const Envy::string_view& a, const Envy::string_view& b) noexcept
+    { return compare_folded(a, b) == 0; }
+
+
+    std::weak_ordering compare_ignore_case(const Envy::string_view& a, const Envy::string_view& b) noexcept
+    { return compare_folded(a, b); }
+
+
+    usize hash_ignore_case(const Envy::string_view& str) noexcept
+    {
+        const code_unit* ptr {str.data()};
+        const code_unit* const last {ptr + str.size_bytes()};
+
+        folded_hasher hasher;
+
+        while(ptr < last)
+        {
+            if(last - ptr >= 8)
+            {
+                u64 word;
+                std::memcpy(&word, ptr, 8u);
+
+                if((word & high_bits) == 0u)
+                {
+                    hasher.append(fold_ascii_word(word), 8u);
+                    ptr += 8;
+                    continue;
+                }
+            }
+
+            const folded_unit folded { fold_next(ptr, last) };
+            code_unit units[4] {};
+
+            if(folded.valid)
+            { encode(folded.key, units); }
+            else
+            { std::memcpy(units, ptr, static_cast<usize>(folded.length)); }
+
+            u64 word {};
+            std::memcpy(&word, units, 4u);
+
+            hasher.append(word, folded.valid ? static_cast<u32>(code_units_required(folded.key)) : static_cast<u32>(folded.length));
+            ptr += folded.length;
+        }
+
+        return hasher.finish();
+    }
+
+}
@@ -0,0 +1,3341 @@
+// Generated by tools/gen_unicode_tables.py from the Unicode Character Database 14.0.0, do not edit
+
+#pragma once
+
+#include <unicode.hpp>
+
+namespace Envy::utf8::unicode_tables
+{
+    struct property_record
+    {
+        general_category category;
+        east_asian_width width;
+        u8 columns;
+    };
+
+    struct case_record
+    {
+        i32 to_upper; ///< Added to a code point to map it to uppercase
+        i32 to_lower; ///< Added to a code point to map it to lowercase
+        i32 fold;     ///< Added to a code point to case fold it
+    };
+
+    struct break_record
+    {
+        grapheme_break grapheme;
+        line_break line;
+        line_break resolved_line; ///< line break class after LB1
+        u8 flags;
+    };
+
+    inline constexpr u8 east_asian {1u}; ///< East Asian Width F, W or H
+    inline constexpr u8 pictographic_unassigned {2u}; ///< Unassigned Extended_Pictographic
+
+    inline constexpr u32 property_shift {8u};
+    inline constexpr u32 case_shift {6u};
+    inline constexpr u32 case_limit {0x20000u};
+    inline constexpr u32 break_shift {7u};
+
+    inline constexpr property_record properties[96]
+    {
+        { general_category::control, east_asian_width::neutral, 0 },
+        { general_category::space_separator, east_asian_width::narrow, 1 },
+        { general_category::other_punctuation, east_asian_width::narrow, 1 },
+        { general_category::currency_symbol, east_asian_width::narrow, 1 },
+        { general_category::open_punctuation, east_asian_width::narrow, 1 },
+        { general_category::close_punctuation, east_asian_width::narrow, 1 },
+        { general_category::math_symbol, east_asian_width::narrow, 1 },
+        { general_category::dash_punctuation, east_asian_width::narrow, 1 },
+        { general_category::decimal_number, east_asian_width::narrow, 1 },
+        { general_category::uppercase_letter, east_asian_width::narrow, 1 },
+        { general_category::modifier_symbol, east_asian_width::narrow, 1 },
+        { general_category::connector_punctuation, east_asian_width::narrow, 1 },
+        { general_category::lowercase_letter, east_asian_width::narrow, 1 },
+        { general_category::space_separator, east_asian_width::neutral, 1 },
+        { general_category::other_punctuation, east_asian_width::ambiguous, 1 },
+        { general_category::currency_symbol, east_asian_width::ambiguous, 1 },
+        { general_category::other_symbol, east_asian_width::narrow, 1 },
+        { general_category::modifier_symbol, east_asian_width::ambiguous, 1 },
+        { general_category::other_symbol, east_asian_width::neutral, 1 },
+        { general_category::other_letter, east_asian_width::ambiguous, 1 },
+        { general_category::initial_punctuation, east_asian_width::neutral, 1 },
+        { general_category::format, east_asian_width::ambiguous, 1 },
+        { general_category::other_symbol, east_asian_width::ambiguous, 1 },
+        { general_category::math_symbol, east_asian_width::ambiguous, 1 },
+        { general_category::other_number, east_asian_width::ambiguous, 1 },
+        { general_category::lowercase_letter, east_asian_width::neutral, 1 },
+        { general_category::final_punctuation, east_asian_width::neutral, 1 },
+        { general_category::uppercase_letter, east_asian_width::neutral, 1 },
+        { general_category::uppercase_letter, east_asian_width::ambiguous, 1 },
+        { general_category::lowercase_letter, east_asian_width::ambiguous, 1 },
+        { general_category::other_letter, east_asian_width::neutral, 1 },
+        { general_category::titlecase_letter, east_asian_width::neutral, 1 },
+        { general_category::modifier_letter, east_asian_width::neutral, 1 },
+        { general_category::modifier_symbol, east_asian_width::neutral, 1 },
+        { general_category::modifier_letter, east_asian_width::ambiguous, 1 },
+        { general_category::nonspacing_mark, east_asian_width::ambiguous, 0 },
+        { general_category::unassigned, east_asian_width::fullwidth, 2 },
+        { general_category::other_punctuation, east_asian_width::neutral, 1 },
+        { general_category::math_symbol, east_asian_width::neutral, 1 },
+        { general_category::nonspacing_mark, east_asian_width::neutral, 0 },
+        { general_category::enclosing_mark, east_asian_width::neutral, 0 },
+        { general_category::dash_punctuation, east_asian_width::neutral, 1 },
+        { general_category::currency_symbol, east_asian_width::neutral, 1 },
+        { general_category::format, east_asian_width::neutral, 0 },
+        { general_category::decimal_number, east_asian_width::neutral, 1 },
+        { general_category::spacing_mark, east_asian_width::neutral, 1 },
+        { general_category::other_number, east_asian_width::neutral, 1 },
+        { general_category::open_punctuation, east_asian_width::neutral, 1 },
+        { general_category::close_punctuation, east_asian_width::neutral, 1 },
+        { general_category::other_letter, east_asian_width::wide, 2 },
+        { general_category::other_letter, east_asian_width::neutral, 0 },
+        { general_category::letter_number, east_asian_width::neutral, 1 },
+        { general_category::dash_punctuation, east_asian_width::ambiguous, 1 },
+        { general_category::initial_punctuation, east_asian_width::ambiguous, 1 },
+        { general_category::final_punctuation, east_asian_width::ambiguous, 1 },
+        { general_category::line_separator, east_asian_width::neutral, 1 },
+        { general_category::paragraph_separator, east_asian_width::neutral, 1 },
+        { general_category::connector_punctuation, east_asian_width::neutral, 1 },
+        { general_category::currency_symbol, east_asian_width::halfwidth, 1 },
+        { general_category::letter_number, east_asian_width::ambiguous, 1 },
+        { general_category::other_symbol, east_asian_width::wide, 2 },
+        { general_category::open_punctuation, east_asian_width::wide, 2 },
+        { general_category::close_punctuation, east_asian_width::wide, 2 },
+        { general_category::math_symbol, east_asian_width::wide, 2 },
+        { general_category::space_separator, east_asian_width::fullwidth, 2 },
+        { general_category::other_punctuation, east_asian_width::wide, 2 },
+        { general_category::modifier_letter, east_asian_width::wide, 2 },
+        { general_category::letter_number, east_asian_width::wide, 2 },
+        { general_category::dash_punctuation, east_asian_width::wide, 2 },
+        { general_category::nonspacing_mark, east_asian_width::wide, 0 },
+        { general_category::spacing_mark, east_asian_width::wide, 2 },
+        { general_category::modifier_symbol, east_asian_width::wide, 2 },
+        { general_category::other_number, east_asian_width::wide, 2 },
+        { general_category::surrogate, east_asian_width::neutral, 1 },
+        { general_category::private_use, east_asian_width::ambiguous, 1 },
+        { general_category::connector_punctuation, east_asian_width::wide, 2 },
+        { general_category::currency_symbol, east_asian_width::wide, 2 },
+        { general_category::other_punctuation, east_asian_width::fullwidth, 2 },
+        { general_category::currency_symbol, east_asian_width::fullwidth, 2 },
+        { general_category::open_punctuation, east_asian_width::fullwidth, 2 },
+        { general_category::close_punctuation, east_asian_width::fullwidth, 2 },
+        { general_category::math_symbol, east_asian_width::fullwidth, 2 },
+        { general_category::dash_punctuation, east_asian_width::fullwidth, 2 },
+        { general_category::decimal_number, east_asian_width::fullwidth, 2 },
+        { general_category::uppercase_letter, east_asian_width::fullwidth, 2 },
+        { general_category::modifier_symbol, east_asian_width::fullwidth, 2 },
+        { general_category::connector_punctuation, east_asian_width::fullwidth, 2 },
+        { general_category::lowercase_letter, east_asian_width::fullwidth, 2 },
+        { general_category::other_punctuation, east_asian_width::halfwidth, 1 },
+        { general_category::open_punctuation, east_asian_width::halfwidth, 1 },
+        { general_category::close_punctuation, east_asian_width::halfwidth, 1 },
+        { general_category::other_letter, east_asian_width::halfwidth, 1 },
+        { general_category::modifier_letter, east_asian_width::halfwidth, 1 },
+        { general_category::other_symbol, east_asian_width::fullwidth, 2 },
+        { general_category::other_symbol, east_asian_width::halfwidth, 1 },
+        { general_category::math_symbol, east_asian_width::halfwidth, 1 },
+    };
+
+    inline constexpr case_record cases[182]
+    {
+        { 0, 0, 0 },
+        { 0, 32, 32 },
+        { -32, 0, 0 },
+        { 743, 0, 775 },
+        { 121, 0, 0 },
+        { 0, 1, 1 },
+        { -1, 0, 0 },
+        { 0, -199, 0 },
+        { -232, 0, 0 },
+        { 0, -121, -121 },
+        { -300, 0, -268 },
+        { 195, 0, 0 },
+        { 0, 210, 210 },
+        { 0, 206, 206 },
+        { 0, 205, 205 },
+        { 0, 79, 79 },
+        { 0, 202, 202 },
+        { 0, 203, 203 },
+        { 0, 207, 207 },
+        { 97, 0, 0 },
+        { 0, 211, 211 },
+        { 0, 209, 209 },
+        { 163, 0, 0 },
+        { 0, 213, 213 },
+        { 130, 0, 0 },
+        { 0, 214, 214 },
+        { 0, 218, 218 },
+        { 0, 217, 217 },
+        { 0, 219, 219 },
+        { 56, 0, 0 },
+        { 0, 2, 2 },
+        { -1, 1, 1 },
+        { -2, 0, 0 },
+        { -79, 0, 0 },
+        { 0, -97, -97 },
+        { 0, -56, -56 },
+        { 0, -130, -130 },
+        { 0, 10795, 10795 },
+        { 0, -163, -163 },
+        { 0, 10792, 10792 },
+        { 10815, 0, 0 },
+        { 0, -195, -195 },
+        { 0, 69, 69 },
+        { 0, 71, 71 },
+        { 10783, 0, 0 },
+        { 10780, 0, 0 },
+        { 10782, 0, 0 },
+        { -210, 0, 0 },
+        { -206, 0, 0 },
+        { -205, 0, 0 },
+        { -202, 0, 0 },
+        { -203, 0, 0 },
+        { 42319, 0, 0 },
+        { 42315, 0, 0 },
+        { -207, 0, 0 },
+        { 42280, 0, 0 },
+        { 42308, 0, 0 },
+        { -209, 0, 0 },
+        { -211, 0, 0 },
+        { 10743, 0, 0 },
+        { 42305, 0, 0 },
+        { 10749, 0, 0 },
+        { -213, 0, 0 },
+        { -214, 0, 0 },
+        { 10727, 0, 0 },
+        { -218, 0, 0 },
+        { 42307, 0, 0 },
+        { 42282, 0, 0 },
+        { -69, 0, 0 },
+        { -217, 0, 0 },
+        { -71, 0, 0 },
+        { -219, 0, 0 },
+        { 42261, 0, 0 },
+        { 42258, 0, 0 },
+        { 84, 0, 116 },
+        { 0, 116, 116 },
+        { 0, 38, 38 },
+        { 0, 37, 37 },
+        { 0, 64, 64 },
+        { 0, 63, 63 },
+        { -38, 0, 0 },
+        { -37, 0, 0 },
+        { -31, 0, 1 },
+        { -64, 0, 0 },
+        { -63, 0, 0 },
+        { 0, 8, 8 },
+        { -62, 0, -30 },
+        { -57, 0, -25 },
+        { -47, 0, -15 },
+        { -54, 0, -22 },
+        { -8, 0, 0 },
+        { -86, 0, -54 },
+        { -80, 0, -48 },
+        { 7, 0, 0 },
+        { -116, 0, 0 },
+        { 0, -60, -60 },
+        { -96, 0, -64 },
+        { 0, -7, -7 },
+        { 0, 80, 80 },
+        { -80, 0, 0 },
+        { 0, 15, 15 },
+        { -15, 0, 0 },
+        { 0, 48, 48 },
+        { -48, 0, 0 },
+        { 0, 7264, 7264 },
+        { 3008, 0, 0 },
+        { 0, 38864, 0 },
+        { 0, 8, 0 },
+        { -8, 0, -8 },
+        { -6254, 0, -6222 },
+        { -6253, 0, -6221 },
+        { -6244, 0, -6212 },
+        { -6242, 0, -6210 },
+        { -6243, 0, -6211 },
+        { -6236, 0, -6204 },
+        { -6181, 0, -6180 },
+        { 35266, 0, 35267 },
+        { 0, -3008, -3008 },
+        { 35332, 0, 0 },
+        { 3814, 0, 0 },
+        { 35384, 0, 0 },
+        { -59, 0, -58 },
+        { 0, -7615, -7615 },
+        { 8, 0, 0 },
+        { 0, -8, -8 },
+        { 74, 0, 0 },
+        { 86, 0, 0 },
+        { 100, 0, 0 },
+        { 128, 0, 0 },
+        { 112, 0, 0 },
+        { 126, 0, 0 },
+        { 9, 0, 0 },
+        { 0, -74, -74 },
+        { 0, -9, -9 },
+        { -7205, 0, -7173 },
+        { 0, -86, -86 },
+        { 0, -100, -100 },
+        { 0, -112, -112 },
+        { 0, -128, -128 },
+        { 0, -126, -126 },
+        { 0, -7517, -7517 },
+        { 0, -8383, -8383 },
+        { 0, -8262, -8262 },
+        { 0, 28, 28 },
+        { -28, 0, 0 },
+        { 0, 16, 16 },
+        { -16, 0, 0 },
+        { 0, 26, 26 },
+        { -26, 0, 0 },
+        { 0, -10743, -10743 },
+        { 0, -3814, -3814 },
+        { 0, -10727, -10727 },
+        { -10795, 0, 0 },
+        { -10792, 0, 0 },
+        { 0, -10780, -10780 },
+        { 0, -10749, -10749 },
+        { 0, -10783, -10783 },
+        { 0, -10782, -10782 },
+        { 0, -10815, -10815 },
+        { -7264, 0, 0 },
+        { 0, -35332, -35332 },
+        { 0, -42280, -42280 },
+        { 48, 0, 0 },
+        { 0, -42308, -42308 },
+        { 0, -42319, -42319 },
+        { 0, -42315, -42315 },
+        { 0, -42305, -42305 },
+        { 0, -42258, -42258 },
+        { 0, -42282, -42282 },
+        { 0, -42261, -42261 },
+        { 0, 928, 928 },
+        { 0, -48, -48 },
+        { 0, -42307, -42307 },
+        { 0, -35384, -35384 },
+        { -928, 0, 0 },
+        { -38864, 0, -38864 },
+        { 0, 40, 40 },
+        { -40, 0, 0 },
+        { 0, 39, 39 },
+        { -39, 0, 0 },
+        { 0, 34, 34 },
+        { -34, 0, 0 },
+    };
+
+    inline constexpr break_record breaks[85]
+    {
+        { grapheme_break::control, line_break::combining_mark, line_break::combining_mark, 0 },
+        { grapheme_break::control, line_break::break_after, line_break::break_after, 0 },
+        { grapheme_break::lf, line_break::line_feed, line_break::line_feed, 0 },
+        { grapheme_break::control, line_break::mandatory_break, line_break::mandatory_break, 0 },
+        { grapheme_break::cr, line_break::carriage_return, line_break::carriage_return, 0 },
+        { grapheme_break::other, line_break::space, line_break::space, 0 },
+        { grapheme_break::other, line_break::exclamation, line_break::exclamation, 0 },
+        { grapheme_break::other, line_break::quotation, line_break::quotation, 0 },
+        { grapheme_break::other, line_break::alphabetic, line_break::alphabetic, 0 },
+        { grapheme_break::other, line_break::prefix_numeric, line_break::prefix_numeric, 0 },
+        { grapheme_break::other, line_break::postfix_numeric, line_break::postfix_numeric, 0 },
+        { grapheme_break::other, line_break::open_punctuation, line_break::open_punctuation, 0 },
+        { grapheme_break::other, line_break::close_parenthesis, line_break::close_parenthesis, 0 },
+        { grapheme_break::other, line_break::infix_numeric, line_break::infix_numeric, 0 },
+        { grapheme_break::other, line_break::hyphen, line_break::hyphen, 0 },
+        { grapheme_break::other, line_break::break_symbols, line_break::break_symbols, 0 },
+        { grapheme_break::other, line_break::numeric, line_break::numeric, 0 },
+        { grapheme_break::other, line_break::break_after, line_break::break_after, 0 },
+        { grapheme_break::other, line_break::close_punctuation, line_break::close_punctuation, 0 },
+        { grapheme_break::control, line_break::next_line, line_break::next_line, 0 },
+        { grapheme_break::other, line_break::glue, line_break::glue, 0 },
+        { grapheme_break::other, line_break::ambiguous, line_break::alphabetic, 0 },
+        { grapheme_break::extended_pictographic, line_break::alphabetic, line_break::alphabetic, 0 },
+        { grapheme_break::other, line_break::break_before, line_break::break_before, 0 },
+        { grapheme_break::extend, line_break::combining_mark, line_break::combining_mark, 0 },
+        { grapheme_break::extend, line_break::glue, line_break::glue, 0 },
+        { grapheme_break::other, line_break::unknown, line_break::alphabetic, 1 },
+        { grapheme_break::other, line_break::hebrew_letter, line_break::hebrew_letter, 0 },
+        { grapheme_break::prepend, line_break::alphabetic, line_break::alphabetic, 0 },
+        { grapheme_break::spacing_mark, line_break::combining_mark, line_break::combining_mark, 0 },
+        { grapheme_break::other, line_break::complex_context, line_break::alphabetic, 0 },
+        { grapheme_break::extend, line_break::complex_context, line_break::combining_mark, 0 },
+        { grapheme_break::spacing_mark, line_break::complex_context, line_break::alphabetic, 0 },
+        { grapheme_break::spacing_mark, line_break::break_after, line_break::break_after, 0 },
+        { grapheme_break::other, line_break::complex_context, line_break::combining_mark, 0 },
+        { grapheme_break::spacing_mark, line_break::complex_context, line_break::combining_mark, 0 },
+        { grapheme_break::l, line_break::jl, line_break::jl, 1 },
+        { grapheme_break::v, line_break::jv, line_break::jv, 0 },
+        { grapheme_break::t, line_break::jt, line_break::jt, 0 },
+        { grapheme_break::other, line_break::nonstarter, line_break::nonstarter, 0 },
+        { grapheme_break::control, line_break::glue, line_break::glue, 0 },
+        { grapheme_break::control, line_break::zw_space, line_break::zw_space, 0 },
+        { grapheme_break::zwj, line_break::zwj, line_break::zwj, 0 },
+        { grapheme_break::other, line_break::break_both, line_break::break_both, 0 },
+        { grapheme_break::other, line_break::inseparable, line_break::inseparable, 0 },
+        { grapheme_break::extended_pictographic, line_break::nonstarter, line_break::nonstarter, 0 },
+        { grapheme_break::control, line_break::word_joiner, line_break::word_joiner, 0 },
+        { grapheme_break::control, line_break::alphabetic, line_break::alphabetic, 0 },
+        { grapheme_break::control, line_break::unknown, line_break::alphabetic, 1 },
+        { grapheme_break::other, line_break::prefix_numeric, line_break::prefix_numeric, 1 },
+        { grapheme_break::extended_pictographic, line_break::ambiguous, line_break::alphabetic, 0 },
+        { grapheme_break::extended_pictographic, line_break::ideographic, line_break::ideographic, 1 },
+        { grapheme_break::other, line_break::open_punctuation, line_break::open_punctuation, 1 },
+        { grapheme_break::other, line_break::close_punctuation, line_break::close_punctuation, 1 },
+        { grapheme_break::extended_pictographic, line_break::alphabetic, line_break::alphabetic, 1 },
+        { grapheme_break::extended_pictographic, line_break::ideographic, line_break::ideographic, 0 },
+        { grapheme_break::extended_pictographic, line_break::e_base, line_break::e_base, 0 },
+        { grapheme_break::extended_pictographic, line_break::e_base, line_break::e_base, 1 },
+        { grapheme_break::extended_pictographic, line_break::ambiguous, line_break::alphabetic, 1 },
+        { grapheme_break::extended_pictographic, line_break::exclamation, line_break::exclamation, 0 },
+        { grapheme_break::other, line_break::ideographic, line_break::ideographic, 1 },
+        { grapheme_break::other, line_break::break_after, line_break::break_after, 1 },
+        { grapheme_break::other, line_break::nonstarter, line_break::nonstarter, 1 },
+        { grapheme_break::extend, line_break::combining_mark, line_break::combining_mark, 1 },
+        { grapheme_break::other, line_break::combining_mark, line_break::combining_mark, 1 },
+        { grapheme_break::other, line_break::ideographic, line_break::ideographic, 0 },
+        { grapheme_break::other, line_break::conditional_japanese_starter, line_break::nonstarter, 1 },
+        { grapheme_break::lv, line_break::h2, line_break::h2, 1 },
+        { grapheme_break::lvt, line_break::h3, line_break::h3, 1 },
+        { grapheme_break::other, line_break::surrogate, line_break::alphabetic, 0 },
+        { grapheme_break::other, line_break::unknown, line_break::alphabetic, 0 },
+        { grapheme_break::other, line_break::infix_numeric, line_break::infix_numeric, 1 },
+        { grapheme_break::other, line_break::exclamation, line_break::exclamation, 1 },
+        { grapheme_break::other, line_break::inseparable, line_break::inseparable, 1 },
+        { grapheme_break::other, line_break::postfix_numeric, line_break::postfix_numeric, 1 },
+        { grapheme_break::extend, line_break::nonstarter, line_break::nonstarter, 1 },
+        { grapheme_break::other, line_break::alphabetic, line_break::alphabetic, 1 },
+        { grapheme_break::other, line_break::contingent_break, line_break::contingent_break, 0 },
+        { grapheme_break::control, line_break::open_punctuation, line_break::open_punctuation, 0 },
+        { grapheme_break::control, line_break::close_punctuation, line_break::close_punctuation, 0 },
+        { grapheme_break::extend, line_break::glue, line_break::glue, 1 },
+        { grapheme_break::spacing_mark, line_break::combining_mark, line_break::combining_mark, 1 },
+        { grapheme_break::extended_pictographic, line_break::ideographic, line_break::ideographic, 3 },
+        { grapheme_break::regional_indicator, line_break::regional_indicator, line_break::regional_indicator, 0 },
+        { grapheme_break::extend, line_break::e_modifier, line_break::e_modifier, 1 },
+    };
+
+    inline constexpr u8 property_stage1[4352]
+    {
+        0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,29,30,31,
+        32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,53,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        54,52,52,52,55,21,56,57,58,59,60,61,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,62,63,63,63,63,63,63,63,63,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,52,65,66,21,67,68,69,
+        70,71,72,73,74,75,21,76,77,78,79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,99,100,
+        21,21,21,101,102,103,96,96,96,96,96,96,96,96,96,104,21,21,21,21,105,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,21,21,106,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,21,21,107,108,96,96,109,110,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,111,52,52,52,52,112,113,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,114,52,115,116,96,96,96,96,96,96,96,96,96,117,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,118,119,120,121,122,123,124,125,126,40,40,127,96,96,96,96,128,
+        129,130,131,96,96,96,96,132,133,134,96,96,135,136,137,96,138,139,140,141,142,143,144,145,146,147,148,149,96,96,96,96,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,150,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,151,152,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,153,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,
+        52,52,52,52,52,52,52,52,52,52,52,154,96,96,96,96,96,96,96,96,96,96,96,96,52,52,155,96,96,96,96,96,
+        52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,52,156,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        157,158,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,96,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,159,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,
+        64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,64,159,
+    };
+
+    inline constexpr u8 property_stage2[40960]
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1,2,2,2,3,2,2,2,4,5,2,6,2,7,2,2,8,8,8,8,8,8,8,8,8,8,2,2,6,6,6,2,
+        2,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,9,4,2,5,10,11,
+        10,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,12,4,6,5,6,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        13,14,3,3,15,3,16,14,17,18,19,20,6,21,22,10,22,23,24,24,17,25,14,14,17,24,19,26,24,24,24,14,
+        27,27,27,27,27,27,28,27,27,27,27,27,27,27,27,27,28,27,27,27,27,27,27,23,28,27,27,27,27,27,28,29,
+        29,29,25,25,25,25,29,25,29,29,29,25,29,29,25,25,29,25,29,29,25,25,25,23,29,29,29,25,29,25,29,25,
+        27,29,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,29,27,29,27,25,27,25,27,25,27,29,27,25,27,25,
+        27,25,27,25,27,25,28,29,27,25,27,29,27,25,27,25,27,29,28,29,27,25,27,25,29,27,25,27,25,27,25,28,
+        29,28,29,27,29,27,25,27,29,29,28,29,27,29,27,25,27,25,28,29,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,28,29,27,25,27,29,27,25,27,25,27,25,27,25,27,25,27,25,27,27,25,27,25,27,25,25,
+        25,27,27,25,27,25,27,27,25,27,27,27,25,25,27,27,27,27,25,27,27,25,27,27,27,25,25,25,27,27,25,27,
+        27,25,27,25,27,25,27,27,25,27,25,25,27,25,27,27,25,27,27,27,25,27,25,27,27,25,25,30,27,25,25,25,
+        30,30,30,30,27,31,25,27,31,25,27,31,25,27,29,27,29,27,29,27,29,27,29,27,29,27,29,27,29,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,25,27,31,25,27,25,27,27,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,25,25,25,25,25,25,27,27,25,27,27,25,
+        25,27,25,27,27,27,27,25,27,25,27,25,27,25,27,25,25,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,30,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,33,33,17,33,32,34,32,34,34,34,32,34,32,32,34,32,33,33,33,33,33,33,17,17,17,17,33,17,33,17,
+        32,32,32,32,32,33,33,33,33,33,33,33,32,33,32,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,27,25,27,25,32,33,27,25,36,36,32,25,25,25,37,27,
+        36,36,36,36,33,33,27,37,27,27,27,36,27,36,27,27,25,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+        28,28,36,28,28,28,28,28,28,28,27,27,25,25,25,25,25,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+        29,29,25,29,29,29,29,29,29,29,25,25,25,25,25,27,25,25,27,27,27,25,25,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,25,25,25,25,27,25,38,27,25,27,27,25,25,27,27,27,
+        27,28,27,27,27,27,27,27,27,27,27,27,27,27,27,27,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,
+        28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,28,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+        29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,25,29,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,18,39,39,39,39,39,40,40,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,27,25,27,25,27,25,27,25,27,25,27,25,27,25,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,36,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,36,36,32,37,37,37,37,37,37,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,37,41,36,36,18,18,42,36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,41,39,
+        37,39,39,37,39,39,37,39,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,30,30,30,30,37,37,36,36,36,36,36,36,36,36,36,36,36,
+        43,43,43,43,43,43,38,38,38,37,37,42,37,37,18,18,39,39,39,39,39,39,39,39,39,39,39,37,43,37,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        32,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        44,44,44,44,44,44,44,44,44,44,37,37,37,37,30,30,39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,37,30,39,39,39,39,39,39,39,43,18,39,
+        39,39,39,39,39,32,32,39,39,18,39,39,39,39,30,30,44,44,44,44,44,44,44,44,44,44,30,30,30,18,18,30,
+        37,37,37,37,37,37,37,37,37,37,37,37,37,37,36,43,30,39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        44,44,44,44,44,44,44,44,44,44,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,32,32,18,37,37,37,32,36,36,39,42,42,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,32,39,39,39,39,39,
+        39,39,39,39,32,39,39,39,32,39,39,39,39,39,36,36,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,36,36,37,36,
+        30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,33,30,30,30,30,30,30,36,43,43,36,36,36,36,36,36,39,39,39,39,39,39,39,39,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,32,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,43,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,45,39,30,45,45,
+        45,39,39,39,39,39,39,39,39,45,45,45,45,39,45,45,30,39,39,39,39,39,39,39,30,30,30,30,30,30,30,30,
+        30,30,39,39,37,37,44,44,44,44,44,44,44,44,44,44,37,32,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,39,45,45,36,30,30,30,30,30,30,30,30,36,36,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,36,36,36,30,30,30,30,36,36,39,30,45,45,
+        45,39,39,39,39,36,36,45,45,36,36,45,45,39,30,36,36,36,36,36,36,36,36,45,36,36,36,36,30,30,36,30,
+        30,30,39,39,36,36,44,44,44,44,44,44,44,44,44,44,30,30,42,42,46,46,46,46,46,46,18,42,30,37,39,36,
+        36,39,39,45,36,30,30,30,30,30,30,36,36,36,36,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,36,30,30,36,30,30,36,36,39,36,45,45,
+        45,39,39,36,36,36,36,39,39,36,36,39,39,39,36,36,36,39,36,36,36,36,36,36,36,30,30,30,30,36,30,36,
+        36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,39,39,30,30,30,39,37,36,36,36,36,36,36,36,36,36,
+        36,39,39,45,36,30,30,30,30,30,30,30,30,30,36,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,36,30,30,30,30,30,36,36,39,30,45,45,
+        45,39,39,39,39,39,36,39,39,45,36,45,45,39,36,36,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,39,39,36,36,44,44,44,44,44,44,44,44,44,44,37,42,36,36,36,36,36,36,36,30,39,39,39,39,39,39,
+        36,39,45,45,36,30,30,30,30,30,30,30,30,36,36,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,36,30,30,30,30,30,36,36,39,30,45,39,
+        45,39,39,39,39,36,36,45,45,36,36,45,45,39,36,36,36,36,36,36,36,39,39,45,36,36,36,36,30,30,36,30,
+        30,30,39,39,36,36,44,44,44,44,44,44,44,44,44,44,18,30,46,46,46,46,46,46,36,36,36,36,36,36,36,36,
+        36,36,39,30,36,30,30,30,30,30,30,36,36,36,30,30,30,36,30,30,30,30,36,36,36,30,30,36,30,36,30,30,
+        36,36,36,30,30,36,36,36,30,30,30,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,45,45,
+        39,45,45,36,36,36,45,45,45,36,45,45,45,39,36,36,30,36,36,36,36,36,36,45,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,46,46,46,18,18,18,18,18,18,42,18,36,36,36,36,36,
+        39,45,45,45,39,30,30,30,30,30,30,30,30,36,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,39,30,39,39,
+        39,45,45,45,45,36,39,39,39,36,39,39,39,39,36,36,36,36,36,36,36,39,39,36,30,30,30,36,36,30,36,36,
+        30,30,39,39,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,36,37,46,46,46,46,46,46,46,18,
+        30,39,45,45,37,30,30,30,30,30,30,30,30,36,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,36,36,39,30,45,39,
+        45,45,45,45,45,36,39,45,45,36,45,45,39,39,36,36,36,36,36,36,36,45,45,36,36,36,36,36,36,30,30,36,
+        30,30,39,39,36,36,44,44,44,44,44,44,44,44,44,44,36,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        39,39,45,45,30,30,30,30,30,30,30,30,30,36,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,30,45,45,
+        45,39,39,39,39,36,45,45,45,36,45,45,45,39,30,18,36,36,36,36,30,30,30,45,46,46,46,46,46,46,46,30,
+        30,30,39,39,36,36,44,44,44,44,44,44,44,44,44,44,46,46,46,46,46,46,46,46,46,18,30,30,30,30,30,30,
+        36,39,45,45,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,36,30,36,36,
+        30,30,30,30,30,30,30,36,36,36,39,36,36,36,36,45,45,45,39,39,39,36,39,36,45,45,45,45,45,45,45,45,
+        36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,45,45,37,36,36,36,36,36,36,36,36,36,36,36,
+        36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,30,30,39,39,39,39,39,39,39,36,36,36,36,42,
+        30,30,30,30,30,30,32,39,39,39,39,39,39,39,39,37,44,44,44,44,44,44,44,44,44,44,37,37,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,30,30,36,30,36,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,36,30,36,30,30,30,30,30,30,30,30,30,30,39,30,30,39,39,39,39,39,39,39,39,39,30,36,36,
+        30,30,30,30,30,36,32,36,39,39,39,39,39,39,36,36,44,44,44,44,44,44,44,44,44,44,36,36,30,30,30,30,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,18,18,18,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,18,37,18,18,18,39,39,18,18,18,18,18,18,
+        44,44,44,44,44,44,44,44,44,44,46,46,46,46,46,46,46,46,46,46,18,39,18,39,18,39,47,48,47,48,45,45,
+        30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,45,
+        39,39,39,39,39,37,39,39,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,36,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,36,18,18,
+        18,18,18,18,18,18,39,18,18,18,18,18,18,36,18,18,37,37,37,37,37,18,18,18,18,37,37,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,45,45,39,39,39,39,45,39,39,39,39,39,39,45,39,39,45,45,39,39,30,
+        44,44,44,44,44,44,44,44,44,44,37,37,37,37,37,37,30,30,30,30,30,30,45,45,39,39,30,30,30,30,39,39,
+        39,30,45,45,45,30,30,45,45,45,45,45,45,45,30,30,30,39,39,39,39,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,39,45,45,39,39,45,45,45,45,45,45,39,30,45,44,44,44,44,44,44,44,44,44,44,45,45,45,39,18,18,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,36,27,36,36,36,36,36,27,36,36,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,37,32,25,25,25,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+        50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+        50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+        50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+        50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,50,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,36,36,30,30,30,30,30,30,30,36,30,36,30,30,30,30,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,36,36,30,30,30,30,30,30,30,36,
+        30,36,30,30,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,36,36,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,39,39,39,
+        37,37,37,37,37,37,37,37,37,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,36,36,25,25,25,25,25,25,36,36,
+        41,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,18,37,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        13,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,47,48,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,37,37,37,51,51,51,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,45,36,36,36,36,36,36,36,36,36,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,45,37,37,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,36,39,39,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,45,39,39,39,39,39,39,39,45,45,
+        45,45,45,45,45,45,39,45,45,39,39,39,39,39,39,39,39,39,39,39,37,37,37,32,37,37,37,42,30,39,36,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,46,46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,
+        37,37,37,37,37,37,41,37,37,37,37,39,39,39,43,39,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,32,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,
+        30,30,30,30,30,39,39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,39,30,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,
+        39,39,39,45,45,45,45,39,39,45,45,45,36,36,36,36,45,45,39,45,45,45,45,45,45,39,39,39,36,36,36,36,
+        18,36,36,36,37,37,44,44,44,44,44,44,44,44,44,44,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,46,36,36,36,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,45,45,39,36,36,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,39,45,39,39,39,39,39,39,39,36,
+        39,45,39,45,45,39,39,39,39,39,39,39,39,45,45,45,45,45,45,39,39,39,39,39,39,39,39,39,39,36,36,39,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        37,37,37,37,37,37,37,32,37,37,37,37,37,37,36,36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,40,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        39,39,39,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,45,39,39,39,39,39,45,39,45,45,45,
+        45,45,39,45,45,30,30,30,30,30,30,30,30,36,36,36,44,44,44,44,44,44,44,44,44,44,37,37,37,37,37,37,
+        37,18,18,18,18,18,18,18,18,18,18,39,39,39,39,39,39,39,39,39,18,18,18,18,18,18,18,18,18,37,37,36,
+        39,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,45,39,39,39,39,45,45,39,39,45,39,39,39,30,30,44,44,44,44,44,44,44,44,44,44,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,39,45,39,39,45,45,45,39,45,39,39,39,45,45,36,36,36,36,36,36,36,36,37,37,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,45,45,45,45,45,45,45,45,39,39,39,39,39,39,39,39,45,45,39,39,36,36,36,37,37,37,37,37,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,30,30,30,44,44,44,44,44,44,44,44,44,44,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,32,32,32,32,32,32,37,37,
+        25,25,25,25,25,25,25,25,25,36,36,36,36,36,36,36,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,36,36,27,27,27,
+        37,37,37,37,37,37,37,37,36,36,36,36,36,36,36,36,39,39,39,37,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,45,39,39,39,39,39,39,39,30,30,30,30,39,30,30,30,30,30,30,39,30,30,45,39,39,30,36,36,36,36,36,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,25,25,25,25,25,25,25,25,25,25,25,25,25,32,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,25,25,25,25,25,25,25,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,25,25,25,25,25,25,36,36,27,27,27,27,27,27,36,36,
+        25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,
+        25,25,25,25,25,25,36,36,27,27,27,27,27,27,36,36,25,25,25,25,25,25,25,25,36,27,36,27,36,27,36,27,
+        25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,36,36,
+        25,25,25,25,25,25,25,25,31,31,31,31,31,31,31,31,25,25,25,25,25,25,25,25,31,31,31,31,31,31,31,31,
+        25,25,25,25,25,25,25,25,31,31,31,31,31,31,31,31,25,25,25,25,25,36,25,25,27,27,27,27,31,33,25,33,
+        33,33,25,25,25,36,25,25,27,27,27,27,31,33,33,33,25,25,25,25,36,36,25,25,27,27,27,27,36,33,33,33,
+        25,25,25,25,25,25,25,25,27,27,27,27,27,33,33,33,36,36,25,25,25,36,25,25,27,27,27,27,31,33,33,36,
+        13,13,13,13,13,13,13,13,13,13,13,43,43,43,43,43,52,41,41,52,52,52,14,37,53,54,47,20,53,54,47,20,
+        14,14,14,37,14,14,14,14,55,56,43,43,43,43,43,13,14,37,14,14,37,14,37,37,37,20,26,14,37,37,14,57,
+        57,37,37,37,38,47,48,37,37,37,37,37,37,37,37,37,37,37,38,37,57,37,37,37,37,37,37,37,37,37,37,13,
+        43,43,43,43,43,36,43,43,43,43,43,43,43,43,43,43,46,32,36,36,24,46,46,46,46,46,38,38,38,47,48,34,
+        46,24,24,24,24,46,46,46,46,46,38,38,38,47,48,36,32,32,32,32,32,32,32,32,32,32,32,32,32,36,36,36,
+        42,42,42,42,42,42,42,42,42,58,42,42,15,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,42,
+        42,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,39,39,39,39,39,39,39,39,39,39,39,39,39,40,40,40,
+        40,39,40,40,40,39,39,39,39,39,39,39,39,39,39,39,39,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,27,22,18,22,18,27,18,22,25,27,27,27,25,25,27,27,27,29,18,27,22,18,38,27,27,27,27,27,18,18,
+        18,22,22,18,27,18,28,18,27,18,27,28,27,27,18,25,27,27,27,27,25,30,30,30,30,25,18,18,25,25,27,27,
+        38,38,38,38,38,27,25,25,25,25,18,38,18,18,25,18,46,46,46,24,24,46,46,46,46,46,46,24,24,24,24,46,
+        59,59,59,59,59,59,59,59,59,59,59,59,51,51,51,51,59,59,59,59,59,59,59,59,59,59,51,51,51,51,51,51,
+        51,51,51,27,25,51,51,51,51,24,18,18,36,36,36,36,23,23,23,23,23,22,22,22,22,22,38,38,18,18,18,18,
+        38,18,18,38,18,18,38,18,18,18,18,18,18,18,38,18,18,18,18,18,18,18,18,18,22,22,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,38,38,18,18,23,18,23,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,22,18,18,18,18,18,18,18,18,18,18,18,18,38,38,38,38,38,38,38,38,38,38,38,38,
+        23,38,23,23,38,38,38,23,23,38,38,23,38,38,38,23,38,23,38,38,38,23,38,38,38,38,23,38,38,23,23,23,
+        23,38,38,23,38,23,38,23,23,23,23,23,23,38,23,38,38,38,38,38,23,23,23,23,38,38,38,38,23,23,38,38,
+        38,38,38,38,38,38,38,38,23,38,38,38,23,38,38,38,38,38,23,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        23,23,38,38,23,23,23,23,38,38,23,23,38,38,23,23,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,23,23,38,38,23,23,38,38,38,38,38,38,38,38,38,38,38,38,38,23,38,38,38,23,38,38,38,38,38,38,
+        38,38,38,38,38,23,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,23,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        18,18,18,18,18,18,18,18,47,48,47,48,18,18,18,18,18,18,22,18,18,18,18,18,18,18,60,60,18,18,18,18,
+        38,38,18,18,18,18,18,18,18,61,62,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,38,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,38,38,38,38,
+        38,38,18,18,18,18,18,18,18,60,60,60,60,18,18,18,60,18,18,60,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,46,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,18,18,18,18,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,18,18,18,18,18,18,18,18,18,18,18,18,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,18,18,22,22,22,22,18,18,18,18,18,18,18,18,18,18,
+        22,22,18,22,22,22,22,22,22,22,18,18,18,18,18,18,18,18,22,22,18,18,22,23,18,18,18,18,22,22,18,18,
+        22,23,18,18,18,18,22,22,22,18,18,22,18,18,22,22,22,22,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,22,22,22,22,18,18,18,18,18,18,18,18,18,22,18,18,18,18,18,18,18,18,38,38,38,38,38,63,63,38,
+        18,18,18,18,18,22,22,18,18,22,18,18,18,18,22,22,18,18,18,18,60,60,18,18,18,18,18,18,22,18,22,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        22,18,22,18,18,18,18,18,60,60,60,60,60,60,60,60,60,60,60,60,18,18,18,18,18,18,18,18,18,18,18,18,
+        22,22,18,22,22,22,18,22,22,22,22,18,22,22,18,23,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,18,18,18,18,18,18,18,18,18,18,22,22,
+        18,60,18,18,18,18,18,18,18,18,60,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,60,22,
+        18,18,18,18,60,60,22,22,22,22,22,22,22,22,60,22,22,22,22,22,60,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,18,22,18,18,18,18,22,22,60,22,22,22,22,22,22,22,60,60,22,60,22,22,22,22,60,22,22,60,22,22,
+        18,18,18,18,18,60,18,18,18,18,60,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,22,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,60,18,60,18,18,18,18,60,60,60,18,60,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,47,48,47,48,47,48,47,48,47,48,47,48,47,48,24,24,24,24,24,24,24,24,24,24,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,18,60,60,60,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,
+        38,38,38,38,38,47,48,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,4,5,4,5,4,5,4,5,47,48,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,47,48,4,5,47,48,47,48,47,48,47,48,47,48,47,48,47,48,47,48,47,48,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,47,48,47,48,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,47,48,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,60,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,18,18,38,38,38,38,38,38,18,18,18,60,18,18,18,18,60,22,22,22,22,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        27,25,27,27,27,25,25,27,25,27,25,27,25,27,27,27,27,25,27,25,25,27,25,25,25,25,25,25,32,32,27,27,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,25,18,18,18,18,18,18,27,25,27,25,39,39,39,27,25,36,36,36,36,36,37,37,37,37,46,37,37,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,36,25,36,36,36,36,36,25,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,32,37,36,36,36,36,36,36,36,36,36,36,36,36,36,36,39,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,
+        30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        37,37,20,26,20,26,37,37,37,20,26,37,20,26,37,37,37,37,37,37,37,37,37,41,37,37,41,37,20,26,37,37,
+        20,26,47,48,47,48,47,48,47,48,37,37,37,37,37,32,37,37,37,37,37,37,37,37,37,37,41,41,37,37,37,37,
+        41,37,47,37,37,37,37,37,37,37,37,37,37,37,37,37,18,18,37,37,37,47,48,47,48,47,48,47,48,41,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,36,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,36,36,36,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,60,60,60,60,60,60,60,60,60,60,60,60,36,36,36,36,
+        64,65,65,65,60,66,49,67,61,62,61,62,61,62,61,62,61,62,60,60,61,62,61,62,61,62,61,62,68,61,62,62,
+        60,67,67,67,67,67,67,67,67,67,69,69,69,69,70,70,68,66,66,66,66,66,60,60,67,67,67,66,49,65,60,18,
+        36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,69,69,71,71,66,66,49,
+        68,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,65,66,66,66,49,
+        36,36,36,36,36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,60,60,72,72,72,72,60,60,60,60,60,60,60,60,60,60,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,36,36,36,36,36,36,36,36,36,36,36,36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,36,
+        72,72,72,72,72,72,72,72,72,72,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,24,24,24,24,24,24,24,24,60,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        72,72,72,72,72,72,72,72,72,72,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,72,72,72,72,72,72,72,72,72,72,72,72,72,72,72,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,66,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,32,32,32,32,32,32,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,32,37,37,37,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        44,44,44,44,44,44,44,44,44,44,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,30,39,40,40,40,37,39,39,39,39,39,39,39,39,39,39,37,32,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,32,32,39,39,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,51,51,51,51,51,51,51,51,51,51,39,39,37,37,37,37,37,37,36,36,36,36,36,36,36,36,
+        33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,32,32,32,32,32,32,32,32,32,
+        33,33,27,25,27,25,27,25,27,25,27,25,27,25,27,25,25,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,25,27,25,27,25,32,25,25,25,25,25,25,25,25,27,25,27,25,27,27,25,
+        27,25,27,25,27,25,27,25,32,33,33,27,25,27,25,30,27,25,27,25,25,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,25,27,25,27,25,27,27,27,27,27,25,27,27,27,27,27,25,27,25,27,25,27,25,27,25,27,25,
+        27,25,27,25,27,27,27,27,25,27,25,36,36,36,36,36,27,25,36,25,36,25,27,25,27,25,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,32,32,32,27,25,30,32,32,25,30,30,30,30,30,
+        30,30,39,30,30,30,39,30,30,30,30,39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,45,45,39,39,45,18,18,18,18,39,36,36,36,46,46,46,46,46,46,18,18,42,18,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,37,37,37,37,36,36,36,36,36,36,36,36,
+        45,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,45,45,45,45,45,45,45,45,45,
+        45,45,45,45,39,39,36,36,36,36,36,36,36,36,37,37,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,30,30,30,30,30,30,37,37,37,30,37,30,30,39,
+        44,44,44,44,44,44,44,44,44,44,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,39,39,39,39,39,39,39,39,37,37,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,45,45,36,36,36,36,36,36,36,36,36,36,36,37,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,
+        39,39,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,45,45,39,39,39,39,45,45,39,39,45,45,
+        45,37,37,37,37,37,37,37,37,37,37,37,37,37,36,32,44,44,44,44,44,44,44,44,44,44,36,36,36,36,37,37,
+        30,30,30,30,30,39,32,30,30,30,30,30,30,30,30,30,44,44,44,44,44,44,44,44,44,44,30,30,30,30,30,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,45,45,39,39,45,45,39,39,36,36,36,36,36,36,36,36,36,
+        30,30,30,39,30,30,30,30,30,30,30,30,39,45,36,36,44,44,44,44,44,44,44,44,44,44,36,36,37,37,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,32,30,30,30,30,30,30,18,18,18,30,45,39,45,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,30,39,39,39,30,30,39,39,30,30,30,30,30,39,39,
+        30,39,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,32,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,45,39,39,45,45,37,37,30,32,32,45,39,36,36,36,36,36,36,36,36,36,
+        36,30,30,30,30,30,30,36,36,30,30,30,30,30,30,36,36,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,33,32,32,32,32,
+        25,25,25,25,25,25,25,25,25,32,33,33,36,36,36,36,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,45,45,39,45,45,39,45,45,37,45,39,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,73,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        25,25,25,25,25,25,25,36,36,36,36,36,36,36,36,36,36,36,36,25,25,25,25,25,36,36,36,36,36,30,39,30,
+        30,30,30,30,30,30,30,30,30,38,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,36,30,36,
+        30,30,36,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,33,33,33,33,33,33,33,33,33,33,33,33,33,33,
+        33,33,33,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,48,47,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,42,18,18,18,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,65,65,65,65,65,65,65,61,62,65,36,36,36,36,36,36,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,65,68,68,75,75,61,62,61,62,61,62,61,62,61,62,61,
+        62,61,62,61,62,65,65,61,62,65,65,65,65,75,75,75,65,65,65,36,65,65,65,65,68,61,62,61,62,61,62,65,
+        65,65,63,68,63,63,63,36,65,76,65,65,36,36,36,36,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,43,
+        36,77,77,77,78,77,77,77,79,80,77,81,77,82,77,77,83,83,83,83,83,83,83,83,83,83,77,77,81,81,81,77,
+        77,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,84,79,77,80,85,86,
+        85,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,87,79,81,80,81,79,
+        80,88,89,90,88,88,91,91,91,91,91,91,91,91,91,91,92,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,
+        91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,92,92,
+        91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,91,36,
+        36,36,91,91,91,91,91,91,36,36,91,91,91,91,91,91,36,36,91,91,91,91,91,91,36,36,91,91,91,36,36,36,
+        78,78,81,85,93,78,78,36,94,95,95,95,95,94,94,36,36,36,36,36,36,36,36,36,36,43,43,43,18,22,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,36,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,
+        37,37,37,36,36,36,36,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,18,18,18,18,18,18,18,18,18,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,46,46,46,46,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,46,46,18,18,18,36,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,
+        18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,39,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        39,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        46,46,46,46,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,51,30,30,30,30,30,30,30,30,51,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,36,36,36,36,30,30,30,30,30,30,30,30,37,51,51,51,51,51,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,36,36,36,36,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,37,27,27,27,27,27,27,27,27,27,27,27,36,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,36,27,27,27,27,27,27,27,36,27,27,36,25,25,25,25,25,25,25,25,25,
+        25,25,36,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,36,25,25,25,25,25,25,25,36,25,25,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        32,32,32,32,32,32,36,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,36,32,32,32,32,32,32,32,32,32,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,36,36,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,36,36,36,30,36,36,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,37,46,46,46,46,46,46,46,46,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,18,18,46,46,46,46,46,46,46,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,
+        36,36,36,36,36,36,36,46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,36,36,36,36,36,46,46,46,46,46,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,46,46,46,46,46,46,36,36,36,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,37,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,46,46,30,30,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        30,39,39,39,36,39,39,36,36,36,36,36,39,39,39,39,30,30,30,30,36,30,30,30,36,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,39,39,39,36,36,36,36,39,
+        46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,36,37,37,37,37,37,37,37,37,37,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,46,46,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,46,46,46,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,18,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,39,39,36,36,36,36,46,46,46,46,46,37,37,37,37,37,37,37,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,37,37,37,37,37,37,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,46,46,46,46,46,46,46,46,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,46,46,46,46,46,46,46,46,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,37,37,37,37,36,36,36,
+        36,36,36,36,36,36,36,36,36,46,46,46,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,36,36,36,36,36,36,36,46,46,46,46,46,46,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,39,39,39,39,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,36,39,39,41,36,36,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,46,46,46,
+        46,46,46,46,46,46,46,30,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,46,46,46,46,37,37,37,37,37,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,39,39,39,39,37,37,37,37,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,46,46,46,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,
+        45,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,37,37,37,37,37,37,37,36,36,36,36,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        46,46,46,46,46,46,44,44,44,44,44,44,44,44,44,44,39,30,30,39,39,30,36,36,36,36,36,36,36,36,36,39,
+        39,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,45,45,39,39,37,37,43,37,37,
+        37,37,39,36,36,36,36,36,36,36,36,36,36,43,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        39,39,39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,39,39,39,39,39,45,39,39,39,39,39,39,39,39,36,44,44,44,44,44,44,44,44,44,44,
+        37,37,37,37,30,45,45,30,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,37,37,30,36,36,36,36,36,36,36,36,36,
+        39,39,45,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,39,39,39,39,39,45,
+        45,30,30,30,30,37,37,37,37,39,39,39,39,37,45,39,44,44,44,44,44,44,44,44,44,44,30,37,30,37,37,37,
+        36,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,45,45,39,45,39,39,37,37,37,37,37,37,39,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,36,30,36,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,30,
+        30,30,30,30,30,30,30,30,30,37,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,
+        45,45,45,39,39,39,39,39,39,39,39,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        39,39,45,45,36,30,30,30,30,30,30,30,30,36,36,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,36,30,30,30,30,30,36,39,39,30,45,45,
+        39,45,45,45,45,36,36,45,45,36,36,45,45,45,36,36,30,36,36,36,36,36,36,45,36,36,36,36,36,30,30,30,
+        30,30,45,45,36,36,39,39,39,39,39,39,39,36,36,36,39,39,39,39,39,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,39,39,39,39,
+        45,45,39,39,39,45,39,30,30,30,30,37,37,37,37,37,44,44,44,44,44,44,44,44,44,44,37,37,36,37,39,30,
+        30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,39,39,45,39,45,45,45,45,39,
+        39,45,39,39,30,30,37,30,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,36,36,45,45,45,45,39,39,45,39,
+        39,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,30,30,30,30,39,39,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,39,39,39,39,45,45,39,45,39,
+        39,37,37,37,30,36,36,36,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        37,37,37,37,37,37,37,37,37,37,37,37,37,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,39,45,39,45,45,39,39,39,39,39,39,45,39,30,37,36,36,36,36,36,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,39,39,39,
+        45,45,39,39,39,39,45,39,39,39,39,39,36,36,36,36,44,44,44,44,44,44,44,44,44,44,46,46,37,37,37,18,
+        30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,39,39,39,39,39,45,39,39,37,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        44,44,44,44,44,44,44,44,44,44,46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,36,30,
+        30,30,30,30,30,30,30,36,36,30,36,36,30,30,30,30,30,30,30,30,36,30,30,36,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,45,45,45,36,45,45,36,36,39,39,45,39,30,
+        45,30,45,39,37,37,37,36,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,45,45,39,39,39,39,36,36,39,39,45,45,45,45,
+        39,30,37,30,45,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,39,39,39,39,39,39,39,39,39,39,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,45,30,39,39,39,39,37,
+        37,37,37,37,37,37,37,39,36,36,36,36,36,36,36,36,30,39,39,39,39,39,39,45,45,39,39,39,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,39,39,39,39,39,39,39,45,39,39,37,37,37,30,37,37,
+        37,37,37,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,45,39,39,39,39,39,39,39,36,39,39,39,39,39,39,45,39,
+        30,37,37,37,37,37,36,36,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,46,46,46,46,46,46,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,37,37,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,36,45,39,39,39,39,39,39,39,45,39,39,45,39,39,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,36,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,36,36,36,39,36,39,39,36,39,
+        39,39,39,39,39,39,30,39,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        30,30,30,30,30,30,36,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,45,45,45,45,45,36,39,39,36,45,45,39,45,39,30,36,36,36,36,36,36,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,45,45,37,37,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,18,18,18,18,18,18,18,18,42,42,42,
+        42,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,37,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,36,37,37,37,37,37,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,37,37,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,43,43,43,43,43,43,43,43,43,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,37,37,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,39,39,39,39,39,37,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,39,39,39,37,37,37,37,37,18,18,18,18,
+        32,32,32,32,37,18,36,36,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,46,46,46,46,46,
+        46,46,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,37,37,37,37,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,39,30,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+        45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+        45,45,45,45,45,45,45,45,36,36,36,36,36,36,36,39,39,39,39,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        66,66,65,66,69,36,36,36,36,36,36,36,36,36,36,36,70,70,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,66,66,66,66,36,66,66,66,66,66,66,66,36,66,66,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,49,49,49,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,49,49,49,49,36,36,36,36,36,36,36,36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,
+        30,30,30,30,30,30,30,30,30,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,36,36,18,39,39,37,
+        43,43,43,43,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,36,36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,36,36,36,36,36,36,36,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,45,45,39,39,39,18,18,18,45,45,45,45,45,45,43,43,43,43,43,43,43,43,39,39,39,39,39,
+        39,39,39,18,18,39,39,39,39,39,39,39,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,39,39,39,39,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,39,39,39,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,36,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,36,27,27,
+        36,36,27,36,36,27,27,36,36,27,27,27,27,36,27,27,27,27,27,27,27,27,25,25,25,25,36,25,36,25,25,25,
+        25,25,25,25,36,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,27,27,36,27,27,27,27,36,36,27,27,27,27,27,27,27,27,36,27,27,27,27,27,27,27,36,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,36,27,27,27,27,36,
+        27,27,27,27,27,36,27,36,36,36,27,27,27,27,27,27,27,36,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,36,36,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,38,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,38,25,25,25,25,
+        25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,38,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,38,25,25,25,25,25,25,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,38,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,38,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,38,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,25,25,25,25,25,38,25,25,25,25,25,25,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,38,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,38,25,25,25,25,25,25,27,25,36,36,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+        44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,44,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,18,18,18,18,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,
+        39,39,39,39,39,39,39,39,39,39,39,39,39,18,18,18,18,18,18,18,18,39,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,39,18,18,37,37,37,37,37,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,39,39,39,39,39,
+        36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        25,25,25,25,25,25,25,25,25,25,30,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        39,39,39,39,39,39,39,36,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,39,36,36,39,39,39,39,39,
+        39,39,36,39,39,36,39,39,39,39,39,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,39,39,39,39,39,39,39,32,32,32,32,32,32,32,36,36,
+        44,44,44,44,44,44,44,44,44,44,36,36,36,36,30,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,39,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,39,39,39,39,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,42,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,30,30,30,36,30,30,30,30,36,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,36,36,46,46,46,46,46,46,46,46,46,39,39,39,39,39,39,39,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,25,
+        25,25,25,25,39,39,39,39,39,39,39,32,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,37,37,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        46,46,46,46,46,46,46,46,46,46,46,46,18,46,46,46,42,46,46,46,46,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,
+        46,46,46,46,46,46,46,46,46,46,46,46,46,46,18,46,46,46,46,46,46,46,46,46,46,46,46,46,46,46,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        36,30,30,36,30,36,36,30,36,30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,36,30,36,30,36,36,36,36,
+        36,36,30,36,36,36,36,30,36,30,36,30,36,30,30,30,36,30,30,36,30,36,36,30,36,30,36,30,36,30,36,30,
+        36,30,30,36,30,36,36,30,30,30,30,36,30,30,30,30,30,30,30,36,30,30,30,30,36,30,30,30,30,36,30,36,
+        30,30,30,30,30,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,
+        36,30,30,30,36,30,30,30,30,30,36,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,38,38,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,
+        24,24,24,24,24,24,24,24,24,24,24,46,46,18,18,18,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,18,18,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,18,18,18,18,18,18,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,60,22,22,60,60,60,60,60,60,60,60,60,60,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        60,60,60,36,36,36,36,36,36,36,36,36,36,36,36,36,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,36,36,36,36,
+        60,60,60,60,60,60,60,60,60,36,36,36,36,36,36,36,60,60,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,18,18,18,18,18,18,18,18,18,18,18,18,60,60,60,60,60,60,60,60,60,18,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,18,18,18,18,18,18,18,18,18,18,18,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,18,18,18,18,60,60,60,60,60,18,18,18,18,18,18,18,18,18,18,18,18,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,18,18,60,18,18,18,60,60,60,71,71,71,71,71,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,
+        60,18,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,18,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,60,60,60,60,18,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,60,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,18,18,18,18,18,18,60,18,18,18,60,60,60,18,18,60,60,60,36,36,36,36,36,60,60,60,
+        18,18,18,18,18,18,18,18,18,18,18,60,60,36,36,36,18,18,18,18,60,60,60,60,60,60,60,60,60,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,
+        60,60,60,60,60,60,60,60,60,60,60,60,36,36,36,36,60,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,18,60,60,60,60,
+        60,60,60,60,60,60,18,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,36,60,60,60,60,60,36,36,36,60,60,60,60,60,36,36,36,
+        60,60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,36,36,36,60,60,60,60,60,60,60,60,60,60,60,36,36,36,36,36,
+        60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,36,60,60,60,60,60,60,60,60,60,60,36,36,36,36,36,36,
+        60,60,60,60,60,60,60,60,36,36,36,36,36,36,36,36,60,60,60,60,60,60,60,36,36,36,36,36,36,36,36,36,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,36,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,
+        18,18,18,18,18,18,18,18,18,18,18,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,44,44,44,44,44,44,44,44,44,44,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,36,36,36,36,36,36,36,36,36,36,36,36,36,36,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,
+        49,49,49,49,49,49,49,49,49,49,49,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,43,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,
+        43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,
+        43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,43,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,
+        35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,35,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,
+        74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,74,36,36,
+    };
+
+    inline constexpr u8 case_stage1[2048]
+    {
+        0,1,2,3,4,5,6,7,8,9,10,0,0,11,12,13,14,15,16,17,18,19,20,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,21,22,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,26,27,0,28,28,29,28,30,31,32,33,
+        0,0,0,0,34,35,36,0,0,0,0,0,0,0,0,0,0,0,37,38,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,40,28,41,42,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,44,0,45,46,47,48,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,52,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,54,55,56,0,57,58,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,60,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,61,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,64,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    };
+
+    inline constexpr u8 case_stage2[4224]
+    {
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+        0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,1,1,1,1,1,1,1,0,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,2,2,2,2,2,2,2,4,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,7,8,5,6,5,6,5,6,0,5,6,5,6,5,6,5,
+        6,5,6,5,6,5,6,5,6,0,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,9,5,6,5,6,5,6,10,
+        11,12,5,6,5,6,13,5,6,14,14,5,6,0,15,16,17,5,6,14,18,19,20,21,5,6,22,0,20,23,24,25,
+        5,6,5,6,5,6,26,5,6,26,0,0,5,6,26,5,6,27,27,5,6,5,6,28,5,6,0,0,5,6,0,29,
+        0,0,0,0,30,31,32,30,31,32,30,31,32,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,33,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,30,31,32,5,6,34,35,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        36,0,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,0,0,0,0,0,37,5,6,38,39,40,
+        40,5,6,41,42,43,5,6,5,6,5,6,5,6,5,6,44,45,46,47,48,0,49,49,0,50,0,51,52,0,0,0,
+        49,53,0,54,0,55,56,0,57,58,56,59,60,0,0,58,0,61,62,0,0,63,0,0,0,0,0,0,0,64,0,0,
+        65,0,66,65,0,0,0,67,65,68,69,69,70,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,72,73,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,6,5,6,0,0,5,6,0,0,0,24,24,24,0,75,
+        0,0,0,0,0,0,76,0,77,77,77,0,78,0,79,79,0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,0,1,1,1,1,1,1,1,1,1,80,81,81,81,0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+        2,2,82,2,2,2,2,2,2,2,2,2,83,84,84,85,86,87,0,0,0,88,89,90,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,91,92,93,94,95,96,0,5,6,97,5,6,0,36,36,36,
+        98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,98,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,99,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,0,0,0,0,0,0,0,0,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        100,5,6,5,6,5,6,5,6,5,6,5,6,5,6,101,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+        102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,0,0,0,0,0,0,0,0,0,
+        0,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+        103,103,103,103,103,103,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,104,
+        104,104,104,104,104,104,0,104,0,0,0,0,0,104,0,0,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,
+        105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,105,0,0,105,105,105,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,
+        106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,
+        106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,106,107,107,107,107,107,107,0,0,108,108,108,108,108,108,0,0,
+        109,110,111,112,112,113,114,115,116,0,0,0,0,0,0,0,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,
+        117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,117,0,0,117,117,117,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,0,0,0,119,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,0,0,0,0,121,0,0,122,0,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,123,123,123,123,123,123,0,0,124,124,124,124,124,124,0,0,
+        123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+        123,123,123,123,123,123,0,0,124,124,124,124,124,124,0,0,0,123,0,123,0,123,0,123,0,124,0,124,0,124,0,124,
+        123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,125,125,126,126,126,126,127,127,128,128,129,129,130,130,0,0,
+        123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,
+        123,123,123,123,123,123,123,123,124,124,124,124,124,124,124,124,123,123,0,131,0,0,0,0,124,124,132,132,133,0,134,0,
+        0,0,0,131,0,0,0,0,135,135,135,135,133,0,0,0,123,123,0,0,0,0,0,0,124,124,136,136,0,0,0,0,
+        123,123,0,0,0,93,0,0,124,124,137,137,97,0,0,0,0,0,0,131,0,0,0,0,138,138,139,139,133,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,140,0,0,0,141,142,0,0,0,0,0,0,143,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,145,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,146,
+        0,0,0,5,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,147,147,147,147,147,147,147,147,147,
+        147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,147,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,148,
+        148,148,148,148,148,148,148,148,148,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,
+        102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,102,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+        103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,103,
+        5,6,149,150,151,152,153,5,6,5,6,5,6,154,155,156,157,0,5,6,0,5,6,0,0,0,0,0,0,0,158,158,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,0,0,0,0,0,0,0,5,6,5,6,0,0,0,5,6,0,0,0,0,0,0,0,0,0,0,0,0,
+        159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,159,
+        159,159,159,159,159,159,0,159,0,0,0,0,0,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,0,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,5,6,5,6,5,6,0,0,0,0,0,0,0,0,0,5,6,5,6,160,5,6,
+        5,6,5,6,5,6,5,6,0,0,0,5,6,161,0,0,5,6,5,6,162,0,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,5,6,5,6,5,6,163,164,165,166,163,0,167,168,169,170,5,6,5,6,5,6,5,6,5,6,5,6,
+        5,6,5,6,171,172,173,5,6,5,6,0,0,0,0,0,5,6,0,0,0,0,5,6,5,6,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,6,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,174,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+        175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+        175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,175,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+        0,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+        176,176,176,176,176,176,176,176,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,
+        177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,
+        176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,176,0,0,0,0,177,177,177,177,177,177,177,177,
+        177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,177,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,178,178,178,178,178,178,178,178,178,178,0,178,178,178,178,
+        178,178,178,178,178,178,178,178,178,178,178,0,178,178,178,178,178,178,178,0,178,178,0,179,179,179,179,179,179,179,179,179,
+        179,179,0,179,179,179,179,179,179,179,179,179,179,179,179,179,179,179,0,179,179,179,179,179,179,179,0,179,179,0,0,0,
+        78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,
+        78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,78,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+        83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,
+        180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,180,
+        180,180,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,181,
+        181,181,181,181,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    };
+
+    inline constexpr u8 break_stage1[8704]
+    {
+        0,1,2,2,2,3,4,5,2,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,26,27,28,
+        29,30,31,32,33,34,35,36,37,2,2,2,2,38,39,40,41,42,43,44,45,46,47,48,49,50,2,51,2,2,52,53,
+        54,55,56,57,58,59,60,61,62,63,64,65,66,67,68,69,2,2,70,71,2,2,72,73,2,74,75,76,77,78,79,80,
+        81,82,83,84,85,86,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,87,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        88,79,79,79,79,79,79,79,79,89,2,2,90,91,2,92,93,94,95,96,97,98,99,100,101,102,103,104,105,106,107,101,
+        102,103,104,105,106,107,101,102,103,104,105,106,107,101,102,103,104,105,106,107,101,102,103,104,105,106,107,101,102,103,104,105,
+        106,107,101,102,103,104,105,106,107,101,102,103,104,105,106,107,101,102,103,104,105,106,107,101,102,103,104,105,106,107,101,102,
+        103,104,105,106,107,101,102,103,104,105,106,107,101,102,103,108,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,109,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,79,79,79,79,111,112,2,2,113,114,115,116,117,118,
+        119,120,121,122,123,124,125,126,2,127,128,129,2,2,130,131,132,133,134,135,136,137,138,139,140,141,142,123,143,144,145,146,
+        147,148,149,150,151,152,153,123,154,155,123,156,157,158,159,123,160,161,162,163,164,165,123,123,166,167,168,169,123,170,123,171,
+        2,2,2,2,2,2,2,172,173,2,174,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,175,
+        2,2,2,2,176,177,178,2,179,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,2,2,2,180,181,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,2,2,2,2,182,183,184,185,123,123,123,123,186,187,188,189,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,190,79,79,79,79,79,79,191,191,191,192,193,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,194,
+        79,79,195,79,79,196,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,197,198,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,199,174,
+        2,200,201,202,203,204,205,123,206,207,208,2,2,209,2,210,2,2,2,2,211,212,123,123,123,123,123,123,123,123,213,123,
+        214,123,215,123,123,216,123,123,123,123,123,123,123,123,123,217,2,218,219,123,123,123,123,123,220,221,222,123,223,224,123,123,
+        225,226,227,228,229,230,231,232,233,234,235,236,237,238,239,240,241,242,243,244,245,246,2,247,230,230,230,230,230,230,230,248,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,249,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,
+        79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,79,249,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        250,251,252,253,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,251,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,123,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,254,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,
+        110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,110,254,
+    };
+
+    inline constexpr u8 break_stage2[32640]
+    {
+        0,0,0,0,0,0,0,0,0,1,2,3,3,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        5,6,7,8,9,10,8,7,11,12,8,9,13,14,13,15,16,16,16,16,16,16,16,16,16,16,13,13,8,8,8,6,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,9,12,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,17,18,8,0,
+        0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+        20,11,10,9,9,9,8,21,21,22,21,7,8,1,22,8,10,9,21,21,23,8,21,21,21,21,21,7,21,21,21,11,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,21,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,21,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,21,23,21,21,21,23,21,8,8,21,8,8,8,8,8,8,8,21,21,21,21,8,21,8,23,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,25,24,24,24,24,24,24,24,24,24,24,24,24,25,25,25,25,
+        25,25,25,24,24,24,24,24,24,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,26,26,8,8,8,8,13,8,
+        26,26,26,26,8,8,8,8,8,8,8,26,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,13,17,26,26,8,8,9,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,17,24,
+        8,24,24,8,24,24,6,24,26,26,26,26,26,26,26,26,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,27,
+        27,27,27,27,27,27,27,27,27,27,27,26,26,26,26,27,27,27,27,8,8,26,26,26,26,26,26,26,26,26,26,26,
+        28,28,28,28,28,28,8,8,8,10,10,10,13,13,8,8,24,24,24,24,24,24,24,24,24,24,24,6,0,6,6,6,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        16,16,16,16,16,16,16,16,16,16,10,16,16,8,8,8,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,6,8,24,24,24,24,24,24,24,28,8,24,
+        24,24,24,24,24,8,8,24,24,8,24,24,24,24,8,8,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,28,8,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,8,8,8,8,13,6,8,26,26,24,9,9,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,8,24,24,24,24,24,
+        24,24,24,24,8,24,24,24,8,24,24,24,24,24,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,26,26,8,26,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,28,28,26,26,26,26,26,26,24,24,24,24,24,24,24,24,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,28,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,29,24,8,29,29,
+        29,24,24,24,24,24,24,24,24,29,29,29,29,24,29,29,8,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,
+        8,8,24,24,17,17,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,24,29,29,26,8,8,8,8,8,8,8,8,26,26,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,26,26,26,8,8,8,8,26,26,24,8,24,29,
+        29,24,24,24,24,26,26,29,29,26,26,29,29,24,8,26,26,26,26,26,26,26,26,24,26,26,26,26,8,8,26,8,
+        8,8,24,24,26,26,16,16,16,16,16,16,16,16,16,16,8,8,10,10,8,8,8,8,8,10,8,9,8,8,24,26,
+        26,24,24,29,26,8,8,8,8,8,8,26,26,26,26,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,26,8,8,26,8,8,26,26,24,26,29,29,
+        29,24,24,26,26,26,26,24,24,26,26,24,24,24,26,26,26,24,26,26,26,26,26,26,26,8,8,8,8,26,8,26,
+        26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,24,24,8,8,8,24,8,26,26,26,26,26,26,26,26,26,
+        26,24,24,29,26,8,8,8,8,8,8,8,8,8,26,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,26,26,24,8,29,29,
+        29,24,24,24,24,24,26,24,24,29,26,29,29,24,26,26,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,24,24,26,26,16,16,16,16,16,16,16,16,16,16,8,9,26,26,26,26,26,26,26,8,24,24,24,24,24,24,
+        26,24,29,29,26,8,8,8,8,8,8,8,8,26,26,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,26,26,24,8,24,24,
+        29,24,24,24,24,26,26,29,29,26,26,29,29,24,26,26,26,26,26,26,26,24,24,24,26,26,26,26,8,8,26,8,
+        8,8,24,24,26,26,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,
+        26,26,24,8,26,8,8,8,8,8,8,26,26,26,8,8,8,26,8,8,8,8,26,26,26,8,8,26,8,26,8,8,
+        26,26,26,8,8,26,26,26,8,8,8,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,24,29,
+        24,29,29,26,26,26,29,29,29,26,29,29,29,24,26,26,8,26,26,26,26,26,26,24,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,9,8,26,26,26,26,26,
+        24,29,29,29,24,8,8,8,8,8,8,8,8,26,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,24,8,24,24,
+        24,29,29,29,29,26,24,24,24,26,24,24,24,24,26,26,26,26,26,26,26,24,24,26,8,8,8,26,26,8,26,26,
+        8,8,24,24,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,26,23,8,8,8,8,8,8,8,8,
+        8,24,29,29,23,8,8,8,8,8,8,8,8,26,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,26,26,24,8,29,24,
+        29,29,24,29,29,26,24,29,29,26,29,29,24,24,26,26,26,26,26,26,26,24,24,26,26,26,26,26,26,8,8,26,
+        8,8,24,24,26,26,16,16,16,16,16,16,16,16,16,16,26,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        24,24,29,29,8,8,8,8,8,8,8,8,8,26,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,8,24,29,
+        29,24,24,24,24,26,29,29,29,26,29,29,29,24,28,8,26,26,26,26,8,8,8,24,8,8,8,8,8,8,8,8,
+        8,8,24,24,26,26,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,10,8,8,8,8,8,8,
+        26,24,29,29,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,26,8,26,26,
+        8,8,8,8,8,8,8,26,26,26,24,26,26,26,26,24,29,29,24,24,24,26,24,26,29,29,29,29,29,29,29,24,
+        26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,29,29,8,26,26,26,26,26,26,26,26,26,26,26,
+        26,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,31,30,32,31,31,31,31,31,31,31,26,26,26,26,9,
+        30,30,30,30,30,30,30,31,31,31,31,31,31,31,31,8,16,16,16,16,16,16,16,16,16,16,17,17,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,30,30,26,30,26,30,30,30,30,30,26,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,26,30,26,30,30,30,30,30,30,30,30,30,30,31,30,32,31,31,31,31,31,31,31,31,31,30,26,26,
+        30,30,30,30,30,26,30,26,31,31,31,31,31,31,26,26,16,16,16,16,16,16,16,16,16,16,26,26,30,30,30,30,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,23,23,23,23,8,23,23,20,23,23,17,20,6,6,6,6,6,20,8,6,8,8,8,24,24,8,8,8,8,8,8,
+        16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,8,17,24,8,24,8,24,11,18,11,18,29,29,
+        8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,33,
+        24,24,24,24,24,17,24,24,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,26,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,26,17,17,
+        8,8,8,8,8,8,24,8,8,8,8,8,8,26,8,8,23,23,17,23,8,8,8,8,8,20,20,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,34,34,31,31,31,31,35,31,31,31,31,31,31,34,31,31,35,35,31,31,30,
+        16,16,16,16,16,16,16,16,16,16,17,17,8,8,8,8,30,30,30,30,30,30,35,35,31,31,30,30,30,30,31,31,
+        31,30,34,34,34,30,30,34,34,34,34,34,34,34,30,30,30,31,31,31,31,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,31,34,35,31,31,34,34,34,34,34,34,31,30,34,16,16,16,16,16,16,16,16,16,16,34,34,34,31,30,30,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,26,8,26,26,26,26,26,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,
+        37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+        37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+        37,37,37,37,37,37,37,37,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,26,26,8,8,8,8,8,8,8,26,8,26,8,8,8,8,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,26,26,8,8,8,8,8,8,8,26,
+        8,26,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,26,26,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,24,24,24,
+        8,17,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,26,26,
+        17,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        17,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,18,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,17,17,17,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,29,26,26,26,26,26,26,26,26,26,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,29,17,17,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,26,24,24,26,26,26,26,26,26,26,26,26,26,26,26,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,31,31,35,31,31,31,31,31,31,31,35,35,
+        35,35,35,35,35,35,31,35,35,31,31,31,31,31,31,31,31,31,31,31,17,17,39,30,17,8,17,9,30,31,26,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,
+        8,8,6,6,17,17,23,8,6,6,8,24,24,24,40,24,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,
+        8,8,8,8,8,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,24,8,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        24,24,24,29,29,29,29,24,24,29,29,29,26,26,26,26,29,29,24,29,29,29,29,29,29,24,24,24,26,26,26,26,
+        8,26,26,26,6,6,16,16,16,16,16,16,16,16,16,16,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,26,26,30,30,30,30,30,26,26,26,26,26,26,26,26,26,26,26,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,26,26,26,26,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,30,26,26,26,30,30,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,29,29,24,26,26,8,8,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,35,31,35,31,31,31,31,31,31,31,26,
+        31,34,31,34,34,31,31,31,31,31,31,31,31,35,35,35,35,35,35,31,31,31,31,31,31,31,31,31,31,26,26,24,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,26,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        24,24,24,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,29,24,29,29,29,
+        29,29,24,29,29,8,8,8,8,8,8,8,8,26,26,26,16,16,16,16,16,16,16,16,16,16,17,17,8,17,17,17,
+        17,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,8,17,17,26,
+        24,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,29,24,24,24,24,29,29,24,24,29,24,24,24,8,8,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,24,29,24,24,29,29,29,24,29,24,24,24,29,29,26,26,26,26,26,26,26,26,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,29,29,29,29,29,29,29,29,24,24,24,24,24,24,24,24,29,29,24,24,26,26,26,17,17,17,17,17,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,8,8,8,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,17,17,
+        8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,
+        8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,24,24,24,8,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,29,24,24,24,24,24,24,24,8,8,8,8,24,8,8,8,8,8,8,24,8,8,29,24,24,8,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,26,26,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,26,8,26,8,26,8,26,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,26,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,26,8,8,8,8,8,8,8,23,8,26,
+        17,17,17,17,17,17,17,20,17,17,17,41,24,42,0,0,17,20,17,17,43,21,21,8,7,7,11,7,7,7,11,7,
+        21,21,8,8,44,44,44,17,3,3,0,0,0,0,0,20,10,10,10,10,10,10,10,10,8,7,7,21,45,39,8,8,
+        8,8,8,8,13,11,18,39,39,45,8,8,8,8,8,8,8,8,8,8,8,8,17,8,17,17,17,17,8,17,17,17,
+        46,47,47,47,47,48,0,0,0,0,0,0,0,0,0,0,8,8,26,26,21,8,8,8,8,8,8,8,8,11,18,21,
+        8,21,21,21,21,8,8,8,8,8,8,8,8,11,18,26,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,
+        9,9,9,9,9,9,9,10,9,49,9,9,9,9,9,9,9,9,9,9,9,9,10,9,9,9,9,10,9,9,10,9,
+        10,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,10,8,21,8,8,8,10,8,8,8,8,8,8,8,8,8,21,8,8,9,8,8,8,8,8,8,8,8,8,
+        8,21,50,8,8,8,8,8,8,8,8,21,8,8,8,8,8,8,8,8,8,8,8,8,8,22,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,21,21,8,8,8,8,8,21,8,8,21,8,
+        21,21,21,21,21,21,21,21,21,21,21,21,8,8,8,8,21,21,21,21,21,21,21,21,21,21,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,21,8,8,26,26,26,26,21,21,21,21,50,50,50,50,50,50,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,22,22,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,21,8,21,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        21,8,21,21,8,8,8,21,21,8,8,21,8,8,8,21,8,21,9,9,8,21,8,8,8,8,21,8,8,21,21,21,
+        21,8,8,21,8,21,8,21,21,21,21,21,21,8,21,8,8,8,8,8,21,21,21,21,8,8,8,8,21,21,8,8,
+        8,8,8,8,8,8,8,8,21,8,8,8,21,8,8,8,8,8,21,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        21,21,8,8,21,21,21,21,8,8,21,21,8,8,21,21,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,21,21,8,8,21,21,8,8,8,8,8,8,8,8,8,8,8,8,8,21,8,8,8,21,8,8,8,8,8,8,
+        8,8,8,8,8,21,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,21,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,44,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,11,18,11,18,8,8,8,8,8,8,21,8,8,8,8,8,8,8,51,51,8,8,8,8,
+        8,8,8,8,8,8,8,8,22,52,53,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,22,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,22,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,54,54,54,54,22,22,22,51,55,55,51,8,8,8,8,22,22,22,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,50,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,8,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,8,8,8,8,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,8,8,8,8,8,8,8,8,8,8,8,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,8,8,21,21,21,21,8,8,8,8,8,8,8,8,8,8,
+        21,21,8,21,21,21,21,21,21,21,22,22,8,8,8,8,8,8,21,21,8,8,50,21,8,8,8,8,21,21,8,8,
+        50,21,8,8,8,8,21,21,21,8,8,21,8,8,21,21,21,21,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,21,21,21,21,8,8,8,8,8,8,8,8,8,21,8,8,8,8,8,8,8,8,8,8,8,22,22,54,54,8,
+        55,55,55,55,22,50,21,22,22,50,22,22,22,22,50,50,22,22,22,8,51,51,50,50,55,22,55,55,55,56,55,55,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,55,55,55,22,22,22,22,
+        50,22,50,22,22,22,22,22,54,54,54,54,54,54,54,54,54,54,54,54,22,22,22,22,22,22,22,22,22,22,22,22,
+        50,50,22,50,50,50,22,50,55,50,50,22,50,50,22,50,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,51,
+        22,22,22,22,22,22,8,8,8,8,8,8,8,8,8,8,22,22,22,54,22,22,22,22,22,22,22,22,22,22,50,50,
+        22,54,22,22,22,22,22,22,22,22,54,54,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,51,51,55,
+        55,55,55,55,51,51,55,55,55,50,50,50,50,55,54,55,55,55,50,55,51,50,50,50,55,55,50,50,55,50,50,55,
+        55,55,22,50,22,22,22,22,50,50,51,50,50,50,50,50,50,55,51,51,55,51,50,55,55,56,51,50,50,51,55,55,
+        55,55,55,55,55,54,8,8,55,55,57,57,56,56,22,22,22,22,22,8,22,8,22,8,8,8,8,8,8,22,8,8,
+        8,22,8,8,8,8,8,8,54,8,8,8,8,8,8,8,8,8,8,22,22,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,22,8,8,22,8,8,8,8,54,8,54,8,8,8,8,54,54,54,8,58,8,8,8,7,7,7,7,7,
+        7,8,6,59,55,22,22,22,11,18,11,18,11,18,11,18,11,18,11,18,11,18,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,8,54,54,54,8,8,8,8,8,8,8,8,
+        8,22,8,8,8,8,8,8,8,8,8,8,8,8,8,8,54,8,8,8,8,8,8,8,8,8,8,8,8,8,8,54,
+        8,8,8,8,8,11,18,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,11,18,11,18,11,18,11,18,11,18,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,22,22,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,11,18,11,18,11,18,11,18,11,18,11,18,11,18,11,18,11,18,11,18,11,18,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,18,11,18,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,18,8,8,
+        8,8,8,8,8,22,22,22,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,54,54,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,54,8,8,8,8,58,21,21,21,21,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,8,8,26,26,26,26,26,6,17,17,17,8,6,17,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,26,8,26,26,26,26,26,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,8,17,26,26,26,26,26,26,26,26,26,26,26,26,26,26,24,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,
+        8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,17,17,17,17,17,17,17,17,8,17,11,17,8,8,7,7,8,8,
+        7,7,11,18,11,18,11,18,11,18,17,17,17,17,6,8,17,17,8,17,17,8,8,8,8,8,43,43,17,17,17,8,
+        17,17,11,17,17,17,17,17,17,17,17,8,17,8,17,17,8,8,8,6,6,11,18,11,18,11,18,11,18,17,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,26,26,26,26,26,26,26,26,26,26,26,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,60,60,60,60,60,60,60,60,60,60,60,60,26,26,26,26,
+        61,53,53,60,60,62,60,60,52,53,52,53,52,53,52,53,52,53,60,60,52,53,52,53,52,53,52,53,62,52,53,53,
+        60,60,60,60,60,60,60,60,60,60,63,63,63,63,63,63,51,60,60,60,60,64,60,60,60,60,60,62,62,51,60,65,
+        26,66,60,66,60,66,60,66,60,66,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,66,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,66,60,66,60,66,60,60,60,60,60,60,66,60,60,60,60,60,60,66,66,26,26,63,63,62,62,62,62,60,
+        62,66,60,66,60,66,60,66,60,66,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,66,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,66,60,66,60,66,60,60,60,60,60,60,66,60,60,60,60,60,60,66,66,60,60,60,60,62,66,62,62,60,
+        26,26,26,26,26,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,26,26,26,26,26,26,26,26,26,26,26,26,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,66,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,21,21,21,21,21,21,21,21,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,51,60,51,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,62,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,26,26,26,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,17,17,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,17,6,17,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        16,16,16,16,16,16,16,16,16,16,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,8,24,24,24,24,24,24,24,24,24,24,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,8,17,17,17,17,17,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,8,26,8,26,8,8,8,8,8,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,24,8,8,8,24,8,8,8,8,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,29,29,24,24,29,8,8,8,8,24,26,26,26,8,8,8,8,8,8,8,8,10,8,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,23,23,6,6,26,26,26,26,26,26,26,26,
+        29,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,29,29,29,29,29,29,29,29,29,
+        29,29,29,29,24,24,26,26,26,26,26,26,26,26,17,17,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,8,8,23,8,8,24,
+        16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,24,24,24,24,24,24,24,24,17,17,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,29,29,26,26,26,26,26,26,26,26,26,26,26,8,
+        36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,36,26,26,26,
+        24,24,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,29,29,24,24,24,24,29,29,24,24,29,29,
+        29,8,8,8,8,8,8,17,17,17,8,8,8,8,26,8,16,16,16,16,16,16,16,16,16,16,26,26,26,26,8,8,
+        30,30,30,30,30,31,30,30,30,30,30,30,30,30,30,30,16,16,16,16,16,16,16,16,16,16,30,30,30,30,30,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,29,29,24,24,29,29,24,24,26,26,26,26,26,26,26,26,26,
+        8,8,8,24,8,8,8,8,8,8,8,8,24,29,26,26,16,16,16,16,16,16,16,16,16,16,26,26,8,17,17,17,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,34,31,34,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,31,30,31,31,31,30,30,31,31,30,30,30,30,30,31,31,
+        30,31,30,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,30,30,30,30,30,
+        8,8,8,8,8,8,8,8,8,8,8,29,24,24,29,29,17,17,8,8,8,29,24,26,26,26,26,26,26,26,26,26,
+        26,8,8,8,8,8,8,26,26,8,8,8,8,8,8,26,26,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,29,29,24,29,29,24,29,29,17,29,24,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,68,68,68,68,67,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,68,
+        68,68,68,68,26,26,26,26,26,26,26,26,26,26,26,26,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,37,
+        37,37,37,37,37,37,37,26,26,26,26,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,
+        38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,38,26,26,26,26,
+        69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+        69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+        69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+        69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,69,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,26,26,26,26,26,27,24,27,
+        27,27,27,27,27,27,27,27,27,8,27,27,27,27,27,27,27,27,27,27,27,27,27,26,27,27,27,27,27,26,27,26,
+        27,27,26,27,27,26,27,27,27,27,27,27,27,27,27,27,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,18,11,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,10,8,8,8,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,71,53,53,71,71,72,72,52,53,73,26,26,26,26,26,26,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,60,60,60,60,60,52,53,52,53,52,53,52,53,52,53,52,
+        53,52,53,52,53,60,60,52,53,60,60,60,60,60,60,60,53,60,53,26,62,62,72,72,60,52,53,52,53,52,53,60,
+        60,60,60,60,60,60,60,26,60,49,74,60,26,26,26,26,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,46,
+        26,72,60,60,49,74,60,60,52,53,60,60,53,60,53,60,60,60,60,60,60,60,60,60,60,60,62,62,60,60,60,72,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,52,60,53,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,52,60,53,60,52,
+        53,53,52,53,53,62,60,66,66,66,66,66,66,66,66,66,66,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,75,75,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,
+        26,26,60,60,60,60,60,60,26,26,60,60,60,60,60,60,26,26,60,60,60,60,60,60,26,26,60,60,60,26,26,26,
+        74,49,60,60,60,49,49,26,76,76,76,76,76,76,76,26,48,48,48,48,48,48,48,48,48,0,0,0,77,21,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,26,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,
+        17,17,17,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,
+        8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,17,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,26,26,26,26,8,8,8,8,8,8,8,8,17,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,8,8,8,8,
+        8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,26,26,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,26,26,26,8,26,26,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,17,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,26,26,26,26,26,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,17,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,24,24,24,26,24,24,26,26,26,26,26,24,24,24,24,8,8,8,8,26,8,8,8,26,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,24,24,24,26,26,26,26,24,
+        8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,17,17,17,17,17,17,17,17,8,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,24,24,26,26,26,26,8,8,8,8,8,17,17,17,17,17,17,44,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,17,17,17,17,17,17,17,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,8,8,8,8,26,26,26,
+        26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,24,24,24,24,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,26,24,24,17,26,26,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,24,24,24,24,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,24,24,24,24,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,
+        29,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,17,17,8,8,8,8,8,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,16,16,16,16,16,16,16,16,16,16,24,8,8,24,24,8,26,26,26,26,26,26,26,26,26,24,
+        24,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,24,29,29,24,24,8,8,28,17,17,
+        17,17,24,26,26,26,26,26,26,26,26,26,26,28,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        24,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,24,24,24,24,24,29,24,24,24,24,24,24,24,24,26,16,16,16,16,16,16,16,16,16,16,
+        17,17,17,17,8,29,29,8,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,8,23,8,26,26,26,26,26,26,26,26,26,
+        24,24,29,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,24,24,24,24,24,24,29,
+        29,8,28,28,8,17,17,8,17,24,24,24,24,8,29,24,16,16,16,16,16,16,16,16,16,16,8,23,8,17,17,17,
+        26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,29,29,24,29,24,24,17,17,8,17,17,8,24,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,26,8,26,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,
+        8,8,8,8,8,8,8,8,8,17,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,
+        29,29,29,24,24,24,24,24,24,24,24,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        24,24,29,29,26,8,8,8,8,8,8,8,8,26,26,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,26,24,24,8,24,29,
+        24,29,29,29,29,26,26,29,29,26,26,29,29,29,26,26,8,26,26,26,26,26,26,24,26,26,26,26,26,8,8,8,
+        8,8,29,29,26,26,24,24,24,24,24,24,24,26,26,26,24,24,24,24,24,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,24,24,24,24,24,
+        29,29,24,24,24,29,24,8,8,8,8,17,17,17,17,8,16,16,16,16,16,16,16,16,16,16,17,17,26,8,24,8,
+        8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,29,29,24,24,24,24,24,24,29,24,29,29,24,29,24,
+        24,29,24,24,8,8,8,8,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,29,29,24,24,24,24,26,26,29,29,29,29,24,24,29,24,
+        24,23,17,17,6,6,8,8,8,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,8,8,8,8,24,24,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,24,24,24,24,24,29,29,24,29,24,
+        24,17,17,8,8,26,26,26,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        23,23,23,23,23,23,23,23,23,23,23,23,23,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,24,29,24,29,29,24,24,24,24,24,24,29,24,8,8,26,26,26,26,26,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,30,26,26,31,31,31,
+        34,34,31,31,31,31,35,31,31,31,31,31,26,26,26,26,16,16,16,16,16,16,16,16,16,16,30,30,17,17,17,30,
+        30,30,30,30,30,30,30,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,24,24,24,24,24,24,29,24,24,8,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,8,
+        8,8,8,8,8,8,8,26,26,8,26,26,8,8,8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,29,29,29,29,29,26,29,29,26,26,24,24,29,24,28,
+        29,28,29,24,17,17,17,26,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,29,29,24,24,24,24,26,26,24,24,29,29,29,29,
+        24,8,23,8,29,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,24,24,24,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,29,28,24,24,24,24,23,
+        8,17,17,17,17,23,8,24,26,26,26,26,26,26,26,26,8,24,24,24,24,24,24,29,29,24,24,24,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,28,28,28,28,28,28,24,24,24,24,24,24,24,24,24,24,24,24,24,29,24,24,17,17,17,8,23,23,
+        23,17,17,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,29,24,24,24,24,24,24,24,26,24,24,24,24,24,24,29,24,
+        8,17,17,17,17,17,26,26,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,23,6,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,26,29,24,24,24,24,24,24,24,29,24,24,29,24,24,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,26,26,26,24,26,24,24,26,24,
+        24,24,24,24,24,24,28,24,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        8,8,8,8,8,8,26,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,29,29,29,29,29,26,24,24,26,29,29,24,29,24,8,26,26,26,26,26,26,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,29,29,8,8,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,10,10,10,
+        10,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,17,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,17,17,17,17,17,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,11,11,18,18,18,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,18,8,8,8,11,18,11,18,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,18,18,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,40,40,40,40,40,40,40,78,79,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,11,18,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,17,17,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,24,24,24,24,24,17,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,17,17,17,8,8,8,8,8,8,
+        8,8,8,8,17,8,26,26,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,8,8,8,8,8,
+        8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,17,17,8,8,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,24,8,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+        29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,29,
+        29,29,29,29,29,29,29,29,26,26,26,26,26,26,26,24,24,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        62,62,62,62,80,26,26,26,26,26,26,26,26,26,26,26,81,81,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,26,26,26,26,26,26,26,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,
+        76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,76,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        60,60,60,60,60,60,60,60,60,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,76,76,76,76,26,76,76,76,76,76,76,76,26,76,76,26,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,66,66,66,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,66,66,66,66,26,26,26,26,26,26,26,26,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,
+        8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,26,26,8,24,24,17,
+        0,0,0,0,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,26,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,24,29,24,24,24,8,8,8,29,24,24,24,24,24,0,0,0,0,0,0,0,0,24,24,24,24,24,
+        24,24,24,8,8,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,24,24,24,24,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,24,24,24,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,
+        26,26,8,26,26,8,8,26,26,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,26,8,26,8,8,8,
+        8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,26,8,8,8,8,26,26,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,26,
+        8,8,8,8,8,26,8,26,26,26,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,26,26,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+        16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,16,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,8,8,8,8,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,8,8,8,8,8,8,8,8,24,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,24,8,8,17,17,17,17,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,24,24,24,24,24,
+        26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        24,24,24,24,24,24,24,26,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,26,26,24,24,24,24,24,
+        24,24,26,24,24,26,24,24,24,24,24,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,24,24,24,24,24,24,24,8,8,8,8,8,8,8,26,26,
+        16,16,16,16,16,16,16,16,16,16,26,26,26,26,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,24,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,24,24,24,24,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,9,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,26,8,8,8,8,26,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,26,26,8,8,8,8,8,8,8,8,8,24,24,24,24,24,24,24,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,24,24,24,24,24,24,24,8,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,11,11,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,10,8,8,8,10,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        26,8,8,26,8,26,26,8,26,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,26,8,26,8,26,26,26,26,
+        26,26,8,26,26,26,26,8,26,8,26,8,26,8,8,8,26,8,8,26,8,26,26,8,26,8,26,8,26,8,26,8,
+        26,8,8,26,8,26,26,8,8,8,8,26,8,8,8,8,8,8,8,26,8,8,8,8,26,8,8,8,8,26,8,26,
+        8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,
+        26,8,8,8,26,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        55,55,55,55,51,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,82,82,82,82,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,82,82,82,82,82,82,82,82,82,82,82,82,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,82,82,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        82,55,55,55,55,55,55,55,55,55,55,55,55,55,55,51,82,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,82,82,82,82,82,82,82,82,82,82,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,55,55,55,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,8,22,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,8,8,22,55,55,55,50,50,21,21,21,21,21,21,21,21,21,21,21,21,50,50,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,21,58,21,21,58,58,58,58,58,58,58,58,58,58,21,21,21,21,21,
+        21,21,21,21,21,21,21,21,21,21,21,21,21,55,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,83,
+        60,51,51,82,82,82,82,82,82,82,82,82,82,82,82,82,60,60,60,60,60,60,60,60,60,60,51,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,51,60,60,51,51,51,51,51,51,51,51,51,60,82,82,82,82,
+        60,60,60,60,60,60,60,60,60,82,82,82,82,82,82,82,51,51,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        51,51,51,51,51,51,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,55,55,55,55,55,55,55,55,55,55,55,55,51,51,51,51,51,51,51,51,51,55,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,55,51,51,
+        51,51,51,51,51,57,51,51,51,51,51,51,51,51,51,51,51,51,51,51,55,55,55,55,55,55,55,55,22,22,55,55,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,54,54,51,51,51,51,51,54,51,51,51,
+        51,51,57,57,57,51,51,57,51,51,57,56,56,55,55,51,51,51,51,51,55,55,55,55,55,55,55,55,55,55,55,55,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,55,55,55,51,55,55,55,51,51,51,84,84,84,84,84,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,55,
+        51,55,57,57,51,51,57,57,57,57,57,57,57,57,57,57,57,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,57,51,51,51,57,51,51,51,
+        51,57,57,57,51,57,57,57,51,51,51,51,51,51,51,57,51,57,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        54,51,54,51,54,51,51,51,51,51,57,51,51,51,51,54,51,54,54,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,55,55,51,
+        54,54,54,54,54,54,54,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,54,54,54,54,54,54,54,54,54,
+        54,54,54,54,54,51,51,51,51,51,51,51,51,51,51,51,51,51,54,54,54,54,54,54,54,54,54,54,54,54,8,8,
+        8,8,8,8,8,8,22,22,22,22,55,51,51,51,51,55,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,55,55,55,55,55,55,55,55,55,55,55,55,56,56,55,55,55,55,57,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,56,55,55,55,55,57,57,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,51,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,22,22,22,22,22,22,22,22,55,55,55,55,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,55,22,22,22,22,22,22,55,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,57,57,57,51,51,51,57,57,57,57,57,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,7,7,7,39,39,39,8,8,8,8,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,57,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,57,57,57,51,51,51,51,51,51,51,51,51,
+        57,51,51,51,51,51,55,55,55,55,55,55,57,55,55,55,51,51,51,55,55,51,51,51,82,82,82,82,82,51,51,51,
+        55,55,55,55,55,55,55,55,55,55,55,51,51,82,82,82,55,55,55,55,51,51,51,51,51,51,51,51,51,82,82,82,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,82,82,82,82,82,82,82,82,82,82,82,82,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,55,55,55,55,82,82,82,82,82,82,82,
+        51,51,51,51,51,51,51,51,51,51,51,51,82,82,82,82,51,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        8,8,8,8,8,8,8,8,8,8,8,8,82,82,82,82,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,82,82,82,82,82,82,82,82,8,8,8,8,8,8,8,8,8,8,82,82,82,82,82,82,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,82,82,82,82,82,82,82,82,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,82,82,55,55,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        8,8,8,8,8,8,8,8,8,8,8,8,57,51,51,57,51,51,51,51,51,51,51,51,57,57,57,57,57,57,57,57,
+        51,51,51,51,51,51,57,51,51,51,51,51,51,51,51,51,57,57,57,57,57,57,57,57,57,57,51,65,57,57,57,51,
+        51,51,51,51,51,51,65,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,57,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,57,57,51,57,57,51,57,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,57,57,57,51,57,57,57,57,57,57,57,57,57,57,57,57,57,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,
+        22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,22,82,82,82,82,82,82,82,82,82,82,82,82,
+        55,55,55,55,55,55,55,55,55,55,55,55,55,55,82,82,51,51,51,51,51,82,82,82,51,51,51,51,51,82,82,82,
+        51,51,51,51,51,51,51,82,82,82,82,82,82,82,82,82,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,51,
+        51,51,51,51,51,51,51,51,51,51,51,51,51,82,82,82,51,51,51,51,51,51,51,51,51,51,51,82,82,82,82,82,
+        51,51,51,57,57,57,82,82,82,82,82,82,82,82,82,82,51,51,51,51,51,51,51,51,51,51,82,82,82,82,82,82,
+        51,51,51,51,51,51,51,51,82,82,82,82,82,82,82,82,57,57,57,57,57,57,57,82,82,82,82,82,82,82,82,82,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,26,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,8,
+        8,8,8,8,8,8,8,8,8,8,8,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,
+        26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,26,16,16,16,16,16,16,16,16,16,16,26,26,26,26,26,26,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,
+        82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,82,26,26,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,
+        60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,60,26,26,
+        48,0,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+        48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+        48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+        48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+        24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,48,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,
+        70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,70,26,26,
+    };
+}
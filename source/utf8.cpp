@@ -1,365 +1,1551 @@
 #include <utf8.hpp>
 #include <log.hpp>
+#include <cpu.hpp>
 
 #include <cstring>
 #include <limits>
+#include <bit>
+#include <algorithm>
+#include <array>
+
+#if defined(ENVY_ARCH_X86)
+    #include <immintrin.h>
+#endif
 
 namespace Envy::utf8
 {
 
+    // the decoder tables and decode_sequence() are defined in utf8.hpp
+    using namespace detail;
+
+
     // ==== Envy::utf8::code_point ====
 
-    code_point::code_point(code_unit value) noexcept :
-        cp { static_cast<u32>(value) }
-    {}
 
+    std::ostream& operator<<(std::ostream& os, code_point cp)
+    {
+        code_unit buffer[5] {'\0','\0','\0','\0','\0'};
 
-    code_point::code_point(char value) noexcept :
-        cp { static_cast<u32>(value) }
-    {}
+        encode(cp, buffer);
 
+        os << buffer;
 
-    code_point::code_point(char8_t value) noexcept :
-        cp { static_cast<u32>(value) }
-    {}
+        return os;
+    }
 
 
-    code_point::code_point(u32 value) noexcept :
-        cp {value}
-    {}
+    // ==== utf8 helper funcs ====
 
 
-    code_point::code_point(const char* value) noexcept :
-        cp { decode( (const code_unit*) value).get() }
+    void detail::invalid_utf8(const char* msg) noexcept(!Envy::debug)
     {
-        Envy::debug_assert(utf8::count_code_points( (const code_unit*) value) == 1, "Trying to construct EnvyLLutf8::code_point from multi character string");
+        Envy::debug_assert(false, msg);
     }
 
 
-    u32& code_point::get() noexcept
-    { return cp; }
-
+    i32 count_code_points(const code_unit* buffer) noexcept
+    {
+        return count_code_points(buffer, size_bytes(buffer));
+    }
 
-    code_point::operator u32() const noexcept
-    { return cp; }
 
+    usize size_bytes(const code_unit* buffer) noexcept
+    {
+        return strlen( reinterpret_cast<const char*>(buffer) );
+    }
 
-    std::ostream& operator<<(std::ostream& os, code_point cp)
+    usize size_bytes(const char* buffer) noexcept
     {
-        code_unit buffer[5] {'\0','\0','\0','\0','\0'};
+        return strlen( buffer );
+    }
 
-        encode(cp, buffer);
 
-        os << buffer;
+    bool is_valid_utf8(const code_unit* buffer) noexcept
+    {
+        return validate(buffer, size_bytes(buffer)).valid;
+    }
 
-        return os;
+
+    bool is_valid_utf8(const code_unit* buffer, usize size_bytes) noexcept
+    {
+        return validate(buffer, size_bytes).valid;
     }
 
 
-    // ==== utf8 helper funcs ====
+    // ==== validation kernels ====
 
 
     namespace
     {
-        // these are used to mask off the encoding bits of the code units so we can get at that jucy unicode code point data
-        constexpr code_unit  c_mask {0b00111111}; // continuation unit
-        constexpr code_unit l2_mask {0b00011111}; // lead unit indicating 2 continuation units
-        constexpr code_unit l3_mask {0b00001111}; // lead unit indicating 3 continuation units
-        constexpr code_unit l4_mask {0b00000111}; // lead unit indicating 4 continuation units
-
-        // prefixes for unicode code units, used for encoding code points
-        constexpr code_unit  c_prefix {0b10000000}; // continuation unit
-        constexpr code_unit f2_prefix {0b11000000}; // lead unit indicating 2 continuation units
-        constexpr code_unit f3_prefix {0b11100000}; // lead unit indicating 3 continuation units
-        constexpr code_unit f4_prefix {0b11110000}; // lead unit indicating 4 continuation units
-
-        // All continuation units contain exactly six bits from the code point
-        constexpr i32 bits_per_continuation_unit {6};
+        // A sequence decoded by decode_sequence()
+        // Returns the length of the well-formed sequence starting at 'seq', or 0 if it is ill-formed
+        usize well_formed_length(const code_unit* seq, usize available) noexcept
+        {
+            const sequence s {decode_sequence(seq, available)};
+            return s.valid ? s.length : 0u;
+        }
+
+
+        // Returns the offset of the first ill-formed sequence, or 'size' if the buffer is valid.
+        // Clears 'ascii' if a unit before that offset is not ascii
+        usize validate_scalar(const code_unit* buffer, usize size, bool& ascii) noexcept
+        {
+            constexpr u64 high_bits {0x8080808080808080ull};
+
+            usize i {};
+
+            while(i < size)
+            {
+                // skip ascii eight code units at a time
+                if(size - i >= 8u)
+                {
+                    u64 word;
+                    std::memcpy(&word, buffer + i, 8u);
+
+                    if((word & high_bits) == 0u)
+                    {
+                        i += 8u;
+                        continue;
+                    }
+
+                    // jump to the first non-ascii unit, x86 and arm64 windows are little endian
+                    i += static_cast<usize>(std::countr_zero(word & high_bits) / 8);
+                }
+
+                const usize length {well_formed_length(buffer + i, size - i)};
+
+                if(length == 0u)
+                { return i; }
+
+                ascii = ascii && length == 1u;
+                i += length;
+            }
+
+            return size;
+        }
+
+
+        // Returns the first offset in [from-3,from] that starts a sequence, assuming
+        // every unit before 'from' has been validated. Used to hand off to the scalar kernel
+        usize resync(const code_unit* buffer, usize from) noexcept
+        {
+            usize start {from >= 3u ? from - 3u : 0u};
+
+            while(start < from && (buffer[start] & 0xC0u) == 0x80u)
+            { ++start; }
+
+            return start;
+        }
+
+
+        #if defined(ENVY_ARCH_X86)
+
+        // SSE2 has no byte shuffle, so this kernel skips ascii sixteen units at a time and
+        // validates multi unit sequences with the scalar rules
+        ENVY_TARGET_SSE2 usize validate_sse2(const code_unit* buffer, usize size, bool& ascii) noexcept
+        {
+            usize i {};
+
+            while(i < size)
+            {
+                if(size - i >= 16u)
+                {
+                    const __m128i block {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i))};
+                    const u32 non_ascii {static_cast<u32>(_mm_movemask_epi8(block))};
+
+                    if(non_ascii == 0u)
+                    {
+                        i += 16u;
+                        continue;
+                    }
+
+                    i += static_cast<usize>(std::countr_zero(non_ascii));
+                }
+
+                const usize length {well_formed_length(buffer + i, size - i)};
+
+                if(length == 0u)
+                { return i; }
+
+                ascii = ascii && length == 1u;
+                i += length;
+            }
+
+            return size;
+        }
+
+
+        // -- AVX2, lookup algorithm from Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte"
+
+        // error bits, set in all three lookups when a pair of units exhibits that error
+        constexpr u8 too_short      {1u << 0}; // 11______ 0_______ , 11______ 11______
+        constexpr u8 too_long       {1u << 1}; // 0_______ 10______
+        constexpr u8 overlong_3     {1u << 2}; // 11100000 100_____
+        constexpr u8 too_large      {1u << 3}; // 11110100 1001____ , 11110100 101_____ , 11110101+ 10______
+        constexpr u8 surrogate      {1u << 4}; // 11101101 101_____
+        constexpr u8 overlong_2     {1u << 5}; // 1100000_ 10______
+        constexpr u8 too_large_1000 {1u << 6}; // 11110101+ 1000____
+        constexpr u8 overlong_4     {1u << 6}; // 11110000 1000____
+        constexpr u8 two_conts      {1u << 7}; // 10______ 10______
+        constexpr u8 carry          {too_short | too_long | two_conts};
+
+
+        template <int N>
+        ENVY_TARGET_AVX2 __m256i prev_units(__m256i input, __m256i prev_input) noexcept
+        {
+            // units shifted in from the previous block
+            return _mm256_alignr_epi8(input, _mm256_permute2x128_si256(prev_input, input, 0x21), 16 - N);
+        }
+
+
+        ENVY_TARGET_AVX2 __m256i lookup_16(__m256i nibbles, __m256i table) noexcept
+        {
+            return _mm256_shuffle_epi8(table, nibbles);
+        }
+
+
+        ENVY_TARGET_AVX2 __m256i high_nibbles(__m256i v) noexcept
+        {
+            return _mm256_and_si256(_mm256_srli_epi16(v, 4), _mm256_set1_epi8(0x0F));
+        }
+
+
+        ENVY_TARGET_AVX2 __m256i check_special_cases(__m256i input, __m256i prev1) noexcept
+        {
+            const __m256i byte_1_high_table {_mm256_setr_epi8(
+                // 0_______ ________ , ascii in byte 1
+                too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+                // 10______ ________ , continuation in byte 1
+                two_conts, two_conts, two_conts, two_conts,
+                // 1100____ , 1101____ , two unit leads
+                too_short | overlong_2, too_short,
+                // 1110____ , three unit leads
+                too_short | overlong_3 | surrogate,
+                // 1111____ , four unit leads
+                too_short | too_large | too_large_1000 | overlong_4,
+
+                too_long, too_long, too_long, too_long, too_long, too_long, too_long, too_long,
+                two_conts, two_conts, two_conts, two_conts,
+                too_short | overlong_2, too_short,
+                too_short | overlong_3 | surrogate,
+                too_short | too_large | too_large_1000 | overlong_4
+            )};
+
+            const __m256i byte_1_low_table {_mm256_setr_epi8(
+                // ____0000 , ____0001
+                carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2,
+                // ____001_
+                carry, carry,
+                // ____0100 , ____0101 , ____011_
+                carry | too_large, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+                // ____1___
+                carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000, carry | too_large | too_large_1000 | surrogate, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+
+                carry | overlong_3 | overlong_2 | overlong_4, carry | overlong_2,
+                carry, carry,
+                carry | too_large, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000, carry | too_large | too_large_1000,
+                carry | too_large | too_large_1000, carry | too_large | too_large_1000 | surrogate, carry | too_large | too_large_1000, carry | too_large | too_large_1000
+            )};
+
+            const __m256i byte_2_high_table {_mm256_setr_epi8(
+                // ________ 0_______ , ascii in byte 2
+                too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+                // ________ 1000____
+                too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+                // ________ 1001____
+                too_long | overlong_2 | two_conts | overlong_3 | too_large,
+                // ________ 101_____
+                too_long | overlong_2 | two_conts | surrogate | too_large,
+                too_long | overlong_2 | two_conts | surrogate | too_large,
+                // ________ 11______
+                too_short, too_short, too_short, too_short,
+
+                too_short, too_short, too_short, too_short, too_short, too_short, too_short, too_short,
+                too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4,
+                too_long | overlong_2 | two_conts | overlong_3 | too_large,
+                too_long | overlong_2 | two_conts | surrogate | too_large,
+                too_long | overlong_2 | two_conts | surrogate | too_large,
+                too_short, too_short, too_short, too_short
+            )};
+
+            const __m256i byte_1_high {lookup_16(high_nibbles(prev1), byte_1_high_table)};
+            const __m256i byte_1_low  {lookup_16(_mm256_and_si256(prev1, _mm256_set1_epi8(0x0F)), byte_1_low_table)};
+            const __m256i byte_2_high {lookup_16(high_nibbles(input), byte_2_high_table)};
+
+            return _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+        }
+
+
+        ENVY_TARGET_AVX2 __m256i check_multibyte_lengths(__m256i input, __m256i prev_input, __m256i special_cases) noexcept
+        {
+            const __m256i prev2 {prev_units<2>(input, prev_input)};
+            const __m256i prev3 {prev_units<3>(input, prev_input)};
+
+            // only 111_____ and 1111____ survive the subtraction with their high bit set
+            const __m256i is_third_unit  {_mm256_subs_epu8(prev2, _mm256_set1_epi8((char) (0xE0u - 0x80u)))};
+            const __m256i is_fourth_unit {_mm256_subs_epu8(prev3, _mm256_set1_epi8((char) (0xF0u - 0x80u)))};
+
+            const __m256i must_be_continuation {_mm256_and_si256(_mm256_or_si256(is_third_unit, is_fourth_unit), _mm256_set1_epi8((char) 0x80u))};
+
+            return _mm256_xor_si256(must_be_continuation, special_cases);
+        }
+
+
+        ENVY_TARGET_AVX2 __m256i is_incomplete(__m256i input) noexcept
+        {
+            // non-zero where a lead in the last three units needs units from the next block
+            const __m256i max_value {_mm256_setr_epi8(
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                (char) (0xF0u - 1u), (char) (0xE0u - 1u), (char) (0xC0u - 1u)
+            )};
+
+            return _mm256_subs_epu8(input, max_value);
+        }
+
+
+        ENVY_TARGET_AVX2 usize validate_avx2(const code_unit* buffer, usize size, bool& ascii) noexcept
+        {
+            __m256i prev_input      {_mm256_setzero_si256()};
+            __m256i prev_incomplete {_mm256_setzero_si256()};
+
+            usize i {};
+
+            for(; size - i >= 32u; i += 32u)
+            {
+                const __m256i input {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i))};
+
+                __m256i error;
+
+                const bool block_ascii {_mm256_movemask_epi8(input) == 0};
+
+                if(block_ascii)
+                {
+                    // all ascii, only an unfinished sequence from the previous block can be an error
+                    error = prev_incomplete;
+                    prev_incomplete = _mm256_setzero_si256();
+                }
+                else
+                {
+                    const __m256i special_cases {check_special_cases(input, prev_units<1>(input, prev_input))};
+                    error = check_multibyte_lengths(input, prev_input, special_cases);
+                    prev_incomplete = is_incomplete(input);
+                }
+
+                if(!_mm256_testz_si256(error, error))
+                {
+                    // the error lies in this block or a sequence straddling into it, let the scalar kernel pinpoint it
+                    const usize start {resync(buffer, i)};
+                    return start + validate_scalar(buffer + start, size - start, ascii);
+                }
+
+                ascii = ascii && block_ascii;
+                prev_input = input;
+            }
+
+            // tail, including any sequence left unfinished by the last block
+            const usize start {resync(buffer, i)};
+            return start + validate_scalar(buffer + start, size - start, ascii);
+        }
+
+        #endif
     }
 
 
-    i32 code_units_encoded(const code_unit* lead) noexcept(!Envy::debug)
+    validation_result validate(const code_unit* buffer, usize size_bytes) noexcept
     {
-        Envy::debug_assert(is_lead_unit(lead), "Invalid UTF-8");
+        usize offset {};
+        bool ascii {true};
+
+        #if defined(ENVY_ARCH_X86)
+        switch(cpu::active_simd_level())
+        {
+            case cpu::simd_level::avx2: offset = validate_avx2(buffer, size_bytes, ascii); break;
+            case cpu::simd_level::sse2: offset = validate_sse2(buffer, size_bytes, ascii); break;
+            default: offset = validate_scalar(buffer, size_bytes, ascii); break;
+        }
+        #else
+        offset = validate_scalar(buffer, size_bytes, ascii);
+        #endif
 
-        i32 units {std::countl_one(*lead)};
-        return units + (units?0:1);
+        return { offset, offset == size_bytes, ascii };
     }
 
 
-    i32 code_units_required(code_point cp) noexcept
+    // ==== counting kernels ====
+
+
+    namespace
     {
-        i32 code_units {1};
-        if( static_cast<u32>(cp) > 0x007Fu) ++code_units;
-        if( static_cast<u32>(cp) > 0x07FFu) ++code_units;
-        if( static_cast<u32>(cp) > 0xFFFFu) ++code_units;
-        return code_units;
+        // a code point is counted for each unit that isn't a continuation unit (10______)
+
+        usize count_scalar(const code_unit* buffer, usize size) noexcept
+        {
+            constexpr u64 high_bits {0x8080808080808080ull};
+
+            usize continuations {};
+            usize i {};
+
+            for(; size - i >= 8u; i += 8u)
+            {
+                u64 word;
+                std::memcpy(&word, buffer + i, 8u);
+
+                // shifting left moves bit 6 of each unit under bit 7 of the same unit
+                continuations += static_cast<usize>(std::popcount(word & ~(word << 1) & high_bits));
+            }
+
+            for(; i < size; ++i)
+            { continuations += (buffer[i] & 0xC0u) == 0x80u; }
+
+            return size - continuations;
+        }
+
+
+        #if defined(ENVY_ARCH_X86)
+
+        ENVY_TARGET_SSE2 usize count_sse2(const code_unit* buffer, usize size) noexcept
+        {
+            // continuation units are the only ones below -64 as signed bytes
+            const __m128i threshold {_mm_set1_epi8(-64)};
+
+            usize continuations {};
+            usize i {};
+
+            while(size - i >= 16u)
+            {
+                // per byte counters can take 255 blocks before they must be summed
+                const usize blocks {std::min<usize>((size - i) / 16u, 255u)};
+
+                __m128i counters {_mm_setzero_si128()};
+
+                for(usize b {}; b < blocks; ++b, i += 16u)
+                {
+                    const __m128i block {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i))};
+                    counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(threshold, block));
+                }
+
+                const __m128i sums {_mm_sad_epu8(counters, _mm_setzero_si128())};
+                continuations += static_cast<usize>(_mm_cvtsi128_si32(sums)) + static_cast<usize>(_mm_extract_epi16(sums, 4));
+            }
+
+            return i - continuations + count_scalar(buffer + i, size - i);
+        }
+
+
+        ENVY_TARGET_AVX2 usize count_avx2(const code_unit* buffer, usize size) noexcept
+        {
+            const __m256i threshold {_mm256_set1_epi8(-64)};
+
+            usize continuations {};
+            usize i {};
+
+            while(size - i >= 32u)
+            {
+                const usize blocks {std::min<usize>((size - i) / 32u, 255u)};
+
+                __m256i counters {_mm256_setzero_si256()};
+
+                for(usize b {}; b < blocks; ++b, i += 32u)
+                {
+                    const __m256i block {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i))};
+                    counters = _mm256_sub_epi8(counters, _mm256_cmpgt_epi8(threshold, block));
+                }
+
+                const __m256i sums {_mm256_sad_epu8(counters, _mm256_setzero_si256())};
+                const __m128i half {_mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1))};
+                continuations += static_cast<usize>(_mm_cvtsi128_si32(half)) + static_cast<usize>(_mm_extract_epi16(half, 4));
+            }
+
+            return i - continuations + count_scalar(buffer + i, size - i);
+        }
+
+        #endif
     }
 
 
-    i32 count_code_points(const code_unit* buffer) noexcept(!Envy::debug)
+    i32 count_code_points(const code_unit* buffer, usize size_bytes) noexcept
     {
-        i32 chars {};
-        while(*buffer != '\0')
+        #if defined(ENVY_ARCH_X86)
+        switch(cpu::active_simd_level())
         {
-            increment_ptr(&buffer);
-            ++chars;
+            case cpu::simd_level::avx2: return static_cast<i32>(count_avx2(buffer, size_bytes));
+            case cpu::simd_level::sse2: return static_cast<i32>(count_sse2(buffer, size_bytes));
+            default: return static_cast<i32>(count_scalar(buffer, size_bytes));
         }
-        return chars;
+        #else
+        return static_cast<i32>(count_scalar(buffer, size_bytes));
+        #endif
     }
 
 
-    i32 count_code_points(const code_unit* buffer, usize size_bytes) noexcept(!Envy::debug)
+    // ==== ascii kernels ====
+
+
+    namespace
     {
-        i32 chars {};
-        const code_unit* end {buffer + size_bytes};
+        bool is_ascii_scalar(const code_unit* buffer, usize size) noexcept
+        {
+            constexpr u64 high_bits {0x8080808080808080ull};
+
+            u64 any {};
+            usize i {};
+
+            for(; size - i >= 8u; i += 8u)
+            {
+                u64 word;
+                std::memcpy(&word, buffer + i, 8u);
+                any |= word;
+            }
+
+            for(; i < size; ++i)
+            { any |= buffer[i]; }
+
+            return (any & high_bits) == 0u;
+        }
+
 
-        while(*buffer != '\0' && buffer < end)
+        #if defined(ENVY_ARCH_X86)
+
+        ENVY_TARGET_SSE2 bool is_ascii_sse2(const code_unit* buffer, usize size) noexcept
         {
-            increment_ptr(&buffer);
-            ++chars;
+            __m128i any {_mm_setzero_si128()};
+            usize i {};
+
+            for(; size - i >= 16u; i += 16u)
+            { any = _mm_or_si128(any, _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i))); }
+
+            return _mm_movemask_epi8(any) == 0 && is_ascii_scalar(buffer + i, size - i);
         }
-        return chars;
+
+
+        ENVY_TARGET_AVX2 bool is_ascii_avx2(const code_unit* buffer, usize size) noexcept
+        {
+            __m256i any {_mm256_setzero_si256()};
+            usize i {};
+
+            for(; size - i >= 32u; i += 32u)
+            { any = _mm256_or_si256(any, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i))); }
+
+            return _mm256_movemask_epi8(any) == 0 && is_ascii_scalar(buffer + i, size - i);
+        }
+
+        #endif
     }
 
 
-    usize size_bytes(const code_unit* buffer) noexcept
+    bool is_ascii(const code_unit* buffer, usize size_bytes) noexcept
     {
-        return strlen( reinterpret_cast<const char*>(buffer) );
+        #if defined(ENVY_ARCH_X86)
+        switch(cpu::active_simd_level())
+        {
+            case cpu::simd_level::avx2: return is_ascii_avx2(buffer, size_bytes);
+            case cpu::simd_level::sse2: return is_ascii_sse2(buffer, size_bytes);
+            default: return is_ascii_scalar(buffer, size_bytes);
+        }
+        #else
+        return is_ascii_scalar(buffer, size_bytes);
+        #endif
     }
 
-    usize size_bytes(const char* buffer) noexcept
+
+    // ==== search kernels ====
+
+
+    namespace
     {
-        return strlen( buffer );
+        // Horspool, skips on the unit under the end of the window, handles any needle of two or more units
+
+        const code_unit* find_scalar(const code_unit* buffer, usize size, const code_unit* needle, usize n) noexcept
+        {
+            if(n > size)
+            { return nullptr; }
+
+            if(n == 1u)
+            { return static_cast<const code_unit*>(std::memchr(buffer, needle[0], size)); }
+
+            std::array<usize, 256> shift;
+            shift.fill(n);
+
+            for(usize i {}; i < n - 1u; ++i)
+            { shift[needle[i]] = n - 1u - i; }
+
+            const code_unit last {needle[n - 1u]};
+
+            for(usize pos {}; pos <= size - n; pos += shift[buffer[pos + n - 1u]])
+            {
+                if(buffer[pos + n - 1u] == last && std::memcmp(buffer + pos, needle, n - 1u) == 0)
+                { return buffer + pos; }
+            }
+
+            return nullptr;
+        }
+
+
+        // Horspool mirrored, skips on the unit under the start of the window
+
+        const code_unit* find_last_scalar(const code_unit* buffer, usize size, const code_unit* needle, usize n) noexcept
+        {
+            if(n > size)
+            { return nullptr; }
+
+            std::array<usize, 256> shift;
+            shift.fill(n);
+
+            for(usize i {n - 1u}; i > 0u; --i)
+            { shift[needle[i]] = i; }
+
+            const code_unit first {needle[0]};
+
+            for(usize pos {size - n};; pos -= shift[buffer[pos]])
+            {
+                if(buffer[pos] == first && std::memcmp(buffer + pos + 1u, needle + 1u, n - 1u) == 0)
+                { return buffer + pos; }
+
+                if(pos < shift[buffer[pos]])
+                { return nullptr; }
+            }
+        }
+
+
+        usize count_unit_scalar(const code_unit* buffer, usize size, code_unit unit) noexcept
+        {
+            usize count {};
+
+            for(usize i {}; i < size; ++i)
+            { count += buffer[i] == unit; }
+
+            return count;
+        }
+
+
+        #if defined(ENVY_ARCH_X86)
+
+        // After Wojciech Muła's "SIMD-friendly algorithms for substring searching": compare a block
+        // of candidate positions against the first and last unit of the needle at once, and only
+        // memcmp the middle where both match. Rare false candidates keep this near memchr speed
+        // even when the first unit is common, e.g. the lead unit of CJK text.
+
+        ENVY_TARGET_SSE2 const code_unit* find_sse2(const code_unit* buffer, usize size, const code_unit* needle, usize n) noexcept
+        {
+            if(n > size)
+            { return nullptr; }
+
+            const __m128i first {_mm_set1_epi8(static_cast<char>(needle[0]))};
+            const __m128i last {_mm_set1_epi8(static_cast<char>(needle[n - 1u]))};
+
+            // candidate positions are 0 through size - n
+            const usize positions {size - n + 1u};
+            usize i {};
+
+            for(; i + 16u <= positions; i += 16u)
+            {
+                const __m128i block_first {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i))};
+                const __m128i block_last {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i + n - 1u))};
+
+                u32 mask {static_cast<u32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last))))};
+
+                for(; mask != 0u; mask &= mask - 1u)
+                {
+                    const usize pos {i + static_cast<usize>(std::countr_zero(mask))};
+
+                    if(n <= 2u || std::memcmp(buffer + pos + 1u, needle + 1u, n - 2u) == 0)
+                    { return buffer + pos; }
+                }
+            }
+
+            return find_scalar(buffer + i, positions - i + n - 1u, needle, n);
+        }
+
+
+        ENVY_TARGET_SSE2 const code_unit* find_last_sse2(const code_unit* buffer, usize size, const code_unit* needle, usize n) noexcept
+        {
+            if(n > size)
+            { return nullptr; }
+
+            const __m128i first {_mm_set1_epi8(static_cast<char>(needle[0]))};
+            const __m128i last {_mm_set1_epi8(static_cast<char>(needle[n - 1u]))};
+
+            usize end {size - n + 1u};
+
+            for(; end >= 16u; end -= 16u)
+            {
+                const usize i {end - 16u};
+
+                const __m128i block_first {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i))};
+                const __m128i block_last {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i + n - 1u))};
+
+                u32 mask {static_cast<u32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last))))};
+
+                while(mask != 0u)
+                {
+                    const u32 bit {31u - static_cast<u32>(std::countl_zero(mask))};
+                    const usize pos {i + bit};
+
+                    if(n <= 2u || std::memcmp(buffer + pos + 1u, needle + 1u, n - 2u) == 0)
+                    { return buffer + pos; }
+
+                    mask &= ~(1u << bit);
+                }
+            }
+
+            return find_last_scalar(buffer, end + n - 1u, needle, n);
+        }
+
+
+        ENVY_TARGET_SSE2 usize count_unit_sse2(const code_unit* buffer, usize size, code_unit unit) noexcept
+        {
+            const __m128i target {_mm_set1_epi8(static_cast<char>(unit))};
+
+            usize count {};
+            usize i {};
+
+            while(size - i >= 16u)
+            {
+                // per byte counters can take 255 blocks before they must be summed
+                const usize blocks {std::min<usize>((size - i) / 16u, 255u)};
+
+                __m128i counters {_mm_setzero_si128()};
+
+                for(usize b {}; b < blocks; ++b, i += 16u)
+                {
+                    const __m128i block {_mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + i))};
+                    counters = _mm_sub_epi8(counters, _mm_cmpeq_epi8(block, target));
+                }
+
+                const __m128i sums {_mm_sad_epu8(counters, _mm_setzero_si128())};
+                count += static_cast<usize>(_mm_cvtsi128_si32(sums)) + static_cast<usize>(_mm_extract_epi16(sums, 4));
+            }
+
+            return count + count_unit_scalar(buffer + i, size - i, unit);
+        }
+
+
+        ENVY_TARGET_AVX2 const code_unit* find_avx2(const code_unit* buffer, usize size, const code_unit* needle, usize n) noexcept
+        {
+            if(n > size)
+            { return nullptr; }
+
+            const __m256i first {_mm256_set1_epi8(static_cast<char>(needle[0]))};
+            const __m256i last {_mm256_set1_epi8(static_cast<char>(needle[n - 1u]))};
+
+            const usize positions {size - n + 1u};
+            usize i {};
+
+            for(; i + 32u <= positions; i += 32u)
+            {
+                const __m256i block_first {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i))};
+                const __m256i block_last {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i + n - 1u))};
+
+                u32 mask {static_cast<u32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last))))};
+
+                for(; mask != 0u; mask &= mask - 1u)
+                {
+                    const usize pos {i + static_cast<usize>(std::countr_zero(mask))};
+
+                    if(n <= 2u || std::memcmp(buffer + pos + 1u, needle + 1u, n - 2u) == 0)
+                    { return buffer + pos; }
+                }
+            }
+
+            return find_sse2(buffer + i, positions - i + n - 1u, needle, n);
+        }
+
+
+        ENVY_TARGET_AVX2 const code_unit* find_last_avx2(const code_unit* buffer, usize size, const code_unit* needle, usize n) noexcept
+        {
+            if(n > size)
+            { return nullptr; }
+
+            const __m256i first {_mm256_set1_epi8(static_cast<char>(needle[0]))};
+            const __m256i last {_mm256_set1_epi8(static_cast<char>(needle[n - 1u]))};
+
+            usize end {size - n + 1u};
+
+            for(; end >= 32u; end -= 32u)
+            {
+                const usize i {end - 32u};
+
+                const __m256i block_first {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i))};
+                const __m256i block_last {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i + n - 1u))};
+
+                u32 mask {static_cast<u32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(block_first, first), _mm256_cmpeq_epi8(block_last, last))))};
+
+                while(mask != 0u)
+                {
+                    const u32 bit {31u - static_cast<u32>(std::countl_zero(mask))};
+                    const usize pos {i + bit};
+
+                    if(n <= 2u || std::memcmp(buffer + pos + 1u, needle + 1u, n - 2u) == 0)
+                    { return buffer + pos; }
+
+                    mask &= ~(1u << bit);
+                }
+            }
+
+            return find_last_sse2(buffer, end + n - 1u, needle, n);
+        }
+
+
+        ENVY_TARGET_AVX2 usize count_unit_avx2(const code_unit* buffer, usize size, code_unit unit) noexcept
+        {
+            const __m256i target {_mm256_set1_epi8(static_cast<char>(unit))};
+
+            usize count {};
+            usize i {};
+
+            while(size - i >= 32u)
+            {
+                const usize blocks {std::min<usize>((size - i) / 32u, 255u)};
+
+                __m256i counters {_mm256_setzero_si256()};
+
+                for(usize b {}; b < blocks; ++b, i += 32u)
+                {
+                    const __m256i block {_mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i))};
+                    counters = _mm256_sub_epi8(counters, _mm256_cmpeq_epi8(block, target));
+                }
+
+                const __m256i sums {_mm256_sad_epu8(counters, _mm256_setzero_si256())};
+                const __m128i half {_mm_add_epi64(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1))};
+                count += static_cast<usize>(_mm_cvtsi128_si32(half)) + static_cast<usize>(_mm_extract_epi16(half, 4));
+            }
+
+            return count + count_unit_sse2(buffer + i, size - i, unit);
+        }
+
+        #endif
     }
 
 
-    bool is_lead_unit(const code_unit* unit) noexcept
+    const code_unit* find_sequence(const code_unit* buffer, usize size_bytes, const code_unit* needle, usize needle_size) noexcept
     {
-        // must begin with 0, 2, 3, or 4 ones
-        i32 ones {std::countl_one(*unit)};
-        return ones != 1 && ones < 5;
+        if(needle_size == 0u)
+        { return buffer; }
+
+        // the C library's memchr is already vectorized
+        if(needle_size == 1u)
+        { return find_scalar(buffer, size_bytes, needle, 1u); }
+
+        #if defined(ENVY_ARCH_X86)
+        switch(cpu::active_simd_level())
+        {
+            case cpu::simd_level::avx2: return find_avx2(buffer, size_bytes, needle, needle_size);
+            case cpu::simd_level::sse2: return find_sse2(buffer, size_bytes, needle, needle_size);
+            default: return find_scalar(buffer, size_bytes, needle, needle_size);
+        }
+        #else
+        return find_scalar(buffer, size_bytes, needle, needle_size);
+        #endif
     }
 
 
-    bool is_continuation_unit(const code_unit* unit) noexcept
+    const code_unit* find_last_sequence(const code_unit* buffer, usize size_bytes, const code_unit* needle, usize needle_size) noexcept
     {
-        // first two bits must be '10'
-        return (*unit >> bits_per_continuation_unit) == 0b10;
+        if(needle_size == 0u)
+        { return buffer + size_bytes; }
+
+        #if defined(ENVY_ARCH_X86)
+        switch(cpu::active_simd_level())
+        {
+            case cpu::simd_level::avx2: return find_last_avx2(buffer, size_bytes, needle, needle_size);
+            case cpu::simd_level::sse2: return find_last_sse2(buffer, size_bytes, needle, needle_size);
+            default: return find_last_scalar(buffer, size_bytes, needle, needle_size);
+        }
+        #else
+        return find_last_scalar(buffer, size_bytes, needle, needle_size);
+        #endif
     }
 
 
-    bool is_valid_char(const code_unit* lead) noexcept
+    usize count_sequence(const code_unit* buffer, usize size_bytes, const code_unit* needle, usize needle_size) noexcept
     {
-        int units {std::countl_one(*lead)};
+        if(needle_size == 0u)
+        { return 0u; }
 
-        if(units == 1 || units > 4)
-        { return false; }
-
-        units -= (units?1:0);
+        if(needle_size == 1u)
+        {
+            #if defined(ENVY_ARCH_X86)
+            switch(cpu::active_simd_level())
+            {
+                case cpu::simd_level::avx2: return count_unit_avx2(buffer, size_bytes, needle[0]);
+                case cpu::simd_level::sse2: return count_unit_sse2(buffer, size_bytes, needle[0]);
+                default: return count_unit_scalar(buffer, size_bytes, needle[0]);
+            }
+            #else
+            return count_unit_scalar(buffer, size_bytes, needle[0]);
+            #endif
+        }
 
-        ++lead;
+        usize count {};
+        const code_unit* const end {buffer + size_bytes};
 
-        for(int i {}; i < units; ++i)
+        for(const code_unit* match {find_sequence(buffer, size_bytes, needle, needle_size)}; match != nullptr;
+            match = find_sequence(match, static_cast<usize>(end - match), needle, needle_size))
         {
-            if(!is_continuation_unit(lead))
-            { return false; }
-            ++lead;
+            ++count;
+            match += needle_size;
         }
 
-        return true;
+        return count;
     }
 
 
-    void increment_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug)
-    {
-        *lead_ptr += code_units_encoded(*lead_ptr);
-    }
+    // ==== transcoding ====
 
 
-    void decrement_ptr(const code_unit** lead_ptr) noexcept(!Envy::debug)
+    namespace
     {
-        do { --(*lead_ptr); } while (is_continuation_unit(*lead_ptr));
-    }
+        constexpr u32 replacement_character {0xFFFDu};
 
+        // number of units needed to encode each code point
+        constexpr usize utf16_units(u32 cp) noexcept { return cp > 0xFFFFu ? 2u : 1u; }
 
-    void increment_ptr(code_unit** lead_ptr) noexcept(!Envy::debug) { increment_ptr((const code_unit**)lead_ptr); }
-    void decrement_ptr(code_unit** lead_ptr) noexcept(!Envy::debug) { decrement_ptr((const code_unit**)lead_ptr); }
+        constexpr bool is_surrogate(u32 cp) noexcept      { return cp >= 0xD800u && cp <= 0xDFFFu; }
+        constexpr bool is_high_surrogate(u32 cp) noexcept { return cp >= 0xD800u && cp <= 0xDBFFu; }
+        constexpr bool is_low_surrogate(u32 cp) noexcept  { return cp >= 0xDC00u && cp <= 0xDFFFu; }
 
 
-    code_point decode(const code_unit* lead) noexcept(!Envy::debug)
-    {
-        Envy::debug_assert(lead != nullptr, "Trying to decode nullptr");
-        Envy::debug_assert(is_lead_unit(lead), "Trying to decode invalid UTF-8");
+        // Decodes the code point at 'from[i]' from UTF-16, pairing surrogates.
+        // An unpaired surrogate decodes as an invalid sequence of length 1
+        sequence decode_utf16(std::span<const char16_t> from, usize i) noexcept
+        {
+            const u32 unit {from[i]};
 
-        u32 codepoint {};
+            if(!is_surrogate(unit))
+            { return { unit, 1u, true }; }
+
+            if(is_high_surrogate(unit) && i + 1u < from.size() && is_low_surrogate(from[i + 1u]))
+            {
+                const u32 cp { 0x10000u + ((unit - 0xD800u) << 10) + (static_cast<u32>(from[i + 1u]) - 0xDC00u) };
+                return { cp, 2u, true };
+            }
+
+            return { replacement_character, 1u, false };
+        }
 
-        i32 units {code_units_encoded(lead)};
 
-        switch(units)
+        sequence decode_utf32(std::span<const char32_t> from, usize i) noexcept
         {
-            // ascii
-            case 1: return code_point {*lead};
+            const u32 cp {from[i]};
 
-            // mask off encoding data
-            case 2: codepoint = static_cast<code_unit>(*lead & l2_mask); break;
-            case 3: codepoint = static_cast<code_unit>(*lead & l3_mask); break;
-            case 4: codepoint = static_cast<code_unit>(*lead & l4_mask); break;
+            if(cp > 0x10FFFFu || is_surrogate(cp))
+            { return { replacement_character, 1u, false }; }
+
+            return { cp, 1u, true };
         }
 
-        ++lead;
-        --units;
 
-        while(units > 0)
+        // -- ascii fast paths, each copies the run of ascii at the start of 'from',
+        //    up to 'count' units, and returns the number of units copied
+
+
+        template <typename Out>
+        usize widen_ascii_scalar(const code_unit* from, Out* to, usize count) noexcept
         {
-            Envy::debug_assert(is_continuation_unit(lead), "Invalid UTF-8, character missing code_units");
+            usize i {};
 
-            // append data to code unit
-            codepoint <<= bits_per_continuation_unit;
-            codepoint |= static_cast<u32>(*lead & c_mask);
+            for(; i < count && from[i] < 0x80u; ++i)
+            { to[i] = static_cast<Out>(from[i]); }
 
-            ++lead;
-            --units;
+            return i;
         }
 
-        return code_point {codepoint};
-    }
 
+        template <typename In>
+        usize narrow_ascii_scalar(const In* from, code_unit* to, usize count) noexcept
+        {
+            usize i {};
 
-    void encode(code_point cp, code_unit* ptr) noexcept(!Envy::debug)
-    {
-        Envy::debug_assert(ptr != nullptr, "Trying to encode to nullptr");
+            for(; i < count && from[i] < 0x80u; ++i)
+            { to[i] = static_cast<code_unit>(from[i]); }
 
-        const u32 codepoint {cp.get()};
+            return i;
+        }
 
-        const i32 continuation_units { code_units_required(cp) - 1 };
-        const i32 continuation_bits  { bits_per_continuation_unit * continuation_units };
 
-        // -- encode first code_unit
+        #if defined(ENVY_ARCH_X86)
 
-        switch(continuation_units)
+        template <typename Out>
+        ENVY_TARGET_SSE2 usize widen_ascii_sse2(const code_unit* from, Out* to, usize count) noexcept
         {
-            // ascii
-            case 0: *ptr = (code_unit) cp.get(); return;
+            const __m128i zero {_mm_setzero_si128()};
+
+            usize i {};
+
+            for(; count - i >= 16u; i += 16u)
+            {
+                const __m128i block {_mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i))};
+
+                if(_mm_movemask_epi8(block) != 0)
+                { break; }
+
+                const __m128i low  {_mm_unpacklo_epi8(block, zero)};
+                const __m128i high {_mm_unpackhi_epi8(block, zero)};
+
+                if constexpr (sizeof(Out) == 2u)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i), low);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i + 8u), high);
+                }
+                else
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i),       _mm_unpacklo_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i + 4u),  _mm_unpackhi_epi16(low, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i + 8u),  _mm_unpacklo_epi16(high, zero));
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i + 12u), _mm_unpackhi_epi16(high, zero));
+                }
+            }
+
+            return i + widen_ascii_scalar(from + i, to + i, count - i);
+        }
+
 
-            case 1: *ptr = f2_prefix | (static_cast<code_unit>(codepoint >> continuation_bits) & l2_mask); break;
-            case 2: *ptr = f3_prefix | (static_cast<code_unit>(codepoint >> continuation_bits) & l3_mask); break;
-            case 3: *ptr = f4_prefix | (static_cast<code_unit>(codepoint >> continuation_bits) & l4_mask); break;
+        template <typename Out>
+        ENVY_TARGET_AVX2 usize widen_ascii_avx2(const code_unit* from, Out* to, usize count) noexcept
+        {
+            usize i {};
+
+            for(; count - i >= 16u; i += 16u)
+            {
+                const __m128i block {_mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i))};
+
+                if(_mm_movemask_epi8(block) != 0)
+                { break; }
+
+                if constexpr (sizeof(Out) == 2u)
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(to + i), _mm256_cvtepu8_epi16(block));
+                }
+                else
+                {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(to + i),      _mm256_cvtepu8_epi32(block));
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(to + i + 8u), _mm256_cvtepu8_epi32(_mm_srli_si128(block, 8)));
+                }
+            }
+
+            return i + widen_ascii_scalar(from + i, to + i, count - i);
         }
 
-        // -- encode continuation units
 
-        for(i32 i {1}; i <= continuation_units; ++i)
+        // AVX2 packs within 128 bit lanes, so narrowing gains nothing over SSE2 and shares this kernel
+        template <typename In>
+        ENVY_TARGET_SSE2 usize narrow_ascii_sse2(const In* from, code_unit* to, usize count) noexcept
         {
-            ++ptr;
+            constexpr usize block_units {16u / sizeof(In)};
+
+            // any bits above the low seven mean the unit isn't ascii
+            const __m128i non_ascii_mask {sizeof(In) == 2u ? _mm_set1_epi16((short) 0xFF80) : _mm_set1_epi32((int) 0xFFFFFF80)};
+            const __m128i zero {_mm_setzero_si128()};
+
+            usize i {};
+
+            for(; count - i >= 16u; i += 16u)
+            {
+                __m128i blocks[16u / block_units];
+                __m128i any {zero};
 
-            // number of bits we need to shift to get to this code unit's data
-            i32 bits { bits_per_continuation_unit * (continuation_units - i) };
+                for(usize b {}; b < 16u / block_units; ++b)
+                {
+                    blocks[b] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i + b * block_units));
+                    any = _mm_or_si128(any, _mm_and_si128(blocks[b], non_ascii_mask));
+                }
 
-            *ptr = c_prefix | ( static_cast<code_unit>(codepoint >> bits) & c_mask );
+                if(_mm_movemask_epi8(_mm_cmpeq_epi8(any, zero)) != 0xFFFF)
+                { break; }
+
+                __m128i packed;
+
+                if constexpr (sizeof(In) == 2u)
+                {
+                    packed = _mm_packus_epi16(blocks[0], blocks[1]);
+                }
+                else
+                {
+                    // values are below 0x80 so signed saturation never kicks in
+                    packed = _mm_packus_epi16(_mm_packs_epi32(blocks[0], blocks[1]), _mm_packs_epi32(blocks[2], blocks[3]));
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i), packed);
+            }
+
+            return i + narrow_ascii_scalar(from + i, to + i, count - i);
         }
-    }
 
+        #endif
 
-    code_point next_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug)
-    {
-        code_point cp {decode(*lead_ptr)};
-        increment_ptr(lead_ptr);
-        return cp;
-    }
 
+        template <typename Out>
+        usize widen_ascii(const code_unit* from, Out* to, usize count, cpu::simd_level level) noexcept
+        {
+            #if defined(ENVY_ARCH_X86)
+            switch(level)
+            {
+                case cpu::simd_level::avx2: return widen_ascii_avx2(from, to, count);
+                case cpu::simd_level::sse2: return widen_ascii_sse2(from, to, count);
+                default: break;
+            }
+            #endif
+            return widen_ascii_scalar(from, to, count);
+        }
 
-    code_point prev_code_point(const code_unit** lead_ptr) noexcept(!Envy::debug)
-    {
-        code_point cp {decode(*lead_ptr)};
-        decrement_ptr(lead_ptr);
-        return cp;
-    }
 
+        template <typename In>
+        usize narrow_ascii(const In* from, code_unit* to, usize count, cpu::simd_level level) noexcept
+        {
+            #if defined(ENVY_ARCH_X86)
+            if(level >= cpu::simd_level::sse2)
+            { return narrow_ascii_sse2(from, to, count); }
+            #endif
+            return narrow_ascii_scalar(from, to, count);
+        }
 
-    bool is_valid_utf8(const code_unit* buffer) noexcept
-    {
-        if(*buffer == '\0')
-        { return true; }
 
-        if(!is_lead_unit(buffer))
-        { return false; }
+        // counts units >= 'lowest'
+        usize count_units_from(const code_unit* buffer, usize size, code_unit lowest) noexcept
+        {
+            usize count {};
+
+            for(usize i {}; i < size; ++i)
+            { count += buffer[i] >= lowest; }
 
-        while(*buffer != '\0')
+            return count;
+        }
+
+
+        template <typename Out>
+        usize utf8_decoded_length(std::span<const code_unit> from, error_policy policy) noexcept
         {
-            if(!is_valid_char(buffer))
-            { return false; }
+            // well-formed input, the common case, is sized without decoding
+            if(validate(from.data(), from.size()))
+            {
+                const usize code_points {static_cast<usize>(count_code_points(from.data(), from.size()))};
+
+                if constexpr (sizeof(Out) == 2u)
+                { return code_points + count_units_from(from.data(), from.size(), 0xF0u); } // four unit sequences need surrogate pairs
+                else
+                { return code_points; }
+            }
 
-            //increment buffer
-            i32 units { std::countl_one(*buffer) };
-            buffer += units + (units?0:1);
+            usize length {};
+
+            for(usize i {}; i < from.size();)
+            {
+                const sequence s {decode_sequence(from.data() + i, from.size() - i)};
+
+                if(!s.valid && policy == error_policy::error)
+                { break; }
+
+                length += (sizeof(Out) == 2u) ? utf16_units(s.cp) : 1u;
+                i += s.length;
+            }
+
+            return length;
         }
 
-        return true;
-    }
 
+        template <typename In, typename Decoder>
+        usize utf8_encoded_length(std::span<const In> from, error_policy policy, Decoder decoder) noexcept
+        {
+            usize length {};
+
+            for(usize i {}; i < from.size();)
+            {
+                if(from[i] < 0x80u)
+                {
+                    ++length;
+                    ++i;
+                    continue;
+                }
 
-    // ==== Envy::utf8::iterator ====
+                const sequence s {decoder(from, i)};
 
+                if(!s.valid && policy == error_policy::error)
+                { break; }
 
-    iterator::iterator() noexcept :
-        ptr {nullptr}
-    {}
+                length += static_cast<usize>(code_units_required(s.cp));
+                i += s.length;
+            }
 
-    iterator::iterator(const code_unit* p) noexcept :
-        ptr {p}
-    {}
+            return length;
+        }
 
 
-    iterator& iterator::operator++() noexcept(!Envy::debug)
-    {
-        increment_ptr(&ptr);
-        return *this;
-    }
+        template <typename Out>
+        transcode_result transcode_from_utf8(std::span<const code_unit> from, std::span<Out> to, error_policy policy) noexcept
+        {
+            const cpu::simd_level level {cpu::active_simd_level()};
+
+            usize i {};
+            usize o {};
+
+            while(i < from.size())
+            {
+                if(from[i] < 0x80u)
+                {
+                    const usize copied {widen_ascii(from.data() + i, to.data() + o, std::min(from.size() - i, to.size() - o), level)};
+
+                    if(copied == 0u)
+                    { return { i, o, transcode_status::output_too_small }; }
+
+                    i += copied;
+                    o += copied;
+                    continue;
+                }
+
+                const sequence s {decode_sequence(from.data() + i, from.size() - i)};
+
+                if(!s.valid && policy == error_policy::error)
+                { return { i, o, transcode_status::invalid_input }; }
+
+                if constexpr (sizeof(Out) == 2u)
+                {
+                    if(to.size() - o < utf16_units(s.cp))
+                    { return { i, o, transcode_status::output_too_small }; }
+
+                    if(s.cp > 0xFFFFu)
+                    {
+                        to[o++] = static_cast<Out>(0xD800u + ((s.cp - 0x10000u) >> 10));
+                        to[o++] = static_cast<Out>(0xDC00u + ((s.cp - 0x10000u) & 0x3FFu));
+                    }
+                    else
+                    { to[o++] = static_cast<Out>(s.cp); }
+                }
+                else
+                {
+                    if(o == to.size())
+                    { return { i, o, transcode_status::output_too_small }; }
+
+                    to[o++] = static_cast<Out>(s.cp);
+                }
+
+                i += s.length;
+            }
+
+            return { i, o, transcode_status::ok };
+        }
 
 
-    iterator iterator::operator++(int) noexcept(!Envy::debug)
-    {
-        iterator i {*this};
-        increment_ptr(&ptr);
-        return i;
+        template <typename In, typename Decoder>
+        transcode_result transcode_to_utf8(std::span<const In> from, std::span<code_unit> to, error_policy policy, Decoder decoder) noexcept
+        {
+            const cpu::simd_level level {cpu::active_simd_level()};
+
+            usize i {};
+            usize o {};
+
+            while(i < from.size())
+            {
+                if(from[i] < 0x80u)
+                {
+                    const usize copied {narrow_ascii(from.data() + i, to.data() + o, std::min(from.size() - i, to.size() - o), level)};
+
+                    if(copied == 0u)
+                    { return { i, o, transcode_status::output_too_small }; }
+
+                    i += copied;
+                    o += copied;
+                    continue;
+                }
+
+                const sequence s {decoder(from, i)};
+
+                if(!s.valid && policy == error_policy::error)
+                { return { i, o, transcode_status::invalid_input }; }
+
+                const usize units {static_cast<usize>(code_units_required(s.cp))};
+
+                if(to.size() - o < units)
+                { return { i, o, transcode_status::output_too_small }; }
+
+                encode(s.cp, to.data() + o);
+
+                i += s.length;
+                o += units;
+            }
+
+            return { i, o, transcode_status::ok };
+        }
     }
 
 
-    iterator& iterator::operator--() noexcept(!Envy::debug)
+    usize utf16_length(std::span<const code_unit> from, error_policy policy) noexcept
+    { return utf8_decoded_length<char16_t>(from, policy); }
+
+
+    usize utf32_length(std::span<const code_unit> from, error_policy policy) noexcept
+    { return utf8_decoded_length<char32_t>(from, policy); }
+
+
+    usize utf8_length(std::span<const char16_t> from, error_policy policy) noexcept
+    { return utf8_encoded_length(from, policy, decode_utf16); }
+
+
+    usize utf8_length(std::span<const char32_t> from, error_policy policy) noexcept
+    { return utf8_encoded_length(from, policy, decode_utf32); }
+
+
+    transcode_result transcode(std::span<const code_unit> from, std::span<char16_t> to, error_policy policy) noexcept
+    { return transcode_from_utf8(from, to, policy); }
+
+
+    transcode_result transcode(std::span<const code_unit> from, std::span<char32_t> to, error_policy policy) noexcept
+    { return transcode_from_utf8(from, to, policy); }
+
+
+    transcode_result transcode(std::span<const char16_t> from, std::span<code_unit> to, error_policy policy) noexcept
+    { return transcode_to_utf8(from, to, policy, decode_utf16); }
+
+
+    transcode_result transcode(std::span<const char32_t> from, std::span<code_unit> to, error_policy policy) noexcept
+    { return transcode_to_utf8(from, to, policy, decode_utf32); }
+
+
+    // ==== Envy::utf8::stream_decoder ====
+
+
+    namespace
     {
-        decrement_ptr(&ptr);
-        return *this;
+        // writes 'cp' to 'to' at 'o' and advances 'o', returns false if it doesn't fit
+        template <typename Out>
+        bool put_code_point(u32 cp, std::span<Out> to, usize& o) noexcept
+        {
+            if constexpr (sizeof(Out) == 4u)
+            {
+                if(o == to.size())
+                { return false; }
+
+                to[o++] = static_cast<Out>(cp);
+            }
+            else
+            {
+                const usize units {static_cast<usize>(code_units_required(cp))};
+
+                if(to.size() - o < units)
+                { return false; }
+
+                encode(cp, to.data() + o);
+                o += units;
+            }
+
+            return true;
+        }
+
+
+        // copies well-formed runs as a whole, ill-formed subparts are replaced or stop the copy
+        transcode_result copy_well_formed(std::span<const code_unit> from, std::span<code_unit> to, error_policy policy) noexcept
+        {
+            usize i {};
+            usize o {};
+
+            while(i < from.size())
+            {
+                const validation_result v {validate(from.data() + i, from.size() - i)};
+
+                usize run {std::min(v.error_offset, to.size() - o)};
+
+                // don't split a sequence when the output fills up
+                if(run < v.error_offset)
+                {
+                    while(run > 0u && is_continuation_unit(from.data() + i + run))
+                    { --run; }
+                }
+
+                std::memcpy(to.data() + o, from.data() + i, run);
+                i += run;
+                o += run;
+
+                if(run < v.error_offset)
+                { return { i, o, transcode_status::output_too_small }; }
+
+                if(v.valid)
+                { break; }
+
+                if(policy == error_policy::error)
+                { return { i, o, transcode_status::invalid_input }; }
+
+                if(!put_code_point(replacement_character, to, o))
+                { return { i, o, transcode_status::output_too_small }; }
+
+                i += decode_sequence(from.data() + i, from.size() - i).length;
+            }
+
+            return { i, o, transcode_status::ok };
+        }
     }
 
 
-    iterator iterator::operator--(int) noexcept(!Envy::debug)
+    stream_decoder::stream_decoder(error_policy policy) noexcept :
+        policy {policy}
+    {}
+
+
+    template <typename Out>
+    transcode_result stream_decoder::decode_into(const_buffer chunk, std::span<Out> to) noexcept
     {
-        iterator i {*this};
-        decrement_ptr(&ptr);
-        return i;
+        usize read {};
+        usize written {};
+
+        // -- complete the sequence carried over from the last chunk
+
+        if(pending_size != 0u)
+        {
+            const u8 carried {pending_size};
+
+            sequence s {decode_sequence(pending, pending_size)};
+
+            // still a prefix of a well-formed sequence
+            while(!s.valid && s.length == pending_size && read < chunk.size())
+            {
+                pending[pending_size++] = chunk[read++];
+                s = decode_sequence(pending, pending_size);
+            }
+
+            if(!s.valid && s.length == pending_size)
+            { return { read, 0u, transcode_status::ok }; }
+
+            if(!s.valid && policy == error_policy::error)
+            {
+                pending_size = carried;
+                return { 0u, 0u, transcode_status::invalid_input };
+            }
+
+            if(!put_code_point(s.cp, to, written))
+            {
+                pending_size = carried;
+                return { 0u, 0u, transcode_status::output_too_small };
+            }
+
+            // the maximal subpart of an ill-formed sequence includes every carried unit,
+            // units read past it are decoded again with the rest of the chunk
+            read = s.length - carried;
+            position_ += s.length;
+            pending_size = 0u;
+        }
+
+        // -- decode the chunk, holding back a sequence cut off by its end
+
+        const code_unit* data {chunk.data() + read};
+        const usize available {chunk.size() - read};
+
+        usize body {available};
+
+        for(usize back {1u}; back <= std::min<usize>(3u, available); ++back)
+        {
+            const code_unit* lead {data + available - back};
+
+            if(is_continuation_unit(lead))
+            { continue; }
+
+            const sequence s {decode_sequence(lead, back)};
+
+            if(!s.valid && s.length == back && sequence_lengths[*lead] > back)
+            { body = available - back; }
+
+            break;
+        }
+
+        transcode_result result;
+
+        if constexpr (sizeof(Out) == 4u)
+        { result = transcode_from_utf8(std::span{data, body}, to.subspan(written), policy); }
+        else
+        { result = copy_well_formed(std::span{data, body}, to.subspan(written), policy); }
+
+        read += result.read;
+        written += result.written;
+        position_ += result.read;
+
+        if(result.status != transcode_status::ok)
+        { return { read, written, result.status }; }
+
+        pending_size = static_cast<u8>(available - body);
+        std::copy(data + body, data + available, pending);
+        read += pending_size;
+
+        return { read, written, transcode_status::ok };
     }
 
 
-    iterator::value_type iterator::operator*() const noexcept(!Envy::debug)
+    template <typename Out>
+    transcode_result stream_decoder::finish_into(std::span<Out> to) noexcept
     {
-        return decode(ptr);
+        usize written {};
+
+        // a carried sequence is a prefix of a well-formed one, so a single maximal subpart
+        if(pending_size != 0u)
+        {
+            if(policy == error_policy::error)
+            { return { 0u, 0u, transcode_status::invalid_input }; }
+
+            if(!put_code_point(replacement_character, to, written))
+            { return { 0u, 0u, transcode_status::output_too_small }; }
+        }
+
+        reset();
+        return { 0u, written, transcode_status::ok };
     }
 
 
-    bool iterator::operator==(const iterator& other) const noexcept
+    transcode_result stream_decoder::decode(const_buffer chunk, std::span<char32_t> to) noexcept
+    { return decode_into(chunk, to); }
+
+
+    transcode_result stream_decoder::decode(const_buffer chunk, std::span<code_unit> to) noexcept
+    { return decode_into(chunk, to); }
+
+
+    transcode_result stream_decoder::finish(std::span<char32_t> to) noexcept
+    { return finish_into(to); }
+
+
+    transcode_result stream_decoder::finish(std::span<code_unit> to) noexcept
+    { return finish_into(to); }
+
+
+    void stream_decoder::reset() noexcept
     {
-        return ptr == other.ptr;
+        pending_size = 0u;
+        position_ = 0u;
     }
 
 
-    const code_unit* iterator_ptr(const iterator& i) noexcept
-    { return i.ptr; }
+    usize stream_decoder::position() const noexcept
+    { return position_; }
+
+
+    bool stream_decoder::has_pending() const noexcept
+    { return pending_size != 0u; }
 
 
-    usize iterator_distance_bytes(const iterator& i1, const iterator& i2) noexcept
+    // ==== sanitizing ====
+
+
+    usize sanitized_size(const_buffer from) noexcept
     {
-        return (usize) (i1.ptr - i2.ptr);
+        const code_unit* data {from.data()};
+        usize remaining {from.size()};
+        usize size {};
+
+        while(true)
+        {
+            const validation_result v {validate(data, remaining)};
+            size += v.error_offset;
+
+            if(v.valid)
+            { return size; }
+
+            const usize skipped {decode_sequence(data + v.error_offset, remaining - v.error_offset).length};
+            size += 3u; // U+FFFD
+            data += v.error_offset + skipped;
+            remaining -= v.error_offset + skipped;
+        }
     }
 
-}
\ No newline at end of file
+
+    transcode_result sanitize(const_buffer from, mutable_buffer to) noexcept
+    { return copy_well_formed(std::span{from.data(), from.size()}, std::span{to.data(), to.size()}, error_policy::replace); }
+
+}
@@ -0,0 +1,699 @@
+#include "benchmarks.hpp"
+
+#include <Envy/cpu.hpp>
+#include <Envy/log.hpp>
+#include <Envy/utf8.hpp>
+#include <Envy/unicode.hpp>
+#include <Envy/segmentation.hpp>
+#include <Envy/string_id.hpp>
+#include <Envy/string_builder.hpp>
+#include <Envy/text_buffer.hpp>
+#include <Envy/frame_arena.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+
+namespace
+{
+    Envy::logger bench_log {"Bench"};
+
+    // written to so the optimizer can't discard the work being measured
+    volatile usize sink {};
+
+    constexpr usize corpus_bytes {16u * 1024u * 1024u};
+
+    constexpr const char* simd_level_names[] {"scalar", "sse2", "avx2"};
+
+
+    struct corpus
+    {
+        std::string name;
+        std::vector<Envy::utf8::code_unit> text; ///< null-terminated, terminator not included in size()
+
+        [[nodiscard]] const Envy::utf8::code_unit* data() const noexcept { return text.data(); }
+        [[nodiscard]] usize size() const noexcept { return text.size() - 1u; }
+    };
+
+
+    // repeats whole copies of 'sample' to fill roughly 'bytes'
+    corpus make_corpus(std::string name, std::string_view sample, usize bytes)
+    {
+        corpus c {std::move(name), {}};
+        c.text.reserve(bytes + sample.size() + 1u);
+
+        while(c.text.size() < bytes)
+        { c.text.insert(c.text.end(), sample.begin(), sample.end()); }
+
+        c.text.push_back('\0');
+        return c;
+    }
+
+
+    const std::vector<corpus>& corpora()
+    {
+        static const std::vector<corpus> c
+        {
+            make_corpus("ascii", "The quick brown fox jumps over the lazy dog, then files a bug report. ", corpus_bytes),
+            make_corpus("latin", "Größenverhältnisse der Straßenbahn, café crème, señor, smørrebrød. ", corpus_bytes),
+            make_corpus("cjk",   "日本語のテキストを検証します。中文文本测试。한국어 텍스트 검사. ", corpus_bytes),
+            make_corpus("emoji", "😊🍔🍳🚀🎮👾🐉🌈 🇳🇴🏳️‍🌈 👩‍👩‍👧 ", corpus_bytes)
+        };
+        return c;
+    }
+
+
+    // runs 'f' 'runs' times and logs the mean throughput of processing 'bytes' per run
+    template <typename F>
+    void report_throughput(const std::string& name, usize bytes, F&& f, i32 runs = 10)
+    {
+        Envy::bench b {name};
+
+        for(i32 i {}; i < runs; ++i)
+        {
+            b.start();
+            sink = sink + static_cast<usize>(f());
+            b.record();
+        }
+
+        bench_log.info("{: <32} {:>8.2f} GB/s")(name, (f64) bytes / b.mean() / 1e9);
+    }
+
+
+    // runs 'f' 'runs' times and logs the mean rate of 'ops' operations per run
+    template <typename F>
+    void report_rate(const std::string& name, usize ops, F&& f, i32 runs = 10)
+    {
+        Envy::bench b {name};
+
+        for(i32 i {}; i < runs; ++i)
+        {
+            b.start();
+            sink = sink + static_cast<usize>(f());
+            b.record();
+        }
+
+        bench_log.info("{: <32} {:>8.2f} Mop/s")(name, (f64) ops / b.mean() / 1e6);
+    }
+
+
+    // runs 'f' once for each SIMD level the CPU supports, restores the detected level afterwards
+    template <typename F>
+    void for_each_simd_level(F&& f)
+    {
+        const auto detected {Envy::cpu::detected_simd_level()};
+
+        for(u8 level {}; level <= static_cast<u8>(detected); ++level)
+        {
+            Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+            f(simd_level_names[level]);
+        }
+
+        Envy::cpu::limit_simd_level(detected);
+    }
+
+
+    // -- implementations as they were before SIMD kernels, kept to compare against
+
+
+    bool legacy_is_valid_utf8(const Envy::utf8::code_unit* buffer)
+    {
+        if(*buffer == '\0')
+        { return true; }
+
+        if(!Envy::utf8::is_lead_unit(buffer))
+        { return false; }
+
+        while(*buffer != '\0')
+        {
+            if(!Envy::utf8::is_valid_char(buffer))
+            { return false; }
+
+            i32 units { std::countl_one(*buffer) };
+            buffer += units + (units?0:1);
+        }
+
+        return true;
+    }
+
+
+    i32 legacy_count_code_points(const Envy::utf8::code_unit* buffer, usize size_bytes)
+    {
+        i32 chars {};
+        const Envy::utf8::code_unit* end {buffer + size_bytes};
+
+        while(*buffer != '\0' && buffer < end)
+        {
+            Envy::utf8::increment_ptr(&buffer);
+            ++chars;
+        }
+        return chars;
+    }
+
+
+    u32 legacy_decode(const Envy::utf8::code_unit* lead)
+    {
+        i32 units { std::countl_one(*lead) };
+        units += (units?0:1);
+
+        u32 codepoint {};
+
+        switch(units)
+        {
+            case 1: return *lead;
+            case 2: codepoint = *lead & 0b00011111u; break;
+            case 3: codepoint = *lead & 0b00001111u; break;
+            case 4: codepoint = *lead & 0b00000111u; break;
+        }
+
+        for(i32 i {1}; i < units; ++i)
+        { codepoint = (codepoint << 6) | (lead[i] & 0b00111111u); }
+
+        return codepoint;
+    }
+
+
+    // operator+() before it built expressions, both operands copied and the result allocated
+    Envy::string legacy_concat(Envy::string left, Envy::string right)
+    {
+        Envy::string s { Envy::string::reserve_tag , left.size_bytes() + right.size_bytes() };
+        s += left;
+        s += right;
+        return s;
+    }
+
+
+    // sums every code point, decoding then advancing as the iterator used to
+    u32 legacy_decode_all(const Envy::utf8::code_unit* buffer, usize size_bytes)
+    {
+        u32 sum {};
+        const Envy::utf8::code_unit* end {buffer + size_bytes};
+
+        while(buffer < end)
+        {
+            sum += legacy_decode(buffer);
+            Envy::utf8::increment_ptr(&buffer);
+        }
+        return sum;
+    }
+}
+
+
+void utf8_validation_bench()
+{
+    for(const auto& c : corpora())
+    {
+        report_throughput("is_valid_utf8 " + c.name + " legacy", c.size(),
+            [&]{ return legacy_is_valid_utf8(c.data()); });
+
+        for_each_simd_level([&](const char* level)
+        {
+            report_throughput("is_valid_utf8 " + c.name + " " + level, c.size(),
+                [&]{ return Envy::utf8::is_valid_utf8(c.data(), c.size()); });
+        });
+    }
+}
+
+
+void utf8_sanitize_bench()
+{
+    for(const auto& c : corpora())
+    {
+        std::vector<Envy::utf8::code_unit> out (c.size());
+
+        report_throughput("sanitize " + c.name + " memcpy", c.size(),
+            [&]{ std::memcpy(out.data(), c.data(), c.size()); return out[0]; });
+
+        for_each_simd_level([&](const char* level)
+        {
+            report_throughput("sanitize " + c.name + " " + level, c.size(),
+                [&]{ return Envy::utf8::sanitize(Envy::const_buffer{c.data(), c.size()}, Envy::mutable_buffer{out.data(), out.size()}).written; });
+        });
+    }
+}
+
+
+
+void utf8_count_bench()
+{
+    for(const auto& c : corpora())
+    {
+        report_throughput("count_code_points " + c.name + " legacy", c.size(),
+            [&]{ return legacy_count_code_points(c.data(), c.size()); });
+
+        for_each_simd_level([&](const char* level)
+        {
+            report_throughput("count_code_points " + c.name + " " + level, c.size(),
+                [&]{ return Envy::utf8::count_code_points(c.data(), c.size()); });
+        });
+    }
+}
+
+void utf8_transcode_bench()
+{
+    for(const auto& c : corpora())
+    {
+        const std::span<const Envy::utf8::code_unit> units {c.data(), c.size()};
+
+        std::vector<char16_t> utf16 (Envy::utf8::utf16_length(units));
+        std::vector<char32_t> utf32 (Envy::utf8::utf32_length(units));
+
+        for_each_simd_level([&](const char* level)
+        {
+            report_throughput("transcode utf-16 " + c.name + " " + level, c.size(),
+                [&]{ return Envy::utf8::transcode(units, std::span{utf16}).written; });
+            report_throughput("transcode utf-32 " + c.name + " " + level, c.size(),
+                [&]{ return Envy::utf8::transcode(units, std::span{utf32}).written; });
+        });
+    }
+}
+
+
+void utf8_decode_bench()
+{
+    for(const auto& c : corpora())
+    {
+        report_throughput("decode " + c.name + " legacy", c.size(),
+            [&]{ return legacy_decode_all(c.data(), c.size()); });
+
+        report_throughput("decode " + c.name + " iterator", c.size(), [&]
+        {
+            u32 sum {};
+            const Envy::utf8::iterator end {c.data() + c.size()};
+            for(Envy::utf8::iterator i {c.data()}; i != end; ++i)
+            { sum += static_cast<u32>(*i); }
+            return sum;
+        });
+
+        report_throughput("decode " + c.name + " checked", c.size(), [&]
+        {
+            u32 sum {};
+            for(usize i {}; i < c.size();)
+            {
+                const auto result {Envy::utf8::decode_checked(c.data() + i, c.size() - i)};
+                sum += static_cast<u32>(result.cp);
+                i += static_cast<usize>(result.length);
+            }
+            return sum;
+        });
+    }
+}
+
+
+void string_search_bench()
+{
+    for(const auto& c : corpora())
+    {
+        const Envy::string text {Envy::string_view{c.data(), c.size()}};
+
+        // needles absent from every corpus, so each search scans the whole text
+        const Envy::string_view needle {"\u20AC#"};
+        const Envy::utf8::code_point euro {0x20ACu};
+
+        report_throughput("search " + c.name + " contains", c.size(),
+            [&]{ return text.contains(needle); });
+
+        report_throughput("search " + c.name + " contains_any", c.size(),
+            [&]{ return text.contains_any(needle); });
+
+        // the corpus repeats a short sample, so its first bytes hold every code point in it
+        const Envy::string_view alphabet {c.data(), 256u};
+
+        report_throughput("search " + c.name + " contains_only", c.size(),
+            [&]{ return text.contains_only(alphabet); });
+
+        report_throughput("search " + c.name + " ranges::search", c.size(),
+            [&]{ return std::ranges::search(text, needle).begin() == text.end(); });
+
+        report_throughput("search " + c.name + " ranges::count", c.size(),
+            [&]{ return std::ranges::count(text, euro); });
+
+        report_throughput("search " + c.name + " find", c.size(),
+            [&]{ return text.find(needle) == text.end(); });
+
+        report_throughput("search " + c.name + " find_last", c.size(),
+            [&]{ return text.find_last(needle) == text.end(); });
+
+        report_throughput("search " + c.name + " count", c.size(),
+            [&]{ return text.count(euro); });
+    }
+}
+
+
+void text_segmentation_bench()
+{
+    for(const auto& c : corpora())
+    {
+        const Envy::string_view text {c.data(), c.size()};
+
+        report_throughput("segment " + c.name + " graphemes", c.size(),
+            [&]{ return Envy::utf8::count_graphemes(text); });
+
+        report_throughput("segment " + c.name + " line breaks", c.size(), [&]
+        {
+            usize mandatory {};
+            for(const auto& opportunity : Envy::utf8::line_breaks(text))
+            { mandatory += opportunity.mandatory; }
+            return mandatory;
+        });
+    }
+}
+
+
+void case_insensitive_bench()
+{
+    for(const auto& c : corpora())
+    {
+        const Envy::string_view text {c.data(), c.size()};
+        const Envy::string folded {text.fold_case()};
+
+        // what callers did before, lowering both sides code point by code point
+        report_throughput("ignore case " + c.name + " lowered copies", c.size(), [&]
+        {
+            Envy::string left {Envy::string::reserve_tag, text.size_bytes()};
+            Envy::string right {Envy::string::reserve_tag, folded.size_bytes()};
+            for(const auto cp : text) { left += Envy::utf8::to_lower(cp); }
+            for(const auto cp : folded) { right += Envy::utf8::to_lower(cp); }
+            return left == right;
+        });
+
+        for_each_simd_level([&](const char* level)
+        {
+            report_throughput("ignore case " + c.name + " equal " + level, c.size(),
+                [&]{ return text.equals_ignore_case(folded); });
+            report_throughput("ignore case " + c.name + " fold_case " + level, c.size(),
+                [&]{ return text.fold_case().size_bytes(); });
+        });
+
+        report_throughput("ignore case " + c.name + " hash", c.size(),
+            [&]{ return text.hash_ignore_case(); });
+    }
+}
+
+
+void string_id_bench()
+{
+    // the names a log preamble looks up for every message
+    const Envy::string_view names[] {"func", "file", "line", "col", "datetime", "logger", "severity"};
+    constexpr usize lookups {1'000'000u};
+
+    std::unordered_map<Envy::string, i32> by_string;
+    std::unordered_map<Envy::string_id, i32> by_id;
+
+    for(i32 i {}; const auto name : names)
+    {
+        by_string.emplace(Envy::string{name}, i);
+        by_id.emplace(Envy::string_id{name}, i++);
+    }
+
+    // what macro_map did before, build a key string then hash and compare it
+    report_rate("string_id lookup Envy::string", lookups, [&]
+    {
+        usize sum {};
+        for(usize i {}; i < lookups; ++i)
+        { sum += by_string.find(Envy::string{names[i % std::size(names)]})->second; }
+        return sum;
+    });
+
+    report_rate("string_id lookup find()", lookups, [&]
+    {
+        usize sum {};
+        for(usize i {}; i < lookups; ++i)
+        { sum += by_id.find(*Envy::string_id::find(names[i % std::size(names)]))->second; }
+        return sum;
+    });
+
+    const Envy::string_id ids[] {"func"_id, "file"_id, "line"_id, "col"_id, "datetime"_id, "logger"_id, "severity"_id};
+
+    report_rate("string_id lookup interned", lookups, [&]
+    {
+        usize sum {};
+        for(usize i {}; i < lookups; ++i)
+        { sum += by_id.find(ids[i % std::size(ids)])->second; }
+        return sum;
+    });
+}
+
+
+void string_builder_bench()
+{
+    // the pieces of a typical log line: colors, column text and the message
+    const Envy::string columns[] {"main", "engine.cpp", "142", "12:04:31", "Engine", "info"};
+    const Envy::string message {"Window created, 1280x720, vsync on"};
+    const Envy::string color {"\x1b[90m"};
+    constexpr usize lines {200'000u};
+
+    // how the log formatter joined a line before, appending temporaries
+    report_rate("string_builder += temporaries", lines, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < lines; ++i)
+        {
+            Envy::string line;
+            for(const auto& column : columns)
+            {
+                line += legacy_concat(color, "| ");
+                line += legacy_concat(color, column);
+                line += legacy_concat(color, " ");
+            }
+            line += legacy_concat(legacy_concat(legacy_concat(color, "| : "), message), "\n");
+            bytes += line.size_bytes();
+        }
+        return bytes;
+    });
+
+    // the same appends, operator+() now builds expressions that are written in place
+    report_rate("string_builder += operator+", lines, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < lines; ++i)
+        {
+            Envy::string line;
+            for(const auto& column : columns)
+            {
+                line += color + "| ";
+                line += color + column;
+                line += color + " ";
+            }
+            line += color + "| : " + message + "\n";
+            bytes += line.size_bytes();
+        }
+        return bytes;
+    });
+
+    // one expression per column, each written into the line without temporaries
+    report_rate("string_builder += operator+ chain", lines, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < lines; ++i)
+        {
+            Envy::string line;
+            for(const auto& column : columns)
+            { line += color + "| " + color + column + ' '; }
+            line += color + "| : " + message + '\n';
+            bytes += line.size_bytes();
+        }
+        return bytes;
+    });
+
+    report_rate("string_builder", lines, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < lines; ++i)
+        {
+            Envy::string_builder b;
+            for(const auto& column : columns)
+            { b.append(color).append("| ").append(color).append(column).append(color).append(' '); }
+            b.append(color).append("| : ").append(message).append('\n');
+            bytes += b.str().size_bytes();
+        }
+        return bytes;
+    });
+}
+
+
+void format_bench()
+{
+    // a log message and its arguments, the format string is only known at run time
+    const Envy::string fmt {"File not found '{}', tried {} locations in {:.2f} ms"};
+    const Envy::string path {"assets/textures/grass.png"};
+    const f64 elapsed {1.25};
+    constexpr usize messages {200'000u};
+
+    // how log::message formatted before, into a std::string copied to the message
+    report_rate("std::format, copied", messages, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < messages; ++i)
+        {
+            const std::string_view path_view {path};
+            const usize tried {i & 7u};
+
+            Envy::string msg {fmt};
+            msg = std::vformat(std::string_view {msg}, std::make_format_args(path_view, tried, elapsed));
+            bytes += msg.size_bytes();
+        }
+        return bytes;
+    });
+
+    report_rate("Envy::format_to", messages, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < messages; ++i)
+        {
+            Envy::string msg {Envy::string::reserve_tag, fmt.size_bytes()};
+            Envy::format_to(msg, fmt, path, i & 7u, elapsed);
+            bytes += msg.size_bytes();
+        }
+        return bytes;
+    });
+}
+
+
+void parse_bench()
+{
+    // a data file of whitespace separated floats
+    const corpus data {make_corpus("floats", "12.5 -3.25 1e3 0.001 42\n", 1024u * 1024u)};
+    const Envy::string_view text {data.data(), data.size()};
+    std::vector<f32> values(data.size() / 2u);
+
+    // how numbers were read before, through a std::string and a stream
+    report_throughput("istringstream", data.size(), [&]
+    {
+        std::istringstream stream {std::string {std::string_view {text}}};
+        usize count {};
+
+        for(f32 v {}; stream >> v; ++count)
+        { values[count] = v; }
+
+        return count;
+    });
+
+    report_throughput("parse_list", data.size(), [&]
+    {
+        return text.parse_list<f32>(values).value;
+    });
+}
+
+
+void to_chars_bench()
+{
+    // the arguments of a typical log line
+    const f64 elapsed {16.6667};
+    constexpr usize lines {200'000u};
+
+    // how arguments were converted before, through a std::string each
+    report_rate("Envy::to_string", lines, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < lines; ++i)
+        {
+            Envy::string line;
+            line += Envy::string_view {Envy::to_string(i)};
+            line += Envy::string_view {Envy::to_string(elapsed)};
+            line += Envy::string_view {Envy::to_string(i % 2u == 0u)};
+            bytes += line.size_bytes();
+        }
+        return bytes;
+    });
+
+    report_rate("Envy::append_chars", lines, [&]
+    {
+        usize bytes {};
+        for(usize i {}; i < lines; ++i)
+        {
+            Envy::string line;
+            Envy::append_chars(line, i);
+            Envy::append_chars(line, elapsed);
+            Envy::append_chars(line, i % 2u == 0u);
+            bytes += line.size_bytes();
+        }
+        return bytes;
+    });
+}
+
+
+void text_buffer_bench()
+{
+    // typing into the middle of a long console history
+    const corpus& history {corpora()[1]};
+    const Envy::string_view text {history.data(), 256u * 1024u};
+    const Envy::string_view typed {"smørrebrød "};
+    constexpr usize keystrokes {2'000u};
+
+    report_rate("Envy::string insert", keystrokes, [&]
+    {
+        Envy::string edited {text};
+        auto cursor {std::ranges::next(edited.begin(), 1000)};
+
+        for(usize i {}; i < keystrokes; ++i)
+        {
+            const auto key {std::ranges::next(typed.begin(), static_cast<std::ptrdiff_t>(i % typed.size()))};
+            cursor = std::ranges::next(edited.insert(cursor, key, 1u));
+        }
+        return edited.size_bytes();
+    }, 3);
+
+    report_rate("Envy::text_buffer insert", keystrokes, [&]
+    {
+        Envy::text_buffer edited {text};
+        usize cursor {edited.offset_of(1000u)};
+
+        for(usize i {}; i < keystrokes; ++i)
+        {
+            const auto key {*std::ranges::next(typed.begin(), static_cast<std::ptrdiff_t>(i % typed.size()))};
+            cursor = edited.insert(cursor, key);
+        }
+        return edited.size_bytes();
+    }, 3);
+}
+
+
+void frame_arena_bench()
+{
+    // short lived strings, like the log lines and macro expansions of a frame
+    const Envy::string message {"Window created, 1280x720, vsync on, adapter: integrated"};
+    constexpr usize frames {1'000u};
+    constexpr usize strings_per_frame {200u};
+
+    report_rate("default resource", frames * strings_per_frame, [&]
+    {
+        usize bytes {};
+        for(usize f {}; f < frames; ++f)
+        {
+            for(usize i {}; i < strings_per_frame; ++i)
+            {
+                Envy::string line {message};
+                line += message;
+                bytes += line.size_bytes();
+            }
+        }
+        return bytes;
+    });
+
+    Envy::frame_arena arena {64u * 1024u};
+
+    report_rate("frame_arena", frames * strings_per_frame, [&]
+    {
+        usize bytes {};
+        for(usize f {}; f < frames; ++f)
+        {
+            arena.reset();
+            for(usize i {}; i < strings_per_frame; ++i)
+            {
+                Envy::string line {message, &arena};
+                line += message;
+                bytes += line.size_bytes();
+            }
+        }
+        return bytes;
+    });
+
+    bench_log.info("frame_arena peak {} bytes, {} overflows")(arena.stats().peak, arena.stats().overflows);
+}
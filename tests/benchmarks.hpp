@@ -0,0 +1,19 @@
+#pragma once
+
+#include <Envy/bench.hpp>
+
+void utf8_validation_bench();
+void utf8_sanitize_bench();
+void utf8_count_bench();
+void utf8_transcode_bench();
+void utf8_decode_bench();
+void string_search_bench();
+void text_segmentation_bench();
+void case_insensitive_bench();
+void string_id_bench();
+void string_builder_bench();
+void format_bench();
+void parse_bench();
+void to_chars_bench();
+void text_buffer_bench();
+void frame_arena_bench();
@@ -15,9 +15,11 @@
 #include <iostream>
 
 #include "tests.hpp"
+#include "benchmarks.hpp"
 
 
 void run_tests();
+void run_benchmarks();
 
 
 int main(int argc, char** argv)
@@ -34,6 +36,9 @@ int main(int argc, char** argv)
 
     run_tests();
 
+    if(argc > 1 && std::string_view(argv[1]) == "--bench")
+    { run_benchmarks(); }
+
     Envy::engine::run(engdesc, argc, argv);
 
     return 0;
@@ -65,5 +70,29 @@ void run_tests()
 
     tests.report();
 
+    Envy::log::global.print_header();
+}
+
+
+void run_benchmarks()
+{
+    Envy::log::global.print_header(" Benchmarks ");
+
+    utf8_validation_bench();
+    utf8_sanitize_bench();
+    utf8_count_bench();
+    utf8_transcode_bench();
+    utf8_decode_bench();
+    string_search_bench();
+    text_segmentation_bench();
+    case_insensitive_bench();
+    string_id_bench();
+    string_builder_bench();
+    format_bench();
+    parse_bench();
+    to_chars_bench();
+    text_buffer_bench();
+    frame_arena_bench();
+
     Envy::log::global.print_header();
 }
\ No newline at end of file
@@ -2,8 +2,24 @@
 
 #include <Envy/string.hpp>
 #include <Envy/macro.hpp>
+#include <Envy/string_id.hpp>
+#include <Envy/string_builder.hpp>
+#include <Envy/shared_string.hpp>
+#include <Envy/text_buffer.hpp>
+#include <Envy/frame_arena.hpp>
 #include <Envy/utf8.hpp>
+#include <Envy/code_point_set.hpp>
+#include <Envy/unicode.hpp>
+#include <Envy/segmentation.hpp>
+#include <Envy/cpu.hpp>
+#include <Envy/vector.hpp>
+#include <algorithm>
 #include <ranges>
+#include <vector>
+#include <unordered_map>
+#include <memory_resource>
+#include <array>
+#include <thread>
 
 
 void utf8_test(Envy::test_state& tests)
@@ -28,6 +44,41 @@ void utf8_test(Envy::test_state& tests)
 
     tests.add_case(decode);
 
+    // -- the core is constexpr, literals can be checked at compile time
+
+    static_assert(Envy::utf8::is_valid_utf8("größe 中文 😁") && !Envy::utf8::is_valid_utf8("\xC0\xAF"));
+    static_assert(Envy::utf8::count_code_points("größe") == 5);
+    static_assert(Envy::utf8::code_point{"€"} == Envy::utf8::code_point{0x20ACu});
+
+    static_assert([]
+    {
+        const cu units[] {'a', 0xC3, 0xA4, 0xF0, 0x9F, 0x98, 0x81};
+        cu encoded[4] {};
+        Envy::utf8::encode(0x1F601u, encoded);
+
+        u32 sum {};
+        for(Envy::utf8::iterator i {units}; i != Envy::utf8::iterator {units + 7}; ++i)
+        { sum += static_cast<u32>(*i); }
+
+        return sum == 'a' + 0xE4u + 0x1F601u && Envy::utf8::decode(encoded) == 0x1F601u;
+    }(), "constexpr iteration and encoding");
+
+    Envy::test_case decode_checked {"Envy::utf8::decode_checked"};
+
+    const auto checked = [](std::string_view units) { return Envy::utf8::decode_checked((const cu*) units.data(), units.size()); };
+
+    decode_checked.require( checked("a").cp == 97u && checked("a").length == 1,              "'a'" );
+    decode_checked.require( checked("€").cp == 0x20ACu && checked("€").length == 3,           "'€'" );
+    decode_checked.require( checked("😊").cp == 0x1F60Au && checked("😊").length == 4,        "'😊'" );
+    decode_checked.require( !checked("\xC0\x80") && checked("\xC0\x80").length == 1,          "overlong" );
+    decode_checked.require( !checked("\xED\xA0\x80") && checked("\xED\xA0\x80").length == 1,  "surrogate" );
+    decode_checked.require( !checked("\xF0\x9F\x98") && checked("\xF0\x9F\x98").length == 3,  "truncated" );
+    decode_checked.require( !checked("\xE2\x82x") && checked("\xE2\x82x").length == 2,        "interrupted" );
+    decode_checked.require( checked("\xE2\x82x").cp == 0xFFFDu,                               "replacement" );
+    decode_checked.require( !checked("") && checked("").length == 0,                          "empty" );
+
+    tests.add_case(decode_checked);
+
     const u8* buffer_valid { (cu*)"€ello utf8 😊🍔🍳" };
 
     const u8 buffer_invalid[] { 'a' , 0b11100000u , 0b10000000u , 0b11000010u , 'x' , '\0' };
@@ -35,6 +86,248 @@ void utf8_test(Envy::test_state& tests)
     tests.add_case(Envy::utf8::is_valid_utf8(buffer_valid) && !Envy::utf8::is_valid_utf8(buffer_invalid), "Envy::utf8::is_valid_utf8");
     tests.add_case(Envy::utf8::count_code_points(buffer_valid) == 14, "Envy::utf8::count_characters(buffer_valid)");
 
+    // -- validation, every case is run through each SIMD kernel the cpu supports
+
+    struct validation_case
+    {
+        std::string_view text;
+        usize error_offset;
+    };
+
+    const validation_case validation_cases[]
+    {
+        { "valid € 😊 ¢ 한"            , std::string_view::npos },
+        { std::string_view("a\0b", 3) , std::string_view::npos },
+        { "\xC0\x80"                   , 0u }, // overlong
+        { "ab\xE0\x80\x80"            , 2u }, // overlong
+        { "\xF0\x8F\xBF\xBF"         , 0u }, // overlong
+        { "x\xED\xA0\x80"             , 1u }, // surrogate
+        { "\xF4\x90\x80\x80"         , 0u }, // > U+10FFFF
+        { "\xF8\x88\x80\x80\x80"    , 0u }, // five unit lead
+        { "abc\x80"                    , 3u }, // stray continuation
+        { "€\xE2\x82"                 , 3u }, // truncated
+        { "😊\xF0\x9F\x98x"          , 4u }  // truncated
+    };
+
+    Envy::test_case validate {"Envy::utf8::validate"};
+
+    const auto detected_level {Envy::cpu::detected_simd_level()};
+
+    for(u8 level {}; level <= static_cast<u8>(detected_level); ++level)
+    {
+        Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+
+        for(const auto& c : validation_cases)
+        {
+            // pad so the error lands in the middle of the vector kernels' blocks
+            const std::string padding (45u, '.');
+            const std::string text {padding + std::string(c.text)};
+
+            const auto result {Envy::utf8::validate((cu*) text.data(), text.size())};
+            const usize expected {c.error_offset == std::string_view::npos ? text.size() : padding.size() + c.error_offset};
+
+            validate.require(result.error_offset == expected && result.valid == (expected == text.size()),
+                "level {} : expected error at {}, got {}"_f(level, expected, result.error_offset));
+
+            const bool ascii_prefix {std::all_of(text.begin(), text.begin() + expected, [](char u) { return (u8) u < 0x80u; })};
+            validate.require(result.ascii == ascii_prefix, "level {} : ascii before offset {}"_f(level, expected));
+        }
+    }
+
+    Envy::test_case count {"Envy::utf8::count_code_points"};
+
+    // 600 code points in 1200 bytes, with embedded nulls which must be counted too
+    std::string counted;
+    for(i32 i {}; i < 100; ++i)
+    { counted += "a¢€😊 "; counted.push_back('\0'); }
+
+    for(u8 level {}; level <= static_cast<u8>(detected_level); ++level)
+    {
+        Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+
+        const i32 n {Envy::utf8::count_code_points((cu*) counted.data(), counted.size())};
+        count.require(n == 600, "level {} : {} == 600"_f(level, n));
+    }
+
+    Envy::test_case ascii {"Envy::utf8::is_ascii"};
+
+    // the wide unit lands after the first vector block
+    std::string ascii_text (70u, 'a');
+
+    for(u8 level {}; level <= static_cast<u8>(detected_level); ++level)
+    {
+        Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+
+        ascii_text[40] = 'a';
+        const bool all_ascii {Envy::utf8::is_ascii((cu*) ascii_text.data(), ascii_text.size())};
+        ascii_text[40] = '\xC2';
+        const bool not_ascii {!Envy::utf8::is_ascii((cu*) ascii_text.data(), ascii_text.size())};
+
+        ascii.require(all_ascii && not_ascii, "level {}"_f(level));
+    }
+
+    Envy::test_case set {"Envy::utf8::code_point_set"};
+
+    Envy::utf8::code_point_set identifier {Envy::utf8::code_point{'a'}, Envy::utf8::code_point{'z'}};
+    identifier.insert(Envy::utf8::code_point{'_'}).insert(Envy::string_view{"Ωπ"});
+
+    set.require(identifier.size() == 29u && identifier.contains(Envy::utf8::code_point{0x3A9u}) && !identifier.contains(Envy::utf8::code_point{'A'}), "membership");
+
+    // the first non-member lands after the first vector block, the first member after a wide sequence
+    const std::string ident_text {std::string(40u, 'x') + "_Ωπ €!"};
+    const std::string wide_text {std::string(40u, ' ') + "€ π"};
+
+    for(u8 level {}; level <= static_cast<u8>(detected_level); ++level)
+    {
+        Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+
+        const auto* not_of {identifier.find_first_not_of((cu*) ident_text.data(), ident_text.size())};
+        const auto* of {identifier.find_first_of((cu*) wide_text.data(), wide_text.size())};
+
+        set.require(not_of == (cu*) ident_text.data() + 45 && of == (cu*) wide_text.data() + 44, "level {}"_f(level));
+    }
+
+    Envy::test_case search {"Envy::utf8::find_sequence"};
+
+    // matches straddle the 16 and 32 unit vector blocks, the 64 unit mark and the scalar tail
+    std::string haystack (100u, '.');
+    for(const usize at : {14u, 30u, 62u, 97u})
+    { haystack.replace(at, 3u, "abc"); }
+
+    const auto* const hay {(const cu*) haystack.data()};
+    const auto* const needle {(const cu*) "abc"};
+
+    for(u8 level {}; level <= static_cast<u8>(detected_level); ++level)
+    {
+        Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+
+        const auto* first {Envy::utf8::find_sequence(hay, haystack.size(), needle, 3u)};
+        const auto* second {Envy::utf8::find_sequence(hay + 15, haystack.size() - 15u, needle, 3u)};
+        search.require(first == hay + 14 && second == hay + 30, "level {} : find"_f(level));
+
+        const auto* last {Envy::utf8::find_last_sequence(hay, haystack.size(), needle, 3u)};
+        const auto* before_tail {Envy::utf8::find_last_sequence(hay, 99u, needle, 3u)};
+        search.require(last == hay + 97 && before_tail == hay + 62, "level {} : find_last"_f(level));
+
+        search.require(Envy::utf8::count_sequence(hay, haystack.size(), needle, 3u) == 4u
+            && Envy::utf8::count_sequence(hay, haystack.size(), needle + 1, 1u) == 4u
+            && Envy::utf8::count_sequence(hay, haystack.size(), (const cu*) "abd", 3u) == 0u, "level {} : count"_f(level));
+    }
+
+    // -- transcoding
+
+    Envy::test_case transcode {"Envy::utf8::transcode"};
+
+    // long ascii runs between multi-unit code points exercise the vector fast paths
+    std::string mixed;
+    for(i32 i {}; i < 20; ++i)
+    { mixed += "ascii text long enough for a vector block ¢€😊"; }
+
+    const std::span<const cu> mixed_units {(const cu*) mixed.data(), mixed.size()};
+
+    for(u8 level {}; level <= static_cast<u8>(detected_level); ++level)
+    {
+        Envy::cpu::limit_simd_level(static_cast<Envy::cpu::simd_level>(level));
+
+        std::vector<char16_t> utf16 (Envy::utf8::utf16_length(mixed_units));
+        std::vector<char32_t> utf32 (Envy::utf8::utf32_length(mixed_units));
+
+        const auto to16 {Envy::utf8::transcode(mixed_units, std::span{utf16})};
+        const auto to32 {Envy::utf8::transcode(mixed_units, std::span{utf32})};
+
+        transcode.require(to16 && to16.written == utf16.size() && utf16.size() == 20u * 46u, "level {} : utf-8 -> utf-16"_f(level));
+        transcode.require(to32 && to32.written == utf32.size() && utf32.size() == 20u * 45u, "level {} : utf-8 -> utf-32"_f(level));
+        transcode.require(utf32[43] == 0x20ACu && utf32[44] == 0x1F60Au, "level {} : utf-32 code points"_f(level));
+
+        std::vector<cu> from16 (Envy::utf8::utf8_length(std::span<const char16_t>{utf16}));
+        std::vector<cu> from32 (Envy::utf8::utf8_length(std::span<const char32_t>{utf32}));
+
+        const auto back16 {Envy::utf8::transcode(std::span<const char16_t>{utf16}, std::span{from16})};
+        const auto back32 {Envy::utf8::transcode(std::span<const char32_t>{utf32}, std::span{from32})};
+
+        transcode.require(back16 && std::ranges::equal(from16, mixed_units), "level {} : utf-16 round trip"_f(level));
+        transcode.require(back32 && std::ranges::equal(from32, mixed_units), "level {} : utf-32 round trip"_f(level));
+    }
+
+    Envy::cpu::limit_simd_level(detected_level);
+
+    // each maximal subpart of an ill-formed sequence becomes one U+FFFD
+    const cu ill_formed[] { 'a', 0xF0u, 0x9Fu, 0x98u, 'b', 0xC0u, 0x80u, 0xEDu, 0xA0u, 'c' };
+    const char32_t replaced[] { U'a', 0xFFFDu, U'b', 0xFFFDu, 0xFFFDu, 0xFFFDu, 0xFFFDu, U'c' };
+
+    std::vector<char32_t> repaired (Envy::utf8::utf32_length(ill_formed));
+    const auto repair {Envy::utf8::transcode(std::span<const cu>{ill_formed}, std::span{repaired})};
+
+    transcode.require(repair && std::ranges::equal(repaired, replaced), "error_policy::replace");
+
+    const auto rejected {Envy::utf8::transcode(std::span<const cu>{ill_formed}, std::span{repaired}, Envy::utf8::error_policy::error)};
+    transcode.require(rejected.status == Envy::utf8::transcode_status::invalid_input && rejected.read == 1u && rejected.written == 1u, "error_policy::error");
+
+    char16_t too_small[2];
+    const auto truncated {Envy::utf8::transcode(std::span<const cu>{(const cu*) "a😊", 5u}, std::span{too_small})};
+    transcode.require(truncated.status == Envy::utf8::transcode_status::output_too_small && truncated.read == 1u && truncated.written == 1u, "output_too_small");
+
+    // -- streaming, feed one code unit at a time so every sequence is split across chunks
+
+    Envy::test_case stream {"Envy::utf8::stream_decoder"};
+
+    const std::string_view streamed {"a€😊\xE2\x82x\xF0\x9F"};
+    const char32_t stream_expected[] { U'a', 0x20ACu, 0x1F60Au, 0xFFFDu, U'x', 0xFFFDu };
+
+    Envy::utf8::stream_decoder decoder;
+    std::vector<char32_t> decoded;
+
+    for(const char unit : streamed)
+    {
+        char32_t out[2];
+        const auto result {decoder.decode(Envy::const_buffer{&unit, 1u}, std::span{out})};
+        stream.require(result && result.read == 1u, "each chunk is read completely");
+        decoded.insert(decoded.end(), out, out + result.written);
+    }
+
+    stream.require(decoder.has_pending(), "truncated sequence carried");
+
+    char32_t flushed[1];
+    decoded.insert(decoded.end(), flushed, flushed + decoder.finish(std::span{flushed}).written);
+
+    stream.require(std::ranges::equal(decoded, stream_expected) && !decoder.has_pending(), "replacement across chunks");
+
+    Envy::utf8::stream_decoder strict {Envy::utf8::error_policy::error};
+    cu copied[16];
+
+    const auto first_half {strict.decode(Envy::const_buffer{streamed.data(), 5u}, std::span{copied})};
+    stream.require(first_half && first_half.written == 4u && strict.has_pending(), "split sequence held back");
+
+    const auto second_half {strict.decode(Envy::const_buffer{streamed.data() + 5u, streamed.size() - 5u}, std::span{copied})};
+    stream.require(second_half.status == Envy::utf8::transcode_status::invalid_input && strict.position() == 8u, "error position");
+
+    // -- sanitizing, each maximal ill-formed subpart becomes one U+FFFD
+
+    Envy::test_case sanitize {"Envy::utf8::sanitize"};
+
+    const std::string_view dirty {"ok\xC0\xAF \xE2\x82x \xF0\x9F\x98 \xED\xA0\x80 \xFF\xE2\x82\xAC"};
+    const std::string_view clean {"ok\uFFFD\uFFFD \uFFFDx \uFFFD \uFFFD\uFFFD\uFFFD \uFFFD\u20AC"};
+
+    const Envy::string sanitized {Envy::utf8::sanitize(Envy::const_buffer{dirty.data(), dirty.size()})};
+    sanitize.require(std::string_view{sanitized} == clean, "replacement of maximal subparts");
+    sanitize.require(Envy::utf8::sanitized_size(Envy::const_buffer{dirty.data(), dirty.size()}) == clean.size(), "sanitized_size()");
+    sanitize.require(Envy::utf8::sanitize(Envy::const_buffer{"tidy", 4u}) == "tidy", "valid input is copied");
+    sanitize.require(Envy::utf8::sanitize(Envy::const_buffer{"tidy", 4u}).is_ascii() && !Envy::utf8::sanitize(Envy::const_buffer{"€", 3u}).is_ascii(),
+        "valid input keeps the ascii flag from validation");
+
+    cu sanitize_out[8];
+    const auto partial {Envy::utf8::sanitize(Envy::const_buffer{dirty.data(), dirty.size()}, Envy::mutable_buffer{sanitize_out, 4u})};
+    sanitize.require(partial.status == Envy::utf8::transcode_status::output_too_small && partial.read == 2u && partial.written == 2u, "replacement not split");
+
+    tests.add_case(validate);
+    tests.add_case(count);
+    tests.add_case(ascii);
+    tests.add_case(set);
+    tests.add_case(search);
+    tests.add_case(transcode);
+    tests.add_case(stream);
+    tests.add_case(sanitize);
+
     Envy::utf8::increment_ptr(&buffer_valid);
     Envy::utf8::increment_ptr(&buffer_valid);
 
@@ -61,6 +354,11 @@ void utf8_test(Envy::test_state& tests)
         ++index;
     }
 
+    // the cached code point must not survive moving the iterator
+    auto cached {begin};
+    itercase.require(*cached == 46u && *++cached == 0x10348u && *--cached == 46u, "cached code point");
+    itercase.require(*(cached++) == 46u && *cached == 0x10348u, "post increment after dereference");
+
     tests.add_case(itercase);
 
     tests.submit();
@@ -120,6 +418,297 @@ void string_test(Envy::test_state& tests)
 
     tests.add_case(search);
 
+    // -- access by code point index, long enough to span several offset index samples
+
+    Envy::test_case indexed {"Envy::string::at()"};
+
+    Envy::string long_str;
+    for(i32 i {}; i < 50; ++i)
+    { long_str += "ab€😊"; }
+
+    indexed.require(long_str.at(0) == 'a' && long_str.at(2) == 0x20ACu && long_str.at(199) == 0x1F60Au, "at()");
+    indexed.require(long_str.at(130) == 0x20ACu && long_str.iterator_at(200) == long_str.end(), "iterator_at()");
+
+    long_str += "tail";
+
+    indexed.require(long_str.size() == 204u && long_str.at(203) == 'l', "at() after append");
+    indexed.require(long_str.view(198, 202) == "€😊ta" && long_str.substr(200) == "tail", "view() and substr()");
+
+    tests.add_case(indexed);
+
+    Envy::test_case ascii {"Envy::string::is_ascii()"};
+
+    Envy::string identifier {"log_preamble"};
+
+    ascii.require(identifier.is_ascii() && identifier.size() == 12u && identifier.at(4) == 'p', "ascii string");
+    ascii.require(identifier.contains('_') && identifier.contains(Envy::string_view{"pre"}) && !identifier.contains(0x20ACu), "ascii search");
+
+    identifier += "€";
+
+    ascii.require(!identifier.is_ascii() && identifier.size() == 13u && identifier.at(12) == 0x20ACu, "append clears");
+    ascii.require(identifier.contains(0x20ACu) && !Envy::string_view{identifier}.is_ascii(), "non-ascii search");
+
+    identifier.clear();
+    ascii.require(identifier.is_ascii(), "clear");
+
+    tests.add_case(ascii);
+
+    Envy::test_case small {"small string optimization"};
+
+    Envy::string growing {"short"};
+    small.require(growing.capacity() == Envy::string::local_capacity, "short strings are inline");
+
+    Envy::string moved {std::move(growing)};
+    small.require(moved == "short" && growing.empty() && growing.c_str()[0] == '\0', "move from inline");
+
+    moved += " string, now long enough for the heap";
+    small.require(moved.capacity() > Envy::string::local_capacity && moved.size() == 42u, "append spills to the heap");
+
+    Envy::string copied {moved};
+    growing = std::move(moved);
+    small.require(growing == copied && moved.empty() && moved.capacity() == Envy::string::local_capacity, "move from heap");
+
+    copied = Envy::string{"ö"};
+    small.require(copied == "ö" && copied.size() == 1u && !copied.is_ascii(), "assign inline over heap");
+
+    tests.add_case(small);
+
+    Envy::test_case pmr {"memory resource"};
+
+    std::array<std::byte, 512> scratch;
+    std::pmr::monotonic_buffer_resource arena {scratch.data(), scratch.size()};
+
+    Envy::string scoped {Envy::string_view{"allocated from a stack buffer, not the heap"}, &arena};
+    pmr.require(scoped.get_resource() == &arena && scoped.c_str() >= reinterpret_cast<const char*>(scratch.data())
+        && scoped.c_str() < reinterpret_cast<const char*>(scratch.data() + scratch.size()), "heap buffer comes from the resource");
+
+    Envy::string escaped {scoped};
+    pmr.require(escaped == scoped && escaped.get_resource() == std::pmr::get_default_resource(), "copy uses the default resource");
+
+    Envy::string kept {std::move(scoped)};
+    pmr.require(kept.get_resource() == &arena && scoped.empty(), "move keeps the resource");
+
+    escaped = std::move(kept);
+    pmr.require(escaped.get_resource() == std::pmr::get_default_resource() && escaped == "allocated from a stack buffer, not the heap",
+        "move assign across resources copies");
+
+    tests.add_case(pmr);
+
+    Envy::test_case interning {"string interning"};
+
+    Envy::string built {"sever"};
+    built += "ity";
+
+    const Envy::string_id from_literal {"severity"_id};
+    const Envy::string_id from_string {built};
+    interning.require(from_literal == from_string && from_literal.hash() == from_string.hash(), "same bytes, same id");
+    interning.require(from_string.view() == Envy::string_view{"severity"} && from_string.c_str()[8] == '\0', "id views the interned text");
+    interning.require(Envy::string_id{Envy::string_view{"sev"}} != from_string, "different bytes, different id");
+    interning.require(Envy::string_id{Envy::string_view{""}} == Envy::string_id{} && Envy::string_id{}.empty(), "empty string");
+    interning.require(Envy::string_id::find(built) == from_string, "find interned");
+    interning.require(!Envy::string_id::find(Envy::string_view{"never interned anywhere"}), "find does not intern");
+
+    tests.add_case(interning);
+
+    Envy::test_case builder {"string builder"};
+
+    const Envy::string logger_name {"Engine"};
+    Envy::string_builder line;
+    line.append("| ").append(logger_name).append(' ').append_format("{:>3}", 42).append(Envy::utf8::code_point{0x20ACu});
+    line.append(Envy::string{" copied from a temporary"});
+
+    const Envy::string joined {line.str()};
+    builder.require(joined == "| Engine  42€ copied from a temporary", "joined = {}"_f(std::string_view{joined}));
+    builder.require(line.size_bytes() == joined.size_bytes() && !joined.is_ascii(), "size known up front");
+
+    Envy::string prefixed {"> "};
+    line.append_to(prefixed);
+    builder.require(prefixed == "> | Engine  42€ copied from a temporary" && prefixed.size() == joined.size() + 2u, "append_to");
+
+    std::array<Envy::utf8::code_unit, 16> tiny;
+    builder.require(line.copy_to(Envy::mutable_buffer{tiny.data(), tiny.size()}) == 0u, "copy_to too small writes nothing");
+
+    Envy::string_builder many;
+    Envy::string expected;
+    for(i32 i {}; i < 40; ++i)
+    {
+        many.append("ab").append('c');
+        expected += "abc";
+    }
+    builder.require(many.str() == expected, "more pieces than fit inline");
+
+    tests.add_case(builder);
+
+    Envy::test_case edit {"search and edit"};
+
+    Envy::string text {"one, two, three Ω, two"};
+    edit.require(text.count(Envy::string_view{"two"}) == 2 && text.count(Envy::utf8::code_point{','}) == 3, "count");
+    edit.require(text.view(text.begin(), text.find(Envy::string_view{"two"})) == "one, ", "find");
+    edit.require(text.view(text.find_last(Envy::string_view{"two"}), text.end()) == "two", "find_last");
+    edit.require(*text.find(Envy::utf8::code_point{0x3A9u}) == 0x3A9u && text.find(Envy::string_view{"four"}) == text.end(), "find code point");
+
+    edit.require(text.replace("two", "2") == 2 && text == "one, 2, three Ω, 2", "replace shrinking, text = {}"_f(std::string_view{text}));
+    edit.require(text.replace("2", "twenty two") == 2 && text == "one, twenty two, three Ω, twenty two", "replace growing, text = {}"_f(std::string_view{text}));
+    edit.require(text.size() == 36u && !text.is_ascii(), "replace keeps metadata");
+
+    auto it {text.remove(text.begin(), 5)};
+    edit.require(text == "twenty two, three Ω, twenty two" && it == text.begin(), "remove");
+    it = text.insert(text.begin(), Envy::string_view{"zero, "});
+    edit.require(text == "zero, twenty two, three Ω, twenty two" && *it == 'z', "insert");
+
+    Envy::string self {"abc"};
+    self.insert(self.end(), self);
+    self.replace(self.find(Envy::string_view{"ca"}), 2, self.view(self.begin(), self.find(Envy::utf8::code_point{'c'})));
+    edit.require(self == "ababbc", "edits aliasing the string itself, self = {}"_f(std::string_view{self}));
+
+    tests.add_case(edit);
+
+    Envy::test_case shared {"shared string"};
+
+    const Envy::shared_string asset {Envy::string_view{"textures/grass €.png"}};
+    Envy::shared_string handle {asset};
+
+    shared.require(handle.data() == asset.data() && asset.use_count() == 2u, "copies share storage");
+    shared.require(handle == "textures/grass €.png" && !handle.is_ascii() && handle.size_bytes() == 22u, "contents");
+    shared.require(Envy::shared_string{}.empty() && Envy::shared_string{Envy::string_view{""}}.use_count() == 0u, "empty strings don't allocate");
+
+    // copies made and dropped on other threads leave only the originals
+    std::vector<std::thread> workers;
+    for(i32 i {}; i < 4; ++i)
+    {
+        workers.emplace_back([handle]
+        {
+            for(i32 j {}; j < 1000; ++j)
+            { Envy::shared_string copy {handle}; }
+        });
+    }
+    for(auto& w : workers)
+    { w.join(); }
+
+    shared.require(asset.use_count() == 2u, "use_count after threads = {}"_f(asset.use_count()));
+
+    handle = Envy::shared_string {};
+    shared.require(asset.use_count() == 1u && asset == Envy::string_view{"textures/grass €.png"}, "release");
+
+    tests.add_case(shared);
+
+    Envy::test_case concat {"lazy concatenation"};
+
+    const Envy::string alpha {"alpha"};
+    const Envy::string joined_expr = "[" + alpha + ']' + Envy::string{" temporary "} + Envy::utf8::code_point{0x20ACu} + std::string{" std"};
+    concat.require(joined_expr == "[alpha] temporary € std" && !joined_expr.is_ascii(), "joined_expr = {}"_f(std::string_view{joined_expr}));
+
+    concat.require(("<" + alpha + ">").size_bytes() == 7u, "size is known before joining");
+
+    Envy::string grown {"xy"};
+    grown += grown + "-" + grown;
+    concat.require(grown == "xyxy-xy" && grown.size() == 7u, "appending an expression that views the string itself");
+
+    tests.add_case(concat);
+
+    Envy::test_case formatting {"formatting"};
+
+    Envy::string formatted {"x = "};
+    Envy::format_to(formatted, "{} {:>3} {}", Envy::string{"ab"}, Envy::string_view{"cd"}, Envy::utf8::code_point{0x20ACu});
+    formatting.require(formatted == "x = ab  cd €" && formatted.size() == 12u && !formatted.is_ascii(), "format_to, formatted = {}"_f(formatted));
+
+    formatting.require(std::format("{}|{:.1f}", Envy::vector2<i32>{1, -2}, Envy::vector2<f32>{0.5f, 2.0f}) == "(1,-2)|(0.5,2.0)", "vector2");
+
+    // grows past the inline buffer
+    Envy::string grown_format;
+    Envy::format_to(grown_format, "{:*^40}", Envy::string_view{"ab"});
+    formatting.require(grown_format.size_bytes() == 40u && grown_format.is_ascii() && grown_format.c_str()[40] == '\0', "grown, size = {}"_f(grown_format.size_bytes()));
+
+    tests.add_case(formatting);
+
+    Envy::test_case parsing {"parse_as"};
+
+    parsing.require(Envy::string{" 42\n"}.parse_as<i32>().value == 42 && Envy::string_view{"+7"}.parse_as<i32>().value == 7, "integers");
+    parsing.require(Envy::string_view{"-1.5e2"}.parse_as<f64>().value == -150.0 && Envy::string_view{".25"}.parse_as<f32>().value == 0.25f, "floats");
+    parsing.require(Envy::string_view{"42 apples"}.parse_as<i32>().error == std::errc::invalid_argument && !Envy::string_view{""}.parse_as<i32>(), "trailing text and empty strings fail");
+    parsing.require(Envy::string_view{"300"}.parse_as<u8>().error == std::errc::result_out_of_range, "out of range");
+
+    const auto position {Envy::string_view{"( 1.5, -2 )"}.parse_as<Envy::vector2<f32>>()};
+    parsing.require(position && position.value.x == 1.5f && position.value.y == -2.0f, "vector2");
+    parsing.require(Envy::string_view{"3,4"}.parse_as<Envy::vector2<i32>>().value.y == 4 && !Envy::string_view{"(3,4"}.parse_as<Envy::vector2<i32>>(), "vector2 parentheses are optional but must match");
+
+    std::array<i32, 4> values {};
+    const auto listed {Envy::string_view{" 1 2\n\t-3 "}.parse_list<i32>(values)};
+    parsing.require(listed.value == 3u && values[0] == 1 && values[2] == -3, "parse_list, {} values"_f(listed.value));
+    parsing.require(Envy::string_view{"1 2 3 4 5"}.parse_list<i32>(values).error == std::errc::value_too_large, "parse_list overflow");
+    parsing.require(Envy::string_view{"1 2x 3"}.parse_list<i32>(values).value == 1u, "parse_list stops at bad values");
+
+    tests.add_case(parsing);
+
+    Envy::test_case chars {"to_chars"};
+
+    std::array<char, 8> digits {};
+    const auto written {Envy::to_chars(digits.data(), digits.data() + digits.size(), -1.5)};
+    chars.require(written.ec == std::errc {} && std::string_view(digits.data(), written.ptr) == "-1.5", "floats are written in their shortest form");
+    chars.require(Envy::to_chars(digits.data(), digits.data() + digits.size(), Envy::string_view{"too long to fit"}).ec == std::errc::value_too_large, "overflow");
+
+    Envy::string appended {"v = "};
+    Envy::append_chars(appended, 42);
+    Envy::append_chars(appended, ' ');
+    Envy::append_chars(appended, true);
+    Envy::append_chars(appended, Envy::vector2<i32>{1, 2});
+    chars.require(appended == "v = 42 true(1,2)", "append_chars, appended = {}"_f(appended));
+
+    tests.add_case(chars);
+
+    Envy::test_case field {"text_buffer"};
+
+    Envy::text_buffer edited {Envy::string_view{"Hello world"}};
+    usize cursor {edited.insert(5u, ",")};
+    field.require(edited.str() == "Hello, world" && cursor == 6u, "insert");
+
+    cursor = edited.remove(edited.prev(cursor));
+    cursor = edited.insert(edited.size_bytes(), Envy::utf8::code_point{0x20ACu});
+    edited.insert(0u, "Ωπ ");
+    field.require(edited.str() == "Ωπ Hello world€" && edited.size() == 15u && cursor == 14u, "remove and insert code points, text = {}"_f(edited.str()));
+    field.require(edited.offset_of(3u) == 5u && edited.at(edited.offset_of(1u)) == 0x3C0u && edited.next(0u) == 2u, "code point positions");
+
+    usize code_points {};
+    for(Envy::string_view segment : edited.segments())
+    { code_points += segment.size(); }
+    field.require(code_points == edited.size(), "segments");
+
+    edited.replace(0u, 3u, edited.view());
+    field.require(edited.str() == "Ωπ Hello world€Hello world€" && edited.size() == 27u, "replacing with a view of itself, text = {}"_f(edited.str()));
+
+    tests.add_case(field);
+
+    Envy::test_case transient {"frame arena"};
+
+    Envy::frame_arena frame {256u};
+    {
+        Envy::string scratch {&frame};
+        for(i32 i {}; i < 40; ++i)
+        { scratch += "abcdefgh"; }
+
+        transient.require(scratch.size_bytes() == 320u && frame.stats().overflows > 0u, "allocations that don't fit go upstream");
+    }
+
+    const usize used {frame.stats().used};
+    frame.reset();
+    transient.require(frame.capacity() >= used && frame.stats().peak == used && frame.stats().used == 0u, "reset grows the block to the frame's size");
+
+    const usize overflows {frame.stats().overflows};
+    {
+        Envy::string scratch {&frame};
+        for(i32 i {}; i < 40; ++i)
+        { scratch += "abcdefgh"; }
+    }
+    transient.require(frame.stats().overflows == overflows, "the next frame fits, overflows = {}"_f(frame.stats().overflows - overflows));
+
+    Envy::double_frame_arena frames {64u};
+    auto* survivor {static_cast<u8*>(frames.current().allocate(16u))};
+    survivor[0] = 42u;
+    frames.flip();
+    transient.require(survivor[0] == 42u && frames.previous().stats().used == 16u, "double buffered memory survives one flip");
+
+    tests.add_case(transient);
+
     tests.submit();
 }
 
@@ -178,6 +767,134 @@ void unicode_test(Envy::test_state& tests)
 {
     tests.start();
 
+    using Envy::utf8::general_category;
+    using Envy::utf8::east_asian_width;
+
+    Envy::test_case properties {"properties"};
+
+    properties.require(Envy::utf8::category('A') == general_category::uppercase_letter, "A is Lu");
+    properties.require(Envy::utf8::category(0x03C0u) == general_category::lowercase_letter, "pi is Ll");
+    properties.require(Envy::utf8::category(0x01C5u) == general_category::titlecase_letter, "Dz is Lt");
+    properties.require(Envy::utf8::category(0x0663u) == general_category::decimal_number, "arabic-indic three is Nd");
+    properties.require(Envy::utf8::category(0x0301u) == general_category::nonspacing_mark, "combining acute is Mn");
+    properties.require(Envy::utf8::category(0x20ACu) == general_category::currency_symbol, "euro is Sc");
+    properties.require(Envy::utf8::category(0x4E2Du) == general_category::other_letter, "CJK ideograph is Lo");
+    properties.require(Envy::utf8::category(0xE000u) == general_category::private_use, "U+E000 is Co");
+    properties.require(Envy::utf8::category(0x0378u) == general_category::unassigned, "U+0378 is Cn");
+    properties.require(Envy::utf8::category(0x110000u) == general_category::unassigned, "past U+10FFFF is Cn");
+    properties.require(Envy::utf8::width_class(0x4E2Du) == east_asian_width::wide, "CJK ideograph is W");
+    properties.require(Envy::utf8::width_class(0xFF21u) == east_asian_width::fullwidth, "fullwidth A is F");
+    properties.require(Envy::utf8::width_class('a') == east_asian_width::narrow, "a is Na");
+    properties.require(Envy::utf8::is_letter(0x00E9u) && !Envy::utf8::is_letter('1'), "is_letter");
+    properties.require(Envy::utf8::is_digit(0x0966u) && !Envy::utf8::is_digit(0x00BDu), "is_digit");
+    properties.require(Envy::utf8::is_whitespace(0x3000u) && Envy::utf8::is_whitespace('\n') && !Envy::utf8::is_whitespace(0x200Bu), "is_whitespace");
+
+    tests.add_case(properties);
+
+    Envy::test_case case_mapping {"simple case mapping"};
+
+    case_mapping.require(Envy::utf8::to_upper('a') == 'A' && Envy::utf8::to_lower('A') == 'a', "ascii");
+    case_mapping.require(Envy::utf8::to_upper(0x03C0u) == 0x03A0u && Envy::utf8::to_lower(0x03A0u) == 0x03C0u, "greek");
+    case_mapping.require(Envy::utf8::to_upper(0x0436u) == 0x0416u, "cyrillic");
+    case_mapping.require(Envy::utf8::to_upper(0x00DFu) == 0x00DFu, "sharp s has no simple uppercase");
+    case_mapping.require(Envy::utf8::to_lower(0x0130u) == 'i', "dotted capital I");
+    case_mapping.require(Envy::utf8::to_upper(0x1E922u) == 0x1E900u, "adlam");
+    case_mapping.require(Envy::utf8::to_upper(0x4E2Du) == 0x4E2Du && Envy::utf8::to_lower('1') == '1', "uncased");
+    case_mapping.require(Envy::utf8::is_upper(0x01C5u) && Envy::utf8::is_lower(0x00DFu), "is_upper, is_lower");
+
+    tests.add_case(case_mapping);
+
+    Envy::test_case ignore_case {"case insensitive comparison"};
+
+    const Envy::string long_ascii {"The Quick Brown Fox Jumps Over The Lazy Dog, Twice Over For Good Measure"};
+    const Envy::string long_lower {"the quick brown fox jumps over the lazy dog, twice over for good measure"};
+
+    ignore_case.require(long_ascii.equals_ignore_case(long_lower) && !long_ascii.equals_ignore_case(Envy::string_view{"the quick"}), "ascii");
+    ignore_case.require(!Envy::string_view{"abc@"}.equals_ignore_case(Envy::string_view{"ABC`"}), "only letters fold");
+    ignore_case.require(Envy::string_view{"\u212Aelvin"}.equals_ignore_case(Envy::string_view{"kELVIN"}), "kelvin sign folds to k");
+    ignore_case.require(Envy::string_view{"\u1E9E"}.equals_ignore_case(Envy::string_view{"\u00DF"}), "capital sharp s");
+    ignore_case.require(!Envy::string_view{"stra\u00DFe"}.equals_ignore_case(Envy::string_view{"STRASSE"}), "simple folding does not expand");
+    ignore_case.require(Envy::string_view{"\u03A3\u03C3\u03C2"}.equals_ignore_case(Envy::string_view{"\u03C3\u03C3\u03C3"}), "sigma");
+    ignore_case.require(Envy::string_view{"apple"}.compare_ignore_case(Envy::string_view{"BANANA"}) < 0, "ordering");
+    ignore_case.require(Envy::string_view{"Apple"}.compare_ignore_case(Envy::string_view{"app"}) > 0, "prefix orders first");
+    ignore_case.require(Envy::string_view{"\u00C4"}.compare_ignore_case(Envy::string_view{"z"}) > 0, "orders by code point");
+    ignore_case.require(long_ascii.hash_ignore_case() == long_lower.hash_ignore_case(), "ascii hash");
+    ignore_case.require(Envy::string_view{"\u212A\u03A3"}.hash_ignore_case() == Envy::string_view{"k\u03C2"}.hash_ignore_case(), "hash folds code points");
+
+    std::unordered_map<Envy::string, int, Envy::case_insensitive_hash, Envy::case_insensitive_equal> keywords;
+    keywords.emplace("While", 1);
+    keywords.emplace("Return", 2);
+    auto found {keywords.find(Envy::string_view{"RETURN"})};
+    ignore_case.require(found != keywords.end() && found->second == 2, "unordered_map lookup");
+
+    const Envy::string folded {Envy::string{"Hello \u03A3\u212A!"}.fold_case()};
+    ignore_case.require(folded == "hello \u03C3k!", "fold_case() '{}'"_f(folded));
+
+    tests.add_case(ignore_case);
+
+    Envy::test_case width {"display width"};
+
+    width.require(Envy::utf8::display_width('a') == 1u && Envy::utf8::display_width('\t') == 0u, "ascii");
+    width.require(Envy::utf8::display_width(0x4E2Du) == 2u && Envy::utf8::display_width(0x1F600u) == 2u, "wide");
+    width.require(Envy::utf8::display_width(0x0301u) == 0u && Envy::utf8::display_width(0x200Bu) == 0u, "zero width");
+    width.require(Envy::utf8::display_width(0x00ADu) == 1u, "soft hyphen");
+    width.require(Envy::utf8::display_width(0x1161u) == 0u, "hangul medial vowel");
+
+    Envy::string mixed {"ab 中文 e\u0301 😁"};
+    usize mixed_width { Envy::utf8::display_width(mixed) };
+    width.require(mixed_width == 12u, "string width {} == 12"_f(mixed_width));
+    width.require(Envy::utf8::display_width(Envy::string_view{"plain ascii"}) == 11u, "ascii string");
+
+    tests.add_case(width);
+
+    Envy::test_case graphemes {"grapheme clusters"};
+
+    // e + combining acute, family (ZWJ sequence), flag, skin tone, CR LF, hangul jamo
+    Envy::string clusters {"e\u0301👩‍👩‍👧🇳🇴👍🏽\r\nx\u1100\u1161\u11A8"};
+    std::vector<Envy::string> expected {"e\u0301", "👩‍👩‍👧", "🇳🇴", "👍🏽", "\r\n", "x", "\u1100\u1161\u11A8"};
+
+    std::vector<Envy::string> forward;
+    for(auto cluster : Envy::utf8::graphemes(clusters))
+    { forward.emplace_back(cluster); }
+
+    std::vector<Envy::string> backward;
+    const auto range {Envy::utf8::graphemes(clusters)};
+    for(auto i {range.end()}; i != range.begin();)
+    { backward.emplace(backward.begin(), *--i); }
+
+    graphemes.require(forward == expected, "forward iteration, {} clusters"_f(forward.size()));
+    graphemes.require(backward == expected, "backward iteration, {} clusters"_f(backward.size()));
+    graphemes.require(Envy::utf8::count_graphemes(clusters) == expected.size(), "count");
+    graphemes.require(Envy::utf8::count_graphemes(Envy::string_view{"plain ascii, no joins\r\n"}) == 22u, "ascii count");
+
+    Envy::string flags {"🇳🇴🇸🇪🇫"}; // three regional indicator pairs, the last unpaired
+    graphemes.require(Envy::utf8::count_graphemes(flags) == 3u, "regional indicator pairs");
+    graphemes.require(Envy::utf8::is_grapheme_boundary(flags, 8u) && !Envy::utf8::is_grapheme_boundary(flags, 4u)
+        && !Envy::utf8::is_grapheme_boundary(flags, 2u), "is_grapheme_boundary");
+    graphemes.require(Envy::utf8::next_grapheme_boundary(flags, 1u) == 8u && Envy::utf8::prev_grapheme_boundary(flags, 12u) == 8u,
+        "next and prev boundary");
+
+    tests.add_case(graphemes);
+
+    Envy::test_case lines {"line break opportunities"};
+
+    auto opportunities = [](Envy::string_view text)
+    {
+        std::vector<usize> offsets;
+        for(auto opportunity : Envy::utf8::line_breaks(text))
+        { offsets.push_back(opportunity.mandatory ? opportunity.offset + 1000u : opportunity.offset); }
+        return offsets;
+    };
+
+    lines.require(opportunities("The quick (brown) fox.") == std::vector<usize>{4, 10, 18, 1022}, "words, LB14 LB13");
+    lines.require(opportunities("well-known 3.14\nnext") == std::vector<usize>{5, 11, 1016, 1020}, "hyphen, number, newline");
+    lines.require(opportunities("日本語") == std::vector<usize>{3, 6, 1009}, "ideographs");
+    lines.require(opportunities("a\u00A0b c") == std::vector<usize>{5, 1006}, "glue");
+    lines.require(opportunities("\U0001FC00ab\U0001F3FB") == std::vector<usize>{4, 6, 1010}, "LB30b does not reach past ascii letters");
+    lines.require(opportunities("").empty(), "empty string");
+
+    tests.add_case(lines);
+
     tests.submit();
 }
 
@@ -203,6 +920,8 @@ void macro_test(Envy::test_state& tests)
     macros.add("first-name", "Patrick");
     macros.add("last-name", "Torgerson");
     macros.add("full-name", "{first-name} {last-name}");
+    macros.add("größe", 7);
+    macros.add("名前", "Envy");
 
     std::source_location loc {std::source_location::current()};
 
@@ -218,6 +937,7 @@ void macro_test(Envy::test_state& tests)
     std::string torgerson {Envy::expand_local_macros("{len:{last-name}}", macros)};
     std::string name      {Envy::expand_local_macros("{full-name}", macros)};
     std::string beanlen   {Envy::expand_local_macros("{len:{test}}", macros)};
+    std::string unicode   {Envy::expand_local_macros("{größe} {名前} {1größe}", macros)};
 
     tests.add_case(beans == "beans",              "test -> beans = {}"_f(beans));
     tests.add_case(forty2 == "42",                "answer -> 42 = {}"_f(forty2));
@@ -227,6 +947,10 @@ void macro_test(Envy::test_state& tests)
     tests.add_case(torgerson == "9",              "len:last-name -> 9 = {}"_f(torgerson));
     tests.add_case(name == "Patrick Torgerson",   "full-name -> Patrick Torgerson = {}"_f(name));
     tests.add_case(beanlen == "5",                "len:test -> 5 = {}"_f(beanlen));
+    tests.add_case(unicode == "7 Envy {1größe}",  "unicode identifiers -> 7 Envy {{1größe}} = {}"_f(unicode));
+
+    macros.remove("test");
+    tests.add_case(!macros.expand("test"_id).success && macros.expand("answer").success, "remove by name");
 
     // TODO: test expanding with multiple macro_maps
 
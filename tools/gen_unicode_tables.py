@@ -0,0 +1,272 @@
+#!/usr/bin/env python3
+"""Generates source/unicode_tables.hpp from Python's Unicode Character Database.
+
+Two-stage tables map each code point to a property record (general category,
+east asian width, display columns), to a simple case mapping and folding record
+and to a text segmentation record (grapheme cluster break, line break class).
+
+usage: tools/gen_unicode_tables.py <ucd directory>
+
+Run from the repository root. The Unicode version is that of the Python used,
+the UCD directory must hold LineBreak.txt, GraphemeBreakProperty.txt,
+emoji-data.txt and CaseFolding.txt of the same version, Python does not expose
+those properties.
+"""
+
+import os
+import sys
+import unicodedata
+
+CATEGORIES = [
+    ("Lu", "uppercase_letter"), ("Ll", "lowercase_letter"), ("Lt", "titlecase_letter"),
+    ("Lm", "modifier_letter"), ("Lo", "other_letter"),
+    ("Mn", "nonspacing_mark"), ("Mc", "spacing_mark"), ("Me", "enclosing_mark"),
+    ("Nd", "decimal_number"), ("Nl", "letter_number"), ("No", "other_number"),
+    ("Pc", "connector_punctuation"), ("Pd", "dash_punctuation"), ("Ps", "open_punctuation"),
+    ("Pe", "close_punctuation"), ("Pi", "initial_punctuation"), ("Pf", "final_punctuation"),
+    ("Po", "other_punctuation"),
+    ("Sm", "math_symbol"), ("Sc", "currency_symbol"), ("Sk", "modifier_symbol"), ("So", "other_symbol"),
+    ("Zs", "space_separator"), ("Zl", "line_separator"), ("Zp", "paragraph_separator"),
+    ("Cc", "control"), ("Cf", "format"), ("Cs", "surrogate"), ("Co", "private_use"), ("Cn", "unassigned"),
+]
+
+WIDTHS = [("N", "neutral"), ("A", "ambiguous"), ("H", "halfwidth"), ("W", "wide"), ("F", "fullwidth"), ("Na", "narrow")]
+
+GRAPHEME_BREAKS = [
+    ("Other", "other"), ("CR", "cr"), ("LF", "lf"), ("Control", "control"), ("Extend", "extend"),
+    ("ZWJ", "zwj"), ("Regional_Indicator", "regional_indicator"), ("Prepend", "prepend"),
+    ("SpacingMark", "spacing_mark"), ("L", "l"), ("V", "v"), ("T", "t"), ("LV", "lv"), ("LVT", "lvt"),
+    ("Extended_Pictographic", "extended_pictographic"),
+]
+
+LINE_BREAKS = [
+    ("BK", "mandatory_break"), ("CR", "carriage_return"), ("LF", "line_feed"), ("CM", "combining_mark"),
+    ("NL", "next_line"), ("SG", "surrogate"), ("WJ", "word_joiner"), ("ZW", "zw_space"), ("GL", "glue"),
+    ("SP", "space"), ("ZWJ", "zwj"), ("B2", "break_both"), ("BA", "break_after"), ("BB", "break_before"),
+    ("HY", "hyphen"), ("CB", "contingent_break"), ("CL", "close_punctuation"), ("CP", "close_parenthesis"),
+    ("EX", "exclamation"), ("IN", "inseparable"), ("NS", "nonstarter"), ("OP", "open_punctuation"),
+    ("QU", "quotation"), ("IS", "infix_numeric"), ("NU", "numeric"), ("PO", "postfix_numeric"),
+    ("PR", "prefix_numeric"), ("SY", "break_symbols"), ("AI", "ambiguous"), ("AL", "alphabetic"),
+    ("CJ", "conditional_japanese_starter"), ("EB", "e_base"), ("EM", "e_modifier"), ("H2", "h2"), ("H3", "h3"),
+    ("HL", "hebrew_letter"), ("ID", "ideographic"), ("JL", "jl"), ("JT", "jt"), ("JV", "jv"),
+    ("RI", "regional_indicator"), ("SA", "complex_context"), ("XX", "unknown"),
+]
+
+# flags of a break record
+EAST_ASIAN = 1          # east asian width F, W or H, excluded from LB30
+PICTOGRAPHIC_CN = 2     # unassigned extended pictographic, LB30b
+
+PROPERTY_SHIFT = 8
+CASE_SHIFT = 6
+CASE_LIMIT = 0x20000 # no code point at or above this has a case mapping
+BREAK_SHIFT = 7
+
+
+def simple_upper(c):
+    upper = c.upper()
+    if len(upper) == 1:
+        return ord(upper)
+    # full mappings expand, the simple mapping of those that have one is their titlecase
+    title = c.title()
+    return ord(title) if len(title) == 1 else ord(c)
+
+
+def simple_lower(c):
+    if ord(c) == 0x130: # the only code point whose full lowercase mapping expands
+        return 0x69
+    lower = c.lower()
+    return ord(lower) if len(lower) == 1 else ord(c)
+
+
+def columns(cp, category, width):
+    if cp == 0 or category in ("Mn", "Me", "Cc", "Cf") and cp != 0xAD:
+        return 0
+    if 0x1160 <= cp <= 0x11FF: # hangul medial vowels and final consonants join the preceding syllable
+        return 0
+    if width in ("W", "F"):
+        return 2
+    return 1
+
+
+def read_ucd(directory, name, default):
+    """Reads a UCD property file of 'range ; value # comment' lines into a list indexed by code point"""
+    values = [default] * 0x110000
+    with open(os.path.join(directory, name), encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            codes, value = (field.strip() for field in line.split(";")[:2])
+            first, _, last = codes.partition("..")
+            for cp in range(int(first, 16), int(last or first, 16) + 1):
+                values[cp] = value
+    return values
+
+
+def read_case_folding(directory):
+    """Reads the simple case folding, statuses C and S, of CaseFolding.txt"""
+    folding = {}
+    with open(os.path.join(directory, "CaseFolding.txt"), encoding="utf-8") as f:
+        for line in f:
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            code, status, mapping = (field.strip() for field in line.split(";")[:3])
+            if status in ("C", "S"):
+                folding[int(code, 16)] = int(mapping, 16)
+    return folding
+
+
+def resolve_line_break(line_break, category):
+    """Applies LB1, the resolution of classes whose behavior UAX #14 leaves to the implementation"""
+    if line_break in ("AI", "SG", "XX"):
+        return "AL"
+    if line_break == "SA":
+        return "CM" if category in ("Mn", "Mc") else "AL"
+    if line_break == "CJ":
+        return "NS"
+    return line_break
+
+
+def two_stage(values, shift, limit):
+    size = 1 << shift
+    blocks, stage1 = {}, []
+    for start in range(0, limit, size):
+        block = tuple(values[start:start + size])
+        stage1.append(blocks.setdefault(block, len(blocks)))
+    stage2 = [v for block in blocks for v in block]
+    return stage1, stage2
+
+
+def emit_array(out, type_, name, values, per_line=32):
+    out.append(f"    inline constexpr {type_} {name}[{len(values)}]\n    {{\n")
+    for i in range(0, len(values), per_line):
+        out.append("        " + ",".join(str(v) for v in values[i:i + per_line]) + ",\n")
+    out.append("    };\n\n")
+
+
+def main():
+    if len(sys.argv) != 2:
+        print(__doc__)
+        return 1
+
+    grapheme_breaks = read_ucd(sys.argv[1], "GraphemeBreakProperty.txt", "Other")
+    line_breaks = read_ucd(sys.argv[1], "LineBreak.txt", "XX")
+    pictographic = read_ucd(sys.argv[1], "emoji-data.txt", None)
+    folding = read_case_folding(sys.argv[1])
+    assert max(folding) < CASE_LIMIT
+
+    category_index = {abbr: name for abbr, name in CATEGORIES}
+    width_index = {abbr: name for abbr, name in WIDTHS}
+
+    properties, property_ids = {}, []
+    cases, case_ids = {}, []
+    breaks, break_ids = {}, []
+
+    for cp in range(0x110000):
+        c = chr(cp)
+        category = unicodedata.category(c)
+        width = unicodedata.east_asian_width(c)
+
+        record = (category, width, columns(cp, category, width))
+        property_ids.append(properties.setdefault(record, len(properties)))
+
+        if cp < CASE_LIMIT:
+            surrogate = 0xD800 <= cp <= 0xDFFF
+            record = (0, 0, 0) if surrogate else (simple_upper(c) - cp, simple_lower(c) - cp, folding.get(cp, cp) - cp)
+            case_ids.append(cases.setdefault(record, len(cases)))
+
+        grapheme = grapheme_breaks[cp]
+        if pictographic[cp] == "Extended_Pictographic":
+            assert grapheme == "Other"
+            grapheme = "Extended_Pictographic"
+
+        flags = EAST_ASIAN if width in ("F", "W", "H") else 0
+        if grapheme == "Extended_Pictographic" and category == "Cn":
+            flags |= PICTOGRAPHIC_CN
+
+        record = (grapheme, line_breaks[cp], resolve_line_break(line_breaks[cp], category), flags)
+        break_ids.append(breaks.setdefault(record, len(breaks)))
+
+    assert cases[(0, 0, 0)] == 0
+
+    property_stage1, property_stage2 = two_stage(property_ids, PROPERTY_SHIFT, 0x110000)
+    case_stage1, case_stage2 = two_stage(case_ids, CASE_SHIFT, CASE_LIMIT)
+    break_stage1, break_stage2 = two_stage(break_ids, BREAK_SHIFT, 0x110000)
+
+    grapheme_index = dict(GRAPHEME_BREAKS)
+    line_index = dict(LINE_BREAKS)
+
+    index_type = lambda values: "u8" if max(values) < 256 else "u16"
+
+    out = [f"""// Generated by tools/gen_unicode_tables.py from the Unicode Character Database {unicodedata.unidata_version}, do not edit
+
+#pragma once
+
+#include <unicode.hpp>
+
+namespace Envy::utf8::unicode_tables
+{{
+    struct property_record
+    {{
+        general_category category;
+        east_asian_width width;
+        u8 columns;
+    }};
+
+    struct case_record
+    {{
+        i32 to_upper; ///< Added to a code point to map it to uppercase
+        i32 to_lower; ///< Added to a code point to map it to lowercase
+        i32 fold;     ///< Added to a code point to case fold it
+    }};
+
+    struct break_record
+    {{
+        grapheme_break grapheme;
+        line_break line;
+        line_break resolved_line; ///< line break class after LB1
+        u8 flags;
+    }};
+
+    inline constexpr u8 east_asian {{{EAST_ASIAN}u}}; ///< East Asian Width F, W or H
+    inline constexpr u8 pictographic_unassigned {{{PICTOGRAPHIC_CN}u}}; ///< Unassigned Extended_Pictographic
+
+    inline constexpr u32 property_shift {{{PROPERTY_SHIFT}u}};
+    inline constexpr u32 case_shift {{{CASE_SHIFT}u}};
+    inline constexpr u32 case_limit {{0x{CASE_LIMIT:X}u}};
+    inline constexpr u32 break_shift {{{BREAK_SHIFT}u}};
+
+    inline constexpr property_record properties[{len(properties)}]
+    {{
+"""]
+    for category, width, cols in properties:
+        out.append(f"        {{ general_category::{category_index[category]}, east_asian_width::{width_index[width]}, {cols} }},\n")
+    out.append("    };\n\n")
+
+    out.append(f"    inline constexpr case_record cases[{len(cases)}]\n    {{\n")
+    for upper, lower, fold in cases:
+        out.append(f"        {{ {upper}, {lower}, {fold} }},\n")
+    out.append("    };\n\n")
+
+    out.append(f"    inline constexpr break_record breaks[{len(breaks)}]\n    {{\n")
+    for grapheme, line, resolved, flags in breaks:
+        out.append(f"        {{ grapheme_break::{grapheme_index[grapheme]}, line_break::{line_index[line]}, "
+                   f"line_break::{line_index[resolved]}, {flags} }},\n")
+    out.append("    };\n\n")
+
+    emit_array(out, index_type(property_stage1), "property_stage1", property_stage1)
+    emit_array(out, index_type(property_stage2), "property_stage2", property_stage2)
+    emit_array(out, index_type(case_stage1), "case_stage1", case_stage1)
+    emit_array(out, index_type(case_stage2), "case_stage2", case_stage2)
+    emit_array(out, index_type(break_stage1), "break_stage1", break_stage1)
+    emit_array(out, index_type(break_stage2), "break_stage2", break_stage2)
+
+    out.append("}\n")
+
+    with open("source/unicode_tables.hpp", "w", newline="\n") as f:
+        f.write("".join(out).replace("\n\n}\n", "\n}\n"))
+
+
+if __name__ == "__main__":
+    sys.exit(main())